@@ -0,0 +1,70 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Header file for the AttackMap class, the squares each side attacks and how often.
+
+#ifndef ATTACKMAP_H
+#define ATTACKMAP_H
+
+#include "Bitboard.h"   //Provides colors, piece types and bitboard helpers.
+#include <cstdint>      //Provides fixed-width integer types.
+
+using namespace std;
+
+/**
+ * @class AttackMap
+ * @brief Attack sets and attacker counts of both sides for all 64 squares.
+ *
+ * Built in one pass with whole-board shifts instead of square-by-square
+ * lookups: pawns, knights and kings shift their full piece set once per
+ * step direction, and sliders flood-fill each ray direction through the
+ * empty squares (Kogge-Stone). Within one direction a square can only be
+ * hit by the nearest piece, so adding each direction's set to a bit-sliced
+ * counter (bit k of every square's count in counts[color][k]) gives exact
+ * attacker counts. X-ray attacks through other pieces are not counted.
+ *
+ * Both ChessBoard and the evaluation build it from the same per-piece
+ * square sets, indexed by color * 6 + type.
+ */
+class AttackMap
+{
+public:
+    static const int COUNT_BITS = 5;        //Enough bits for the 16 pieces of one side
+
+    uint64_t attacks[2];                    //Squares attacked at least once by each side
+    uint64_t byType[2][6];                  //Squares attacked by each side's pieces of one type
+    uint64_t counts[2][COUNT_BITS];         //Attacker counts per square, one bit plane per binary digit
+
+    /**
+     * @brief Builds the map for a position.
+     *
+     * @param pieces Squares of each piece, indexed by color * 6 + type.
+     */
+    void build(const uint64_t pieces[12]);
+
+    /**
+     * @brief Gets the number of pieces of one side attacking a square.
+     *
+     * @param color The attacking side.
+     * @param sq The square (0-63).
+     */
+    int count(int color, int sq) const;
+
+    /**
+     * @brief Gets the squares attacked by at least some number of pieces of one side.
+     *
+     * @param color The attacking side.
+     * @param n The least number of attackers (1 or more).
+     */
+    uint64_t atLeast(int color, int n) const;
+
+    /**
+     * @brief Adds up the attacker counts of one side over a set of squares.
+     *
+     * @param color The attacking side.
+     * @param squares The squares to add up (e.g., a king zone).
+     * @return The total number of attacks on those squares.
+     */
+    int totalOn(int color, uint64_t squares) const;
+};
+
+#endif // !ATTACKMAP_H
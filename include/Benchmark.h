@@ -0,0 +1,122 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Header file for the Benchmark class, which measures the engine on a fixed position set.
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include "ChessBoard.h" //Provides the boards played through by the board benchmark.
+#include "GameArchive.h" //Provides the archive measured by the archive benchmark.
+#include "Search.h"     //Provides the search being measured.
+#include <iostream>     //For writing the report.
+#include <string>       //For the position list.
+#include <vector>       //For the position list.
+
+using namespace std;
+
+/**
+ * @class Benchmark
+ * @brief Runs the search over a fixed list of positions and reports nodes and time.
+ *
+ * Running the same positions to the same depth with different SearchOptions
+ * shows what each selective technique does to node count and time-to-depth.
+ */
+class Benchmark
+{
+public:
+    /**
+     * @brief Gets the fixed benchmark positions as FEN strings.
+     */
+    static const vector<string>& positions();
+
+    /**
+     * @brief Searches every benchmark position to a fixed depth.
+     *
+     * Prints one line per position and a total line with nodes, time and
+     * nodes per second.
+     *
+     * @param search The search to run, with its options already set.
+     * @param depth The depth to search each position to.
+     * @param out Where to write the report.
+     * @param nps If not null, receives the nodes per second of the total line.
+     * @return The total number of nodes searched.
+     */
+    static uint64_t run(Search& search, int depth, ostream& out, uint64_t* nps = nullptr);
+
+    /**
+     * @brief Measures perft speed through the dispatching and the side-specific entry points.
+     *
+     * Counts the legal move tree of every benchmark position twice: once
+     * through generateMoves(), makeMove() and unmakeMove(), which check the
+     * side to move on every call before running the side-specific code, and
+     * once with EngineBoard::perft(), which alternates between the two
+     * side-specific instances directly. Both paths share the specialised
+     * move code, so the report shows only the cost of the per-call dispatch.
+     *
+     * @param depth The perft depth for each position.
+     * @param out Where to write the report.
+     * @return Nodes per second of EngineBoard::perft().
+     */
+    static uint64_t runPerft(int depth, ostream& out);
+
+    /**
+     * @brief Measures how fast Free Play boards are set up and played through.
+     *
+     * Plays the same short game (with a capture) on a newly constructed
+     * board per game, then again on one board that is reset between games,
+     * and reports games per second for both, followed by the time to
+     * restore and export a snapshot of the final position.
+     *
+     * @param games The number of games to play in each part.
+     * @param out Where to write the report.
+     * @return Games per second on newly constructed boards.
+     */
+    static uint64_t runBoards(int games, ostream& out);
+
+    /**
+     * @brief Measures the game archive on random games.
+     *
+     * Plays reproducible random games, writes them to an archive, reads
+     * them all back in order and checks them, then reads games by number.
+     * Reports bytes per move and moves decoded per second. The file is
+     * removed afterwards.
+     *
+     * @param games The number of games to store.
+     * @param path The archive file to use.
+     * @param out Where to write the report.
+     * @return Moves decoded per second, or 0 if a game did not read back the same.
+     */
+    static uint64_t runArchive(int games, const string& path, ostream& out);
+
+    //Rounds of the micro benchmarks run by runSuite()
+    static const int MICRO_ROUNDS = 200;
+
+    /**
+     * @brief Times single Free Play board operations over the benchmark positions.
+     *
+     * Reports nanoseconds per call of ChessBoard::isPathClear, each piece
+     * type's getLegalMoves, movePiece (with the restore that undoes it, and
+     * the restore alone), displayBoard with the output discarded, and
+     * Chess::parseChessNotation.
+     *
+     * @param rounds How many times to repeat each measurement.
+     * @param out Where to write the report.
+     * @return A checksum of the results, the same on every run.
+     */
+    static uint64_t runMicro(int rounds, ostream& out);
+
+    /**
+     * @brief Runs the micro benchmarks, then the search benchmark with default options.
+     *
+     * Ends with a signature line: the total node count, which only changes
+     * when a change alters what the search does, and the nodes per second
+     * of the search benchmark's total line.
+     *
+     * @param depth The depth to search each position to.
+     * @param out Where to write the report.
+     * @return The total number of nodes searched.
+     */
+    static uint64_t runSuite(int depth, ostream& out);
+};
+
+#endif // !BENCHMARK_H
@@ -0,0 +1,283 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Bitboard utilities and attack tables used by the chess engine.
+
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include <cstdint>      //Provides fixed-width integer types for 64-bit boards.
+#include <string>       //For rendering a bitboard as text.
+
+#if defined(_MSC_VER)
+#include <intrin.h>     //Provides bit scan and population count intrinsics on MSVC.
+#endif
+
+using namespace std;
+
+//Side colors used by the engine. Index into per-color tables.
+enum Color { WHITE = 0, BLACK = 1 };
+
+//Piece kinds used by the engine. Index into per-type tables.
+enum PieceType { PAWN = 0, KNIGHT = 1, BISHOP = 2, ROOK = 3, QUEEN = 4, KING = 5 };
+
+//Colored piece codes (color * 6 + type) and the empty square marker.
+const int NO_PIECE = 12;
+
+//Square used when there is no square (e.g., no en passant target).
+const int NO_SQUARE = -1;
+
+//The A and H files as square sets, for masking out shifts that wrap around the board edge.
+const uint64_t FILE_A_SQUARES = 0x0101010101010101ULL;
+const uint64_t FILE_H_SQUARES = 0x8080808080808080ULL;
+
+/**
+ * @struct AttackTables
+ * @brief Precomputed attack and geometry tables, built by the compiler.
+ *
+ * build() is evaluated at compile time, so the tables are read-only data in
+ * the binary: nothing is filled in when a process starts, and no caller has
+ * to remember to initialise them first.
+ */
+struct AttackTables
+{
+    uint64_t knight[64];            //Knight attacks from each square
+    uint64_t king[64];              //King attacks from each square
+    uint64_t pawn[2][64];           //Pawn capture targets per color
+    uint64_t ray[8][64];            //Sliding rays per direction (N, S, E, W, NE, NW, SE, SW)
+    uint64_t between[64][64];       //Squares strictly between two squares on a line
+    uint64_t line[64][64];          //The whole rank, file or diagonal through two squares, edge to edge
+    uint8_t distance[64][64];       //King steps between two squares
+
+    /**
+     * @brief Computes every table by stepping from each square with the piece offsets.
+     *
+     * Row 0 is the eighth rank, so "north" decreases the row and White pawns
+     * capture toward row 0.
+     */
+    static constexpr AttackTables build()
+    {
+        AttackTables t{};
+        const int knightSteps[8][2] = { {-2, 1}, {-1, 2}, {1, 2}, {2, 1}, {2, -1}, {1, -2}, {-1, -2}, {-2, -1} };
+        const int kingSteps[8][2] = { {-1, -1}, {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}, {1, 1} };
+        const int rayRow[8] = { -1, 1, 0, 0, -1, -1, 1, 1 };
+        const int rayCol[8] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+        const int opposite[8] = { 1, 0, 3, 2, 7, 6, 5, 4 };
+
+        for (int sq = 0; sq < 64; sq++)
+        {
+            int row = sq >> 3;
+            int col = sq & 7;
+
+            for (int i = 0; i < 8; i++)
+            {
+                int r = row + knightSteps[i][0];
+                int c = col + knightSteps[i][1];
+                if (r >= 0 && r < 8 && c >= 0 && c < 8)
+                {
+                    t.knight[sq] |= 1ULL << (r * 8 + c);
+                }
+
+                r = row + kingSteps[i][0];
+                c = col + kingSteps[i][1];
+                if (r >= 0 && r < 8 && c >= 0 && c < 8)
+                {
+                    t.king[sq] |= 1ULL << (r * 8 + c);
+                }
+            }
+
+            for (int dc = -1; dc <= 1; dc += 2)
+            {
+                int c = col + dc;
+                if (c >= 0 && c < 8 && row > 0)
+                {
+                    t.pawn[WHITE][sq] |= 1ULL << ((row - 1) * 8 + c);
+                }
+                if (c >= 0 && c < 8 && row < 7)
+                {
+                    t.pawn[BLACK][sq] |= 1ULL << ((row + 1) * 8 + c);
+                }
+            }
+
+            //Each square on a ray is between the origin and every square further along
+            for (int dir = 0; dir < 8; dir++)
+            {
+                for (int r = row + rayRow[dir], c = col + rayCol[dir]; r >= 0 && r < 8 && c >= 0 && c < 8;
+                    r += rayRow[dir], c += rayCol[dir])
+                {
+                    t.between[sq][r * 8 + c] = t.ray[dir][sq];
+                    t.ray[dir][sq] |= 1ULL << (r * 8 + c);
+                }
+            }
+
+            for (int target = 0; target < 64; target++)
+            {
+                int dr = (target >> 3) - row;
+                int dc = (target & 7) - col;
+                dr = dr < 0 ? -dr : dr;
+                dc = dc < 0 ? -dc : dc;
+                t.distance[sq][target] = static_cast<uint8_t>(dr > dc ? dr : dc);
+            }
+        }
+
+        //A line needs the rays both ways, so it is filled once all rays exist
+        for (int sq = 0; sq < 64; sq++)
+        {
+            for (int dir = 0; dir < 8; dir++)
+            {
+                uint64_t full = t.ray[dir][sq] | t.ray[opposite[dir]][sq] | (1ULL << sq);
+                for (int target = 0; target < 64; target++)
+                {
+                    if ((t.ray[dir][sq] >> target) & 1)
+                    {
+                        t.line[sq][target] = full;
+                    }
+                }
+            }
+        }
+        return t;
+    }
+};
+
+/**
+ * @class Bitboards
+ * @brief Static helpers for 64-bit square sets and precomputed attack tables.
+ *
+ * Squares are numbered the same way as ChessBoard's [row][col] array:
+ * square = row * 8 + col, so a8 is 0 and h1 is 63. White pawns therefore
+ * advance toward lower square numbers.
+ */
+class Bitboards
+{
+private:
+    static constexpr AttackTables TABLES = AttackTables::build();   //Every table, computed at compile time
+
+    /**
+     * @brief Computes slider attacks along one ray, stopping at the first blocker.
+     *
+     * @param dir The ray direction index.
+     * @param sq The origin square.
+     * @param occupied The occupied squares.
+     * @return The attacked squares along the ray, including the blocker.
+     */
+    static uint64_t rayAttacks(int dir, int sq, uint64_t occupied);
+
+public:
+    /**
+     * @brief Returns a board with only the given square set.
+     */
+    static inline uint64_t squareBit(int sq) { return 1ULL << sq; }
+
+    /**
+     * @brief Counts the set bits of a bitboard.
+     */
+    static inline int popCount(uint64_t b)
+    {
+#if defined(_MSC_VER)
+        return static_cast<int>(__popcnt64(b));
+#else
+        return __builtin_popcountll(b);
+#endif
+    }
+
+    /**
+     * @brief Returns the index of the least significant set bit. The board must not be empty.
+     */
+    static inline int lsb(uint64_t b)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward64(&index, b);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctzll(b);
+#endif
+    }
+
+    /**
+     * @brief Returns the index of the most significant set bit. The board must not be empty.
+     */
+    static inline int msb(uint64_t b)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanReverse64(&index, b);
+        return static_cast<int>(index);
+#else
+        return 63 - __builtin_clzll(b);
+#endif
+    }
+
+    /**
+     * @brief Removes and returns the least significant set bit of a bitboard.
+     */
+    static inline int popLsb(uint64_t& b)
+    {
+        int sq = lsb(b);
+        b &= b - 1;
+        return sq;
+    }
+
+    /**
+     * @brief Moves every square of a set by the same square offset (positive toward h1).
+     *
+     * Squares pushed off the top or bottom are dropped; callers mask out
+     * squares that wrapped from one edge file to the other.
+     */
+    static inline uint64_t shift(uint64_t b, int delta) { return delta > 0 ? b << delta : b >> -delta; }
+
+    /**
+     * @brief Returns the eight squares of one row (row 0 is the eighth rank).
+     */
+    static inline uint64_t rowSquares(int row) { return 0xFFULL << (row * 8); }
+
+    static inline int rowOf(int sq) { return sq >> 3; }
+    static inline int colOf(int sq) { return sq & 7; }
+
+    static uint64_t knightAttacks(int sq) { return TABLES.knight[sq]; }
+    static uint64_t kingAttacks(int sq) { return TABLES.king[sq]; }
+    static uint64_t pawnAttacks(int color, int sq) { return TABLES.pawn[color][sq]; }
+
+    /**
+     * @brief Squares strictly between two squares on the same rank, file or diagonal.
+     *
+     * @return The squares between, or 0 if the squares are adjacent or not on a line.
+     */
+    static uint64_t between(int from, int to) { return TABLES.between[from][to]; }
+
+    /**
+     * @brief The whole rank, file or diagonal through two squares, from edge to edge.
+     *
+     * @return The line including both squares, or 0 if they are not on a line.
+     */
+    static uint64_t line(int a, int b) { return TABLES.line[a][b]; }
+
+    /**
+     * @brief The number of king steps between two squares.
+     */
+    static int distance(int a, int b) { return TABLES.distance[a][b]; }
+
+    /**
+     * @brief Bishop attacks from a square given the board occupancy.
+     */
+    static uint64_t bishopAttacks(int sq, uint64_t occupied);
+
+    /**
+     * @brief Rook attacks from a square given the board occupancy.
+     */
+    static uint64_t rookAttacks(int sq, uint64_t occupied);
+
+    /**
+     * @brief Queen attacks from a square given the board occupancy.
+     */
+    static uint64_t queenAttacks(int sq, uint64_t occupied)
+    {
+        return bishopAttacks(sq, occupied) | rookAttacks(sq, occupied);
+    }
+
+    /**
+     * @brief Renders a bitboard as an 8x8 grid of 'x' and '.' for debugging.
+     */
+    static string toString(uint64_t b);
+};
+
+#endif // !BITBOARD_H
@@ -0,0 +1,63 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Header file for the BoardSnapshot struct, a compact copyable copy of a position.
+
+#ifndef BOARDSNAPSHOT_H
+#define BOARDSNAPSHOT_H
+
+#include <cstdint>      //Provides fixed-width integer types.
+#include <cstring>      //For comparing snapshots byte by byte.
+
+using namespace std;
+
+/**
+ * @struct BoardSnapshot
+ * @brief A whole position in 48 bytes that can be copied freely.
+ *
+ * ChessBoard and EngineBoard both export and import it, so one live game
+ * can be handed to any number of threads or side lines by plain copies,
+ * without FEN text and without sharing the board. Squares are numbered as
+ * on both boards (a8 = 0 ... h1 = 63) and pieces use the engine's codes
+ * (color * 6 + type). The hash is the engine's Zobrist hash, so it matches
+ * EngineBoard::getHash() and transposition table keys.
+ */
+struct BoardSnapshot
+{
+    static const int NO_EN_PASSANT = -1;    //enPassant value when there is no target square
+
+    uint8_t squares[32];        //Two squares per byte, even square in the low nibble: 0 empty, else piece code + 1
+    uint8_t side;               //Side to move (0 White, 1 Black)
+    uint8_t castling;           //Castling right bits as in EngineBoard
+    int8_t enPassant;           //En passant target square, or NO_EN_PASSANT
+    uint8_t halfmoveClock;      //Plies since the last capture or pawn move, capped at 255
+    uint16_t fullmoveNumber;    //Move number as written in FEN
+    uint16_t reserved;          //Always zero; keeps the hash aligned
+    uint64_t hash;              //Zobrist hash of the position
+
+    /**
+     * @brief Gets the piece on a square.
+     *
+     * @param sq The square (0-63).
+     * @return The piece code plus one, or 0 for an empty square.
+     */
+    int codeAt(int sq) const { return (squares[sq >> 1] >> ((sq & 1) * 4)) & 15; }
+
+    /**
+     * @brief Sets the piece on a square.
+     *
+     * @param sq The square (0-63).
+     * @param code The piece code plus one, or 0 to empty the square.
+     */
+    void setCode(int sq, int code)
+    {
+        int shift = (sq & 1) * 4;
+        squares[sq >> 1] = static_cast<uint8_t>((squares[sq >> 1] & ~(15 << shift)) | (code << shift));
+    }
+
+    bool operator==(const BoardSnapshot& other) const { return memcmp(this, &other, sizeof(BoardSnapshot)) == 0; }
+    bool operator!=(const BoardSnapshot& other) const { return !(*this == other); }
+};
+
+static_assert(sizeof(BoardSnapshot) == 48, "BoardSnapshot is meant to stay 48 bytes");
+
+#endif // !BOARDSNAPSHOT_H
@@ -1,101 +1,198 @@
-//Qusay Edkymish
-//Dec/1st/2024
-//Header file for the Chess class, handling the main game logic and user interactions.
-
-#ifndef CHESS_H
-#define CHESS_H
-
-#include "ChessBoard.h"		//Manage the chessboard and its pieces.
-#include "Position.h"		//Provides the Position class for piece location.
-#include <string>			//For handling string attributes.
-
-
-/**
- * @class Chess
- * @brief Handles the main game logic and user interactions for the Chess game.
- *
- * The Chess class provides menus, game modes, and utility functions for converting
- * between chess notation and board positions. It serves as the primary interface
- * for running the chess program.
- */
-class Chess
-{
-private:
-	//Instance of ChessBoard to manage the game board and pieces.
-	ChessBoard chessBoard;
-
-public:
-	/**
-	 * @brief Constructor for the Chess class.
-	 *
-	 * Initializes the game and sets up the chessboard.
-	 */
-	Chess();
-
-	/**
-	 * @brief Displays a menu header with the given name.
-	 *
-	 * @param name The name of the menu to display.
-	 */
-	void menuName(const string& name) const;
-
-	/**
-	 * @brief Displays the main menu for the program.
-	 *
-	 * Handles navigation to other menus, such as game mode or about menu.
-	 */
-	void mainMenu();
-
-	/**
-	 * @brief Displays the game menu for starting and playing the game.
-	 */
-	void gameMenu();
-
-	/**
-	 * @brief Displays the about menu with information about the program.
-	 */
-	void aboutMenu();
-
-	/**
-	 * @brief Parses chess notation into a Position object.
-	 *
-	 * Converts strings like "e4" into a corresponding Position on the chessboard.
-	 *
-	 * @param notation The chess notation string to parse (e.g., "e4").
-	 * @return A Position object representing the parsed location.
-	 */
-	Position parseChessNotation(const string& notation) const;
-
-	/**
-	 * @brief Converts a Position object into chess notation.
-	 *
-	 * Converts a board position into a human-readable chess notation string.
-	 *
-	 * @param pos The Position object to convert.
-	 * @return A string representing the chess notation (e.g., "e4").
-	 */
-	string formatChessNotation(const Position& pos) const;
-
-	/**
-	 * @brief Displays the program's header information.
-	 *
-	 * Includes details like the program title and author.
-	 */
-	void displayHeader() const;
-
-	/**
-	 * @brief Starts the Free Play mode.
-	 *
-	 * In this mode, players can move pieces freely without rules enforcement.
-	 */
-	void freePlay();
-
-	/**
-	 * @brief Destructor for the Chess class.
-	 *
-	 * Cleans up resources and finalizes the game.
-	 */
-	~Chess();
-};
-
+//Qusay Edkymish
+//Dec/1st/2024
+//Header file for the Chess class, handling the main game logic and user interactions.
+
+#ifndef CHESS_H
+#define CHESS_H
+
+#include "ChessBoard.h"		//Manage the chessboard and its pieces.
+#include "OpeningBook.h"	//Provides the opening book used by "go" and the move listings.
+#include "Position.h"		//Provides the Position class for piece location.
+#include "Search.h"			//Provides the engine used for analysis commands.
+#include "Tablebase.h"		//Provides the endgame tables probed by the engine.
+#include <algorithm>		//For searching lists of legal moves.
+#include <iostream>			//For script input and output streams.
+#include <limits>			//For discarding invalid input.
+#include <string>			//For handling string attributes.
+
+
+/**
+ * @class Chess
+ * @brief Handles the main game logic and user interactions for the Chess game.
+ *
+ * The Chess class provides menus, game modes, and utility functions for converting
+ * between chess notation and board positions. It serves as the primary interface
+ * for running the chess program.
+ */
+class Chess
+{
+private:
+	//Instance of ChessBoard to manage the game board and pieces.
+	ChessBoard chessBoard;
+
+	//Engine used to analyse the board; keeps its option switches between commands.
+	Search search;
+
+	//Polyglot opening book opened with "book <file>"; "go" plays from it while the game is in book.
+	OpeningBook book;
+
+	//Endgame tables generated or loaded with "tb"; the engine probes them during search.
+	Tablebase tablebase;
+
+	/**
+	 * @brief Gets the legal book moves of the current position.
+	 *
+	 * Book entries that are not legal on the board (a key collision or a
+	 * broken book) are left out. Castling comes from the book as the king's
+	 * two-square move, which ChessBoard::isLegal() accepts, so it is kept.
+	 *
+	 * @return The moves, highest weight first.
+	 */
+	vector<BookMove> legalBookMoves() const;
+
+public:
+	/**
+	 * @brief Reads "go" arguments into search limits.
+	 *
+	 * Without any depth, node or time limit the search is limited to depth 6.
+	 *
+	 * @param args The words after "go".
+	 * @return The parsed limits.
+	 */
+	static SearchLimits parseLimits(istream& args);
+
+	/**
+	 * @brief Constructor for the Chess class.
+	 *
+	 * Initializes the game and sets up the chessboard.
+	 */
+	Chess();
+
+	/**
+	 * @brief Displays a menu header with the given name.
+	 *
+	 * @param name The name of the menu to display.
+	 */
+	void menuName(const string& name) const;
+
+	/**
+	 * @brief Displays the main menu for the program.
+	 *
+	 * Handles navigation to other menus, such as game mode or about menu.
+	 */
+	void mainMenu();
+
+	/**
+	 * @brief Displays the game menu for starting and playing the game.
+	 */
+	void gameMenu();
+
+	/**
+	 * @brief Displays the about menu with information about the program.
+	 */
+	void aboutMenu();
+
+	/**
+	 * @brief Parses chess notation into a Position object.
+	 *
+	 * Converts strings like "e4" into a corresponding Position on the chessboard.
+	 *
+	 * @param notation The chess notation string to parse (e.g., "e4").
+	 * @return A Position object representing the parsed location.
+	 */
+	static Position parseChessNotation(const string& notation);
+
+	/**
+	 * @brief Converts a Position object into chess notation.
+	 *
+	 * Converts a board position into a human-readable chess notation string.
+	 *
+	 * @param pos The Position object to convert.
+	 * @return A string representing the chess notation (e.g., "e4").
+	 */
+	static string formatChessNotation(const Position& pos);
+
+	/**
+	 * @brief Displays the program's header information.
+	 *
+	 * Includes details like the program title and author.
+	 */
+	void displayHeader() const;
+
+	/**
+	 * @brief Starts the Free Play mode.
+	 *
+	 * In this mode, players can move pieces freely without rules enforcement.
+	 */
+	void freePlay();
+
+	/**
+	 * @brief Runs an engine command on the current board.
+	 *
+	 * Supported commands:
+	 * - "fen" prints the board as FEN; "fen <FEN>" loads a position.
+	 * - "go [depth N] [nodes N] [movetime MS] [wtime MS btime MS winc MS binc MS movestogo N]"
+	 *   searches the board and prints the best move; with clock times the
+	 *   engine budgets its own time. While a book is open and the position is
+	 *   in it, a book move is chosen at random by weight instead of searching.
+	 * - "book <file>" opens a Polyglot opening book, "book" lists the book
+	 *   moves of the board with their shares, "book off" closes the book.
+	 * - "perft N" counts the legal move tree to depth N.
+	 * - "set" lists the search options; "set <name> <value>" changes one
+	 *   (switches take on|off, "threads" and "hash" take a number).
+	 * - "bench [depth]" searches the fixed benchmark positions;
+	 *   "bench boards [games]" times setting up and playing Free Play boards;
+	 *   "bench micro [rounds]" times single board operations (path checks, piece moves, rendering, notation);
+	 *   "bench perft [depth]" times perft with the side to move known at run time and at compile time;
+	 *   "bench archive [games]" stores random games in a game archive and reads them back.
+	 * - "hashsave <file>" / "hashload <file>" store and map back the transposition table.
+	 * - "tb gen <material> [threads]" generates an endgame table such as KQK or KBNK
+	 *   (and the smaller ones it needs), "tb load <dir>" maps the tables in a directory,
+	 *   "tb probe" looks the board up and "tb verify <material> [samples] [depth]"
+	 *   checks a table against a brute-force search.
+	 *
+	 * @param command The command word.
+	 * @param arguments The rest of the input line.
+	 * @return True if the command was recognised; otherwise, false.
+	 */
+	bool engineCommand(const string& command, const string& arguments);
+
+	/**
+	 * @brief Runs Free Play commands from a stream without banners, menus or prompts.
+	 *
+	 * Every command gets one JSON response line with its timing in
+	 * microseconds (see respond()); blank lines and lines starting with '#'
+	 * are skipped, and "q" or "quit" ends the script. A final summary line
+	 * gives the command and error counts and the total time.
+	 *
+	 * @param in The commands, one per line (a file or a pipe).
+	 * @param out Where the responses are written.
+	 * @return The number of commands that failed.
+	 */
+	int runScript(istream& in, ostream& out);
+
+	/**
+	 * @brief Runs one Free Play command on a board and builds its JSON response.
+	 *
+	 * Accepts the Free Play inputs ("e2", "e2e4") and "fen", "perft", "go",
+	 * "set" and "reset". The response is one line such as
+	 * {"cmd":"e2e4","ok":true,"piece":"P","fen":"...","us":12}; failures
+	 * carry "ok":false and an "error" text.
+	 *
+	 * @param board The board the command applies to.
+	 * @param engine The engine used by "go" and "set", or nullptr to refuse engine commands.
+	 * @param line The command line.
+	 * @param response Set to the JSON response, without a newline.
+	 * @return True if the command succeeded.
+	 */
+	static bool respond(ChessBoard& board, Search* engine, const string& line, string& response);
+
+	/**
+	 * @brief Destructor for the Chess class.
+	 *
+	 * Cleans up resources and finalizes the game.
+	 */
+	~Chess();
+};
+
 #endif // !CHESS_H
\ No newline at end of file
@@ -1,115 +1,443 @@
-//Qusay Edkymish
-//Nov/17/2024
-//ChessBoard Class: Manages the chessboard and its pieces.
-
-#ifndef CHESSBOARD_H
-#define CHESSBOARD_H
-
-#include "Bishop.h"       //Includes Bishop class for board setup and interactions.
-#include "King.h"         //Includes King class for board setup and interactions.
-#include "Knight.h"       //Includes Kinght class for board setup and interactions.
-#include "Pawn.h"         //Includes Pawn class for board setup and interactions.
-#include "Position.h"     //Includes Position class for piece locations.
-#include "Queen.h"        //Includes Queen class for board setup and interactions.
-#include "Rook.h"         //Includes Rook class for board setup and interactions.
-#include <iomanip>        //Used for formatting board display.  
-#include <iostream>       //Used for input and output operations.
-#include <memory>         //Used for unique pointers to ChessPiece objects.
-#include <vector>         //Used for managing lists of pieces and positions.
-
-using namespace std;
-
-//Forward declaration of ChessPiece
-class ChessPiece;
-
-/**
- * @class ChessBoard
- * @brief Manages the chessboard and its pieces.
- *
- * The ChessBoard class handles the initialization, display, and manipulation
- * of a chessboard. It manages the positions of pieces, validates movements,
- * and provides utilities to check the state of the board.
- */
-class ChessBoard
-{   
-private:
-    static const int SIZE = 8;                      //Board dimensions (8x8)
-    unique_ptr<ChessPiece> board[SIZE][SIZE];       //2D array of unique pointers to ChessPiece objects
-
-public:
-    /**
-     * @brief Constructor for the ChessBoard class.
-     *
-     * Initializes an empty chessboard.
-     */
-    ChessBoard();
-
-    /**
-     * @brief Sets up the initial board configuration.
-     *
-     * Places all pieces (Pawns, Rooks, Knights, Bishops, Queens, and Kings)
-     * in their starting positions.
-     */
-    void initializeBoard();
-
-    /**
-     * @brief Displays the chessboard, optionally highlighting specific positions.
-     *
-     * - Pieces are displayed using their symbols.
-     * - Empty spaces are displayed as '.'.
-     * - Highlighted positions (if provided) are marked with 'x'.
-     *
-     * @param highlightedPositions A vector of positions to highlight (e.g., legal moves). Defaults to an empty vector.
-     */
-    void displayBoard(const std::vector<Position>& highlightedPositions = {}) const;
-
-    /**
-     * @brief Gets the chess piece at a specific position.
-     *
-     * @param row The row index of the position (0-7).
-     * @param col The column index of the position (0-7).
-     * @return A constant pointer to the ChessPiece at the specified position,
-     *         or nullptr if the square is empty.
-     */
-    const ChessPiece* getPieceAt(int row, int col) const;
-
-    /**
-     * @brief Moves a piece from one position to another.
-     *
-     * Updates the board to reflect the move and modifies the piece's position.
-     *
-     * @param from The starting position of the piece.
-     * @param to The target position of the piece.
-     */
-    void movePiece(const Position& from, const Position& to);
-
-    /**
-     * @brief Checks if the path between two positions is clear.
-     *
-     * Validates that no pieces block the path between the starting
-     * and ending positions.
-     *
-     * @param start The starting position of the path.
-     * @param end The ending position of the path.
-     * @return True if the path is clear; otherwise, false.
-     */
-    bool isPathClear(const Position& start, const Position& end) const;
-
-    /**
-     * @brief Displays all legal moves for the piece at a given position.
-     *
-     * Prints the valid moves to the console based on the piece's movement rules.
-     *
-     * @param piecePos The position of the piece to evaluate.
-     */
-    void displayLegalMoves(const Position& piecePos) const;
-
-    /**
-     * @brief Destructor for the Chess class.
-     *
-     * Cleans up resources and finalizes the game.
-     */
-    ~ChessBoard();
-};
-
+//Qusay Edkymish
+//Nov/17/2024
+//ChessBoard Class: Manages the chessboard and its pieces.
+
+#ifndef CHESSBOARD_H
+#define CHESSBOARD_H
+
+#include "AttackMap.h"    //Includes AttackMap class for the squares each side controls.
+#include "Bishop.h"       //Includes Bishop class for board setup and interactions.
+#include "BoardSnapshot.h" //Includes BoardSnapshot struct for exporting and importing positions.
+#include "King.h"         //Includes King class for board setup and interactions.
+#include "Knight.h"       //Includes Kinght class for board setup and interactions.
+#include "Pawn.h"         //Includes Pawn class for board setup and interactions.
+#include "PiecePool.h"    //Includes PiecePool class holding the board's pieces.
+#include "Position.h"     //Includes Position class for piece locations.
+#include "Queen.h"        //Includes Queen class for board setup and interactions.
+#include "Rook.h"         //Includes Rook class for board setup and interactions.
+#include <algorithm>      //Used for general algorithms.
+#include <cstdint>        //Used for the 64-bit highlight mask.
+#include <iomanip>        //Used for formatting board display.  
+#include <iostream>       //Used for input and output operations.
+#include <string>         //Used for FEN text and game state fields.
+#include <vector>         //Used for managing lists of pieces and positions.
+
+using namespace std;
+
+//Forward declaration of ChessPiece
+class ChessPiece;
+
+/**
+ * @class ChessBoard
+ * @brief Manages the chessboard and its pieces.
+ *
+ * The ChessBoard class handles the initialization, display, and manipulation
+ * of a chessboard. It manages the positions of pieces, validates movements,
+ * and provides utilities to check the state of the board.
+ *
+ * Pieces live in a pool inside the board, so creating, resetting or loading
+ * a board never allocates. A board owns its pieces and cannot be copied;
+ * snapshot() and restore() pass a position around as a small value instead.
+ */
+class ChessBoard
+{   
+private:
+    static const int SIZE = 8;                      //Board dimensions (8x8)
+    PiecePool pieces;                               //Storage of the pieces on the board
+    ChessPiece* board[SIZE][SIZE];                  //2D array of pointers into the pool, nullptr for empty squares
+    BoardSnapshot squareCodes;                      //Piece codes of the board in snapshot form, kept in step with it
+    uint64_t pieceBits[12];                         //Squares of each piece code (snapshot code - 1), kept in step with the board
+    uint64_t colorBits[2];                          //Squares of each color's pieces (0 White, 1 Black)
+    uint8_t pieceSquares[12][PiecePool::CAPACITY];  //Squares of each piece code's pieces, in no particular order
+    uint8_t pieceCounts[12];                        //Number of squares in each piece list
+    int8_t listSlot[SIZE * SIZE];                   //Index of each square in its piece's list, -1 for an empty square
+    uint64_t version;                               //Changes whenever a piece moves or the position is replaced
+    mutable uint64_t cachedVersion;                 //Version the move cache was filled for
+    mutable uint64_t moveCache[SIZE * SIZE];        //Target squares of the piece on each square
+    string sideToMove;                              //Color of the side to move ("White" or "Black")
+    string castlingRights;                          //Remaining castling rights in FEN form (e.g., "KQkq" or "-")
+    string enPassantSquare;                         //En passant target in chess notation, or "-"
+    int halfmoveClock;                              //Moves since the last capture or pawn move
+    int fullmoveNumber;                             //Move number, increased after Black moves
+    bool ansiRedraw;                                //Redraw only changed squares in place using ANSI escapes
+    bool heatmap;                                   //Show attacker counts on every square instead of the plain board
+    mutable char lastFrame[SIZE * SIZE];            //Square characters of the last ANSI frame, zero before the first
+
+    /**
+     * @brief Gets the character drawn for a square.
+     *
+     * @param row The row index of the square (0-7).
+     * @param col The column index of the square (0-7).
+     * @param highlightMask Squares to mark with 'x', bit (row * 8 + col).
+     * @return 'x' if highlighted, the piece symbol (lowercase for Black), or '.'.
+     */
+    char squareSymbol(int row, int col, uint64_t highlightMask) const;
+
+    /**
+     * @brief Renders the whole board into one preformatted text buffer.
+     *
+     * @param highlightMask Squares to mark with 'x', bit (row * 8 + col).
+     * @return The board text, nine lines of equal width.
+     */
+    string renderBoard(uint64_t highlightMask) const;
+
+    /**
+     * @brief Renders the ANSI escape sequence that updates the last frame in place.
+     *
+     * The first frame clears the screen, draws the full board at the top and
+     * keeps it there with a scroll region; later frames rewrite only the
+     * squares whose character changed.
+     *
+     * @param highlightMask Squares to mark with 'x', bit (row * 8 + col).
+     * @return The escape sequence and text to write.
+     */
+    string renderAnsiFrame(uint64_t highlightMask) const;
+
+    /**
+     * @brief Renders the board with each square's control balance next to its piece.
+     *
+     * @return The heatmap text: a header line, one line per rank and a legend.
+     */
+    string renderHeatmap() const;
+
+    /**
+     * @brief Creates a piece from its FEN letter in the board's pool.
+     *
+     * @param letter The FEN letter (uppercase for White, lowercase for Black).
+     * @param row The row index of the piece (0-7).
+     * @param col The column index of the piece (0-7).
+     * @return The new piece, or nullptr if the letter is not a piece or the pool is full.
+     */
+    ChessPiece* createPiece(char letter, int row, int col);
+
+    /**
+     * @brief Checks whether a character is a FEN piece letter.
+     */
+    static bool isPieceLetter(char letter);
+
+    /**
+     * @brief Rebuilds the square sets and piece lists from the piece codes.
+     */
+    void rebuildPieceSets();
+
+    /**
+     * @brief Drops castling rights whose king or rook is not on its home square,
+     *        and an en passant square no pawn can just have double-stepped past.
+     */
+    void dropStaleRights();
+
+    /**
+     * @brief Puts a piece code on an empty square, updating the square sets and piece lists.
+     *
+     * @param sq The square (row * 8 + col).
+     * @param code The snapshot code of the piece (1-12).
+     */
+    void placeCode(int sq, int code);
+
+    /**
+     * @brief Removes the piece code from a square, if there is one, in O(1).
+     */
+    void clearCode(int sq);
+
+    /**
+     * @brief Moves the piece code on one square to an empty square.
+     */
+    void shiftCode(int from, int to);
+
+    /**
+     * @brief Gets the squares a piece can move to by its movement rules, ignoring king safety.
+     *
+     * @param square The square of the piece (row * 8 + col).
+     * @return The target squares; 0 for an empty square.
+     */
+    uint64_t reachableSquares(int square) const;
+
+    /**
+     * @brief Checks that moving the piece on a square does not leave its own king attacked.
+     */
+    bool keepsKingSafe(int fromSquare, int toSquare) const;
+
+    /**
+     * @brief Checks whether any piece of a color attacks a square.
+     */
+    bool isAttacked(int square, int byColor) const;
+
+    /**
+     * @brief Gets the squares the king on a square can castle to.
+     *
+     * @param square The square of the king (row * 8 + col).
+     * @return The king's target squares for each castling allowed now; 0 if none.
+     */
+    uint64_t castlingSquares(int square) const;
+
+    /**
+     * @brief Gets the en passant target as a square set if pawns of a color could capture onto it.
+     */
+    uint64_t enPassantSquares(int color) const;
+
+    /**
+     * @brief Adds the king-safe moves of one kind of pawn move to the move cache.
+     *
+     * @param targets The target squares of the move kind for all pawns of one color.
+     * @param delta The offset from each origin square to its target.
+     */
+    void cachePawnMoves(uint64_t targets, int delta) const;
+
+    /**
+     * @brief Adds the king-safe moves of every piece of one type, both colors, to the move cache.
+     *
+     * @param type The piece type, KNIGHT to KING.
+     */
+    void cachePieceMoves(int type) const;
+
+    /**
+     * @brief Fills the move cache for every piece on the board in one pass.
+     */
+    void fillMoveCache() const;
+
+    /**
+     * @brief Displays the chessboard with the squares of a mask highlighted.
+     *
+     * @param highlightMask Squares to mark with 'x', bit (row * 8 + col).
+     */
+    void displayMask(uint64_t highlightMask) const;
+
+public:
+    /**
+     * @brief Constructor for the ChessBoard class.
+     *
+     * Initializes an empty chessboard.
+     */
+    ChessBoard();
+
+    ChessBoard(const ChessBoard&) = delete;
+    ChessBoard& operator=(const ChessBoard&) = delete;
+
+    /**
+     * @brief Sets up the initial board configuration.
+     *
+     * Places all pieces (Pawns, Rooks, Knights, Bishops, Queens, and Kings)
+     * for both sides in their starting positions and resets the game state.
+     * The pool is emptied in one step rather than piece by piece.
+     */
+    void initializeBoard();
+
+    /**
+     * @brief Displays the chessboard, optionally highlighting specific positions.
+     *
+     * - Pieces are displayed using their symbols (lowercase for Black).
+     * - Empty spaces are displayed as '.'.
+     * - Highlighted positions (if provided) are marked with 'x'.
+     *
+     * The board is rendered into one buffer and written at once. In ANSI
+     * redraw mode only the squares that changed since the last frame are sent.
+     *
+     * @param highlightedPositions A vector of positions to highlight (e.g., legal moves). Defaults to an empty vector.
+     */
+    void displayBoard(const std::vector<Position>& highlightedPositions = {}) const;
+
+    /**
+     * @brief Turns in-place ANSI redrawing on or off.
+     *
+     * Turning it on forces a full redraw on the next frame; turning it off
+     * gives the whole terminal back to normal scrolling output.
+     *
+     * @param enabled True to redraw in place, false for plain output.
+     */
+    void setAnsiRedraw(bool enabled);
+
+    /**
+     * @brief Turns the heatmap display on or off.
+     *
+     * While it is on, displayBoard() shows next to every square how many
+     * more White pieces than Black pieces attack it (negative when Black
+     * controls it). Highlighted moves are still shown on the plain board.
+     *
+     * @param enabled True to show the heatmap, false for the plain board.
+     */
+    void setHeatmap(bool enabled);
+
+    /**
+     * @brief Gets the squares each side attacks and the attacker counts of every square.
+     *
+     * Built in one set-wise pass over the board, the same way the engine's
+     * evaluation builds it.
+     *
+     * @return The attack map of the current position.
+     */
+    AttackMap getAttackMap() const;
+
+    /**
+     * @brief Gets the chess piece at a specific position.
+     *
+     * @param row The row index of the position (0-7).
+     * @param col The column index of the position (0-7).
+     * @return A constant pointer to the ChessPiece at the specified position,
+     *         or nullptr if the square is empty.
+     */
+    const ChessPiece* getPieceAt(int row, int col) const;
+
+    /**
+     * @brief Moves a piece from one position to another.
+     *
+     * Updates the board to reflect the move and modifies the piece's position.
+     * Also updates the side to move, castling rights, en passant square and
+     * move counters. A pawn moving diagonally onto the en passant square
+     * removes the pawn it passed, a pawn reaching the last row is promoted,
+     * and a king moving two squares along its row brings the rook across.
+     *
+     * @param from The starting position of the piece.
+     * @param to The target position of the piece.
+     * @param promotion The piece a promoting pawn becomes ('Q', 'R', 'B' or 'N'); anything else gives a queen.
+     */
+    void movePiece(const Position& from, const Position& to, char promotion = 'Q');
+
+    /**
+     * @brief Checks a move without generating any move list.
+     *
+     * The piece must belong to the side to move and move by its rules as in
+     * getLegalMoves(): a table lookup for knights, kings and pawn captures,
+     * and a between-squares mask for the path of sliders and pawn double
+     * steps. The move must also not leave the mover's own king attacked, so
+     * pinned pieces and moves that ignore a check are refused. Castling is
+     * written as the king's two-square move (e1g1) and needs the right, the
+     * rook on its corner, empty squares between them, and a king that is not
+     * in check and does not pass through or land on an attacked square.
+     *
+     * @param from The starting position of the piece.
+     * @param to The target position.
+     * @return True if the move may be played; otherwise, false.
+     */
+    bool isLegal(const Position& from, const Position& to) const;
+
+    /**
+     * @brief Gets the number of pieces of one color and type.
+     *
+     * @param color WHITE or BLACK.
+     * @param type PAWN through KING.
+     */
+    int getPieceCount(int color, int type) const;
+
+    /**
+     * @brief Gets the squares of the pieces of one color and type.
+     *
+     * The list is kept up to date by every move, so walking all pieces of a
+     * side visits at most 16 entries instead of 64 squares. The order
+     * changes as pieces are captured.
+     *
+     * @param color WHITE or BLACK.
+     * @param type PAWN through KING.
+     * @return getPieceCount(color, type) squares (row * 8 + col); valid until the board changes.
+     */
+    const uint8_t* getPieceSquares(int color, int type) const;
+
+    /**
+     * @brief Gets the board version.
+     *
+     * @return A number that changes whenever a piece moves or the position is replaced.
+     */
+    uint64_t getVersion() const;
+
+    /**
+     * @brief Gets the squares the piece on a square can move to.
+     *
+     * Moves follow the piece's rules and never leave its own king attacked,
+     * whichever side is to move. All pieces are worked out together on the
+     * first query after the board changes and kept until the version moves
+     * on, so repeated queries cost a lookup. Not safe to call from several
+     * threads on the same board.
+     *
+     * @param row The row index of the piece (0-7).
+     * @param col The column index of the piece (0-7).
+     * @return The target squares, bit (row * 8 + col); 0 for an empty square.
+     */
+    uint64_t getMoveTargets(int row, int col) const;
+
+    /**
+     * @brief Gets the moves of the piece on a square as positions, from the move cache.
+     *
+     * @param piecePos The position of the piece.
+     * @return The target positions, nearest White's side of the board first.
+     */
+    vector<Position> getMovesFrom(const Position& piecePos) const;
+
+    /**
+     * @brief Checks if the path between two positions is clear.
+     *
+     * Validates that no pieces block the path between the starting
+     * and ending positions.
+     *
+     * @param start The starting position of the path.
+     * @param end The ending position of the path.
+     * @return True if the path is clear; otherwise, false.
+     */
+    bool isPathClear(const Position& start, const Position& end) const;
+
+    /**
+     * @brief Displays all legal moves for the piece at a given position.
+     *
+     * Prints the valid moves to the console based on the piece's movement rules.
+     *
+     * @param piecePos The position of the piece to evaluate.
+     */
+    void displayLegalMoves(const Position& piecePos) const;
+
+    /**
+     * @brief Writes the board and game state as a FEN string.
+     *
+     * Row 0 of the board is the eighth rank, so rows are written in order.
+     *
+     * @return The FEN text (e.g., "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1").
+     */
+    string toFen() const;
+
+    /**
+     * @brief Replaces the board and game state with a FEN position.
+     *
+     * @param fen The FEN text to load. The move counters may be omitted.
+     * @return True if the FEN was valid; on failure the board is left unchanged.
+     *         More than 32 pieces is rejected.
+     */
+    bool loadFen(const string& fen);
+
+    /**
+     * @brief Copies the board and game state into a compact snapshot.
+     *
+     * The snapshot can be copied to other threads or kept for a side line
+     * while this board carries on.
+     *
+     * @return The snapshot, hashed as EngineBoard would hash it.
+     */
+    BoardSnapshot snapshot() const;
+
+    /**
+     * @brief Replaces the board and game state with a snapshot.
+     *
+     * @param snap The snapshot to load.
+     * @return True if the snapshot was valid; on failure the board is left unchanged.
+     */
+    bool restore(const BoardSnapshot& snap);
+
+    /**
+     * @brief Gets the square an en passant capture would land on.
+     *
+     * @return The square (row * 8 + col), or NO_SQUARE if there is none.
+     */
+    int enPassantTarget() const;
+
+    /**
+     * @brief Gets the color of the side to move.
+     *
+     * @return "White" or "Black".
+     */
+    string getSideToMove() const;
+
+    /**
+     * @brief Destructor for the Chess class.
+     *
+     * Cleans up resources and finalizes the game.
+     */
+    ~ChessBoard();
+};
+
 #endif // !CHESSBOARD_H
\ No newline at end of file
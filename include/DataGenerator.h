@@ -0,0 +1,77 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Header file for the DataGenerator class, self-play games that write labelled training positions.
+
+#ifndef DATAGENERATOR_H
+#define DATAGENERATOR_H
+
+#include "EngineBoard.h"    //Provides the boards the games are played on.
+#include "PackedPosition.h" //Provides the record format.
+#include "Search.h"         //Provides the engine.
+#include <cstdint>          //Provides fixed-width integer types.
+#include <iostream>         //For the progress report.
+#include <string>           //For the output path.
+#include <vector>           //For the recorded positions of a game.
+
+using namespace std;
+
+/**
+ * @class DataGenerator
+ * @brief Plays fast self-play games on every core and writes their quiet positions as training data.
+ *
+ * Each game starts with a few random moves from the start position and is
+ * then played by the engine with a small node budget per move. Positions
+ * where the side to move is not in check and the engine's move is neither
+ * a capture nor a promotion are kept with the search score; once the game
+ * is over they get its result and go into the thread's buffer. A full
+ * buffer is written in one call at file space reserved with an atomic
+ * counter, so threads never wait for each other. The output is a flat
+ * file of PackedPosition records.
+ */
+class DataGenerator
+{
+public:
+    /**
+     * @struct Options
+     * @brief Generation settings.
+     */
+    struct Options
+    {
+        string output;                  //File the records are written to
+        uint64_t positions = 1000000;   //Records to write
+        uint64_t nodes = 5000;          //Node limit per move
+        int depth = 0;                  //Depth limit per move, 0 for none
+        int threads = 0;                //Game threads, 0 for one per core
+        int randomPlies = 8;            //Random moves at the start of each game
+        uint64_t seed = 0;              //Random seed, 0 to seed from the clock
+    };
+
+    /**
+     * @brief Plays one game and collects its training positions.
+     *
+     * The game ends in mate, stalemate or a draw by the rules, or by
+     * adjudication: a win once the engine has given one side at least 1500
+     * centipawns for six plies in a row, a draw after 400 plies. Games whose
+     * opening leaves one side more than 300 centipawns ahead are dropped.
+     *
+     * @param engine The engine playing both sides.
+     * @param limits The search limits of every move.
+     * @param randomPlies Random moves played before the engine takes over.
+     * @param seed The xorshift state for the random moves; advanced.
+     * @param records Set to the game's quiet positions with their scores and result.
+     * @return False if the game was dropped.
+     */
+    static bool playGame(Search& engine, const SearchLimits& limits, int randomPlies, uint64_t& seed,
+        vector<PackedPosition>& records);
+
+    /**
+     * @brief Generates a data file and writes a progress line every few seconds.
+     *
+     * @param options The output, size, limits and threads.
+     * @param out Where the progress and summary are written.
+     * @return 0 once the file is written, 1 if it cannot be created or written.
+     */
+    static int run(const Options& options, ostream& out);
+};
+
+#endif // !DATAGENERATOR_H
@@ -0,0 +1,322 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Header file for the EngineBoard class, the bitboard position used by the search.
+
+#ifndef ENGINEBOARD_H
+#define ENGINEBOARD_H
+
+#include "Bitboard.h"   //Provides square sets, attack tables and piece enums.
+#include "BoardSnapshot.h" //Provides the compact position copy.
+#include "Move.h"       //Provides the packed Move type and MoveList.
+#include <cstdint>      //Provides fixed-width integer types.
+#include <string>       //For FEN strings and move text.
+#include <vector>       //For the undo history stack.
+
+using namespace std;
+
+//Castling right bits
+const int WHITE_KINGSIDE = 1;
+const int WHITE_QUEENSIDE = 2;
+const int BLACK_KINGSIDE = 4;
+const int BLACK_QUEENSIDE = 8;
+
+//Kinds of pseudo-legal move generation, chosen at compile time
+enum GenType { GEN_ALL, GEN_CAPTURES };
+
+/**
+ * @class EngineBoard
+ * @brief A complete chess position with fast make/unmake for searching.
+ *
+ * Where ChessBoard owns one object per piece for the interactive game,
+ * EngineBoard keeps one bitboard per piece kind plus a square-to-piece
+ * table, and tracks everything the rules need (side to move, castling
+ * rights, en passant square, move clocks and a Zobrist hash). Positions
+ * are exchanged with ChessBoard through FEN strings.
+ */
+class EngineBoard
+{
+private:
+    /**
+     * @struct StateInfo
+     * @brief Everything makeMove() overwrites that unmakeMove() must restore.
+     */
+    struct StateInfo
+    {
+        Move move;              //The move that was made (null for a null move)
+        int captured;           //Piece code captured by the move, or NO_PIECE
+        int castling;           //Castling rights before the move
+        int epSquare;           //En passant square before the move
+        int halfmoveClock;      //Fifty-move counter before the move
+        uint64_t hash;          //Hash before the move
+    };
+
+    uint64_t pieceBB[12];       //One bitboard per colored piece code
+    uint64_t colorBB[2];        //All pieces of each color
+    uint64_t occupiedBB;        //All pieces
+    int mailbox[64];            //Piece code on each square, or NO_PIECE
+    int side;                   //Side to move (WHITE or BLACK)
+    int castling;               //Castling right bits
+    int epSquare;               //En passant target square, or NO_SQUARE
+    int halfmoveClock;          //Plies since the last capture or pawn move
+    int fullmoveNumber;         //Move number as written in FEN
+    uint64_t hash;              //Zobrist hash of the position
+    vector<StateInfo> history;  //Undo stack, one entry per made move
+
+    void putPiece(int piece, int sq);
+    void removePiece(int sq);
+    void shiftPiece(int from, int to);
+
+    /**
+     * @brief Recomputes the hash from scratch.
+     */
+    uint64_t computeHash() const;
+
+    /**
+     * @brief Checks a piece placement: one king per side and no pawns on the back ranks.
+     */
+    static bool validPlacement(const int squares[64]);
+
+    /**
+     * @brief Replaces the position with a checked placement and state.
+     *
+     * Castling rights without their king and rook at home and an en passant
+     * square no pawn could have just passed are dropped.
+     */
+    void setPosition(const int squares[64], int sideToMove, int rights, int ep, int halfmove, int fullmove);
+
+    /**
+     * @brief Adds the pawn moves of one side, all pawns at once.
+     *
+     * @tparam US The side to move.
+     * @tparam TYPE GEN_CAPTURES for captures, en passant and queen promotions only.
+     * @param list The list to add to.
+     */
+    template <int US, GenType TYPE>
+    void generatePawnMoves(MoveList& list) const;
+
+    /**
+     * @brief Adds the pseudo-legal moves of one side of one kind.
+     *
+     * @tparam US The side to move.
+     * @tparam TYPE GEN_ALL for every move, GEN_CAPTURES for the quiescence moves.
+     * @param list The list to add to.
+     */
+    template <int US, GenType TYPE>
+    void generate(MoveList& list) const;
+
+    /**
+     * @brief Checks that an en passant capture does not expose the mover's king.
+     *
+     * Both pawns leave the capture row at once, so a rook or queen on that
+     * row can see the king through the gap even though neither pawn is
+     * pinned on its own. Only valid when the side to move is not in check.
+     *
+     * @param from The square of the capturing pawn.
+     */
+    bool enPassantKeepsKingSafe(int from) const;
+
+public:
+    //Seed for the Zobrist key generator. Hash values depend on it, so it is
+    //part of any data that stores hashes.
+    static const uint64_t ZOBRIST_SEED = 0x9E3779B97F4A7C15ULL;
+
+    //FEN of the standard starting position
+    static const char* const START_FEN;
+
+    /**
+     * @brief Constructs a board set to the standard starting position.
+     */
+    EngineBoard();
+
+    /**
+     * @brief Resets the board to the standard starting position.
+     */
+    void setStartPosition();
+
+    /**
+     * @brief Loads a position from a FEN string.
+     *
+     * @param fen The FEN text. The move clocks may be omitted.
+     * @return True if the FEN was valid; on failure the board is left unchanged.
+     */
+    bool loadFen(const string& fen);
+
+    /**
+     * @brief Writes the position as a FEN string.
+     */
+    string toFen() const;
+
+    /**
+     * @brief Copies the position into a snapshot.
+     *
+     * The undo history is not part of it, so repetitions before the
+     * snapshot are not seen by a board loaded from it.
+     */
+    BoardSnapshot snapshot() const;
+
+    /**
+     * @brief Loads a position from a snapshot, without going through FEN.
+     *
+     * @param snap The snapshot to load.
+     * @return True if the snapshot holds a position the engine accepts;
+     *         on failure the board is left unchanged.
+     */
+    bool loadSnapshot(const BoardSnapshot& snap);
+
+    /**
+     * @brief Computes the Zobrist hash a snapshot's position has on an EngineBoard.
+     *
+     * Castling and en passant are hashed as stored, so the snapshot should
+     * already hold only rights and squares that apply.
+     */
+    static uint64_t snapshotHash(const BoardSnapshot& snap);
+
+    int pieceAt(int sq) const { return mailbox[sq]; }
+    uint64_t pieces(int color, int type) const { return pieceBB[color * 6 + type]; }
+    uint64_t pieces(int color) const { return colorBB[color]; }
+    uint64_t occupancy() const { return occupiedBB; }
+    int sideToMove() const { return side; }
+    int castlingRights() const { return castling; }
+    int enPassantSquare() const { return epSquare; }
+    int getHalfmoveClock() const { return halfmoveClock; }
+    int getFullmoveNumber() const { return fullmoveNumber; }
+    uint64_t getHash() const { return hash; }
+    int kingSquare(int color) const { return Bitboards::lsb(pieceBB[color * 6 + KING]); }
+
+    /**
+     * @brief Gets the number of moves made since the position was loaded.
+     */
+    int gamePly() const { return static_cast<int>(history.size()); }
+
+    /**
+     * @brief Gets the move made at a given ply of the history.
+     */
+    Move moveAt(int ply) const { return history[ply].move; }
+
+    /**
+     * @brief Returns all pieces of either color that attack a square.
+     *
+     * @param sq The square to test.
+     * @param occupied The occupancy to use for sliding pieces.
+     */
+    uint64_t attackersTo(int sq, uint64_t occupied) const;
+
+    /**
+     * @brief Checks whether a square is attacked by the given color.
+     */
+    bool isSquareAttacked(int sq, int byColor) const;
+
+    /**
+     * @brief Checks whether the side to move is in check.
+     */
+    bool inCheck() const { return isSquareAttacked(kingSquare(side), side ^ 1); }
+
+    /**
+     * @brief Generates all pseudo-legal moves for the side to move.
+     *
+     * Moves may leave the king in check; makeMove() rejects those.
+     */
+    void generateMoves(MoveList& list) const;
+
+    /**
+     * @brief Generates captures and queen promotions for quiescence search.
+     */
+    void generateCaptures(MoveList& list) const;
+
+    /**
+     * @brief Side-specific versions of the generators, for callers that already know the side to move.
+     *
+     * generateMoves() and generateCaptures() pick the instance for the side
+     * to move; a caller that alternates sides itself (the quiescence search,
+     * perft) can call the instance directly. US must be the side to move.
+     */
+    template <int US>
+    void generateMoves(MoveList& list) const;
+
+    template <int US>
+    void generateCaptures(MoveList& list) const;
+
+    /**
+     * @brief Finds the pieces of a color that may be pinned to their king.
+     *
+     * Every truly pinned piece is included; a piece shielding its king from
+     * a slider along a line is counted even if another piece also blocks.
+     */
+    uint64_t pinnedPieces(int color) const;
+
+    /**
+     * @brief Generates only the fully legal moves.
+     */
+    void generateLegalMoves(MoveList& list);
+
+    /**
+     * @brief Plays a pseudo-legal move.
+     *
+     * @param m The move to play.
+     * @return False (with the board unchanged) if the move leaves the mover's king in check.
+     */
+    bool makeMove(Move m);
+
+    /**
+     * @brief Takes back the last move made with makeMove().
+     */
+    void unmakeMove();
+
+    /**
+     * @brief Side-specific versions of makeMove() and unmakeMove().
+     *
+     * US is the side making the move, and the side that made the move being
+     * taken back; the pawn direction, promotion piece codes and castling
+     * squares are then constants.
+     */
+    template <int US>
+    bool makeMove(Move m);
+
+    template <int US>
+    void unmakeMove();
+
+    /**
+     * @brief Passes the turn without moving (used by null-move pruning).
+     */
+    void makeNullMove();
+
+    /**
+     * @brief Takes back the last null move.
+     */
+    void unmakeNullMove();
+
+    /**
+     * @brief Checks whether the position repeats an earlier one since the last irreversible move.
+     */
+    bool isRepetition() const;
+
+    /**
+     * @brief Checks for draws by repetition, the fifty-move rule or insufficient material.
+     */
+    bool isDraw() const;
+
+    /**
+     * @brief Sums the material of a side's knights, bishops, rooks and queens in centipawns.
+     */
+    int nonPawnMaterial(int color) const;
+
+    /**
+     * @brief Counts leaf nodes of the legal move tree to a fixed depth.
+     */
+    uint64_t perft(int depth);
+
+    /**
+     * @brief Counts leaf nodes with the given side to move, without run-time side checks.
+     */
+    template <int US>
+    uint64_t perft(int depth);
+
+    /**
+     * @brief Finds the legal move matching coordinate notation (e.g., "e2e4", "e7e8q").
+     *
+     * @return The move, or the null move if the text does not name a legal move.
+     */
+    Move parseMove(const string& text);
+};
+
+#endif // !ENGINEBOARD_H
@@ -0,0 +1,152 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Header file for the evaluation weights, compiled into Evaluation.cpp and rewritten by the Tuner class.
+
+#ifndef EVALWEIGHTS_H
+#define EVALWEIGHTS_H
+
+//Source: hand-set values
+
+//Material in the middlegame and endgame, indexed by piece type
+static const int MG_VALUE[6] = { 100, 320, 330, 500, 900, 0 };
+static const int EG_VALUE[6] = { 120, 300, 320, 520, 940, 0 };
+
+//Piece-square tables written from White's side with the eighth rank first,
+//so they are indexed directly by square for White and by (square ^ 56) for Black.
+static const int MG_PST[6][64] =
+{
+    {   //Pawn
+           0,    0,    0,    0,    0,    0,    0,    0,
+          50,   50,   50,   50,   50,   50,   50,   50,
+          10,   10,   20,   30,   30,   20,   10,   10,
+           5,    5,   10,   25,   25,   10,    5,    5,
+           0,    0,    0,   20,   20,    0,    0,    0,
+           5,   -5,  -10,    0,    0,  -10,   -5,    5,
+           5,   10,   10,  -20,  -20,   10,   10,    5,
+           0,    0,    0,    0,    0,    0,    0,    0
+    },
+    {   //Knight
+         -50,  -40,  -30,  -30,  -30,  -30,  -40,  -50,
+         -40,  -20,    0,    0,    0,    0,  -20,  -40,
+         -30,    0,   10,   15,   15,   10,    0,  -30,
+         -30,    5,   15,   20,   20,   15,    5,  -30,
+         -30,    0,   15,   20,   20,   15,    0,  -30,
+         -30,    5,   10,   15,   15,   10,    5,  -30,
+         -40,  -20,    0,    5,    5,    0,  -20,  -40,
+         -50,  -40,  -30,  -30,  -30,  -30,  -40,  -50
+    },
+    {   //Bishop
+         -20,  -10,  -10,  -10,  -10,  -10,  -10,  -20,
+         -10,    0,    0,    0,    0,    0,    0,  -10,
+         -10,    0,    5,   10,   10,    5,    0,  -10,
+         -10,    5,    5,   10,   10,    5,    5,  -10,
+         -10,    0,   10,   10,   10,   10,    0,  -10,
+         -10,   10,   10,   10,   10,   10,   10,  -10,
+         -10,    5,    0,    0,    0,    0,    5,  -10,
+         -20,  -10,  -10,  -10,  -10,  -10,  -10,  -20
+    },
+    {   //Rook
+           0,    0,    0,    0,    0,    0,    0,    0,
+           5,   10,   10,   10,   10,   10,   10,    5,
+          -5,    0,    0,    0,    0,    0,    0,   -5,
+          -5,    0,    0,    0,    0,    0,    0,   -5,
+          -5,    0,    0,    0,    0,    0,    0,   -5,
+          -5,    0,    0,    0,    0,    0,    0,   -5,
+          -5,    0,    0,    0,    0,    0,    0,   -5,
+           0,    0,    0,    5,    5,    0,    0,    0
+    },
+    {   //Queen
+         -20,  -10,  -10,   -5,   -5,  -10,  -10,  -20,
+         -10,    0,    0,    0,    0,    0,    0,  -10,
+         -10,    0,    5,    5,    5,    5,    0,  -10,
+          -5,    0,    5,    5,    5,    5,    0,   -5,
+           0,    0,    5,    5,    5,    5,    0,   -5,
+         -10,    5,    5,    5,    5,    5,    0,  -10,
+         -10,    0,    5,    0,    0,    0,    0,  -10,
+         -20,  -10,  -10,   -5,   -5,  -10,  -10,  -20
+    },
+    {   //King
+         -30,  -40,  -40,  -50,  -50,  -40,  -40,  -30,
+         -30,  -40,  -40,  -50,  -50,  -40,  -40,  -30,
+         -30,  -40,  -40,  -50,  -50,  -40,  -40,  -30,
+         -30,  -40,  -40,  -50,  -50,  -40,  -40,  -30,
+         -20,  -30,  -30,  -40,  -40,  -30,  -30,  -20,
+         -10,  -20,  -20,  -20,  -20,  -20,  -20,  -10,
+          20,   20,    0,    0,    0,    0,   20,   20,
+          20,   30,   10,    0,    0,   10,   30,   20
+    }
+};
+
+static const int EG_PST[6][64] =
+{
+    {   //Pawn
+           0,    0,    0,    0,    0,    0,    0,    0,
+          80,   80,   80,   80,   80,   80,   80,   80,
+          50,   50,   50,   50,   50,   50,   50,   50,
+          30,   30,   30,   30,   30,   30,   30,   30,
+          15,   15,   15,   15,   15,   15,   15,   15,
+           5,    5,    5,    5,    5,    5,    5,    5,
+           0,    0,    0,    0,    0,    0,    0,    0,
+           0,    0,    0,    0,    0,    0,    0,    0
+    },
+    {   //Knight
+         -50,  -40,  -30,  -30,  -30,  -30,  -40,  -50,
+         -40,  -20,    0,    0,    0,    0,  -20,  -40,
+         -30,    0,   10,   15,   15,   10,    0,  -30,
+         -30,    5,   15,   20,   20,   15,    5,  -30,
+         -30,    0,   15,   20,   20,   15,    0,  -30,
+         -30,    5,   10,   15,   15,   10,    5,  -30,
+         -40,  -20,    0,    5,    5,    0,  -20,  -40,
+         -50,  -40,  -30,  -30,  -30,  -30,  -40,  -50
+    },
+    {   //Bishop
+         -20,  -10,  -10,  -10,  -10,  -10,  -10,  -20,
+         -10,    0,    0,    0,    0,    0,    0,  -10,
+         -10,    0,    5,   10,   10,    5,    0,  -10,
+         -10,    5,    5,   10,   10,    5,    5,  -10,
+         -10,    0,   10,   10,   10,   10,    0,  -10,
+         -10,   10,   10,   10,   10,   10,   10,  -10,
+         -10,    5,    0,    0,    0,    0,    5,  -10,
+         -20,  -10,  -10,  -10,  -10,  -10,  -10,  -20
+    },
+    {   //Rook
+           0,    0,    0,    0,    0,    0,    0,    0,
+           5,   10,   10,   10,   10,   10,   10,    5,
+          -5,    0,    0,    0,    0,    0,    0,   -5,
+          -5,    0,    0,    0,    0,    0,    0,   -5,
+          -5,    0,    0,    0,    0,    0,    0,   -5,
+          -5,    0,    0,    0,    0,    0,    0,   -5,
+          -5,    0,    0,    0,    0,    0,    0,   -5,
+           0,    0,    0,    5,    5,    0,    0,    0
+    },
+    {   //Queen
+         -20,  -10,  -10,   -5,   -5,  -10,  -10,  -20,
+         -10,    0,    0,    0,    0,    0,    0,  -10,
+         -10,    0,    5,    5,    5,    5,    0,  -10,
+          -5,    0,    5,    5,    5,    5,    0,   -5,
+           0,    0,    5,    5,    5,    5,    0,   -5,
+         -10,    5,    5,    5,    5,    5,    0,  -10,
+         -10,    0,    5,    0,    0,    0,    0,  -10,
+         -20,  -10,  -10,   -5,   -5,  -10,  -10,  -20
+    },
+    {   //King
+         -50,  -40,  -30,  -20,  -20,  -30,  -40,  -50,
+         -30,  -20,  -10,    0,    0,  -10,  -20,  -30,
+         -30,  -10,   20,   30,   30,   20,  -10,  -30,
+         -30,  -10,   30,   40,   40,   30,  -10,  -30,
+         -30,  -10,   30,   40,   40,   30,  -10,  -30,
+         -30,  -10,   20,   30,   30,   20,  -10,  -30,
+         -30,  -30,    0,    0,    0,    0,  -30,  -30,
+         -50,  -30,  -30,  -30,  -30,  -30,  -30,  -50
+    }
+};
+
+//Bonus for owning both bishops
+static const int BISHOP_PAIR_MG = 30;
+static const int BISHOP_PAIR_EG = 50;
+
+//Bonus per safe square a piece type reaches (not own pieces, not attacked by enemy pawns)
+static const int MOBILITY_MG[6] = { 0, 4, 5, 2, 1, 0 };
+static const int MOBILITY_EG[6] = { 0, 4, 5, 4, 2, 0 };
+
+#endif // !EVALWEIGHTS_H
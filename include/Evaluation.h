@@ -0,0 +1,59 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Header file for the Evaluation class, the static position evaluator used by the search.
+
+#ifndef EVALUATION_H
+#define EVALUATION_H
+
+#include "EngineBoard.h"    //Provides the position being evaluated.
+
+/**
+ * @struct EvalTrace
+ * @brief The terms of one evaluation that cannot be read off the piece placement.
+ *
+ * Filled by the tracing evaluate() so the tuner sees exactly what the
+ * evaluation counted. Material and piece-square terms follow from the
+ * pieces themselves.
+ */
+struct EvalTrace
+{
+    int phase = 0;              //Game phase from 0 (no pieces) to 24 (the full set), as blended
+    int bishopPair[2] = {};     //1 if the color, by Color, owns both bishops
+    int mobility[2][6] = {};    //Safe squares reached by each color's pieces of each type
+    int kingDanger[2] = {};     //Middlegame king safety penalty of each color; not tuned
+};
+
+/**
+ * @class Evaluation
+ * @brief Scores a position in centipawns from the side to move's point of view.
+ *
+ * The score blends a middlegame and an endgame term (material,
+ * piece-square tables, mobility and king safety) by the amount of non-pawn
+ * material left on the board. The weights live in EvalWeights.h, which
+ * the Tuner class rewrites.
+ */
+class Evaluation
+{
+public:
+    //Centipawn value of each piece type, used for move ordering and pruning margins
+    static const int PIECE_VALUE[6];
+
+    /**
+     * @brief Evaluates a position.
+     *
+     * @param board The position to evaluate.
+     * @return The score in centipawns; positive favours the side to move.
+     */
+    static int evaluate(const EngineBoard& board);
+
+    /**
+     * @brief Evaluates a position and records the terms the tuner needs.
+     *
+     * @param board The position to evaluate.
+     * @param trace Set to the position's terms.
+     * @return The same score as evaluate(board).
+     */
+    static int evaluate(const EngineBoard& board, EvalTrace& trace);
+};
+
+#endif // !EVALUATION_H
@@ -0,0 +1,169 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Header file for the GameArchive class, a compact file of finished games.
+
+#ifndef GAMEARCHIVE_H
+#define GAMEARCHIVE_H
+
+#include "BoardSnapshot.h"  //Provides the starting position of a game.
+#include "EngineBoard.h"    //Provides the move generator used to code moves.
+#include "Move.h"           //Provides the Move type.
+#include <cstdint>          //Provides fixed-width integer types.
+#include <fstream>          //For streaming the archive file.
+#include <string>           //For paths, payloads and error text.
+#include <vector>           //For move lists and the offset index.
+
+using namespace std;
+
+/**
+ * @class GameArchive
+ * @brief Stores many games in a small binary file with random access by game number.
+ *
+ * Each move is stored as its index in the legal move list of its position,
+ * range coded with every legal move equally likely. A typical game costs
+ * well under one byte per move, a forced move costs nothing, and decoding
+ * replays the game through the move generator.
+ *
+ * File layout: a 16-byte file header, then each game as an 8-byte game
+ * header, the start position as a BoardSnapshot if it is not the standard
+ * one, and the coded moves. An index of 8-byte game offsets and a 16-byte
+ * trailer (index offset, game count) close the file, so game N is found
+ * with one lookup. Games are written and read one at a time, so neither
+ * side has to hold more than one game in memory.
+ */
+class GameArchive
+{
+public:
+    //Game results
+    enum Result { RESULT_UNKNOWN = 0, WHITE_WINS = 1, BLACK_WINS = 2, DRAWN = 3 };
+
+    /**
+     * @struct Game
+     * @brief One game: its start position, its moves and its result.
+     */
+    struct Game
+    {
+        BoardSnapshot start = {};           //Start position; all zero for the standard one
+        vector<Move> moves;                 //Moves in the order played
+        int result = RESULT_UNKNOWN;        //One of Result
+    };
+
+    /**
+     * @brief Codes a game's moves as legal move indices.
+     *
+     * @param game The game to code.
+     * @param board Scratch board used to replay the game.
+     * @param payload Set to the coded moves.
+     * @return False if a move is not legal in its position or the start position is not valid.
+     */
+    static bool encode(const Game& game, EngineBoard& board, string& payload);
+
+    /**
+     * @brief Replays coded moves through the move generator.
+     *
+     * @param payload The coded moves.
+     * @param plies The number of moves to decode.
+     * @param board Set to the game's start position on entry; left at its final position.
+     * @param moves Set to the decoded moves.
+     * @return False if the data does not describe legal moves.
+     */
+    static bool decode(const string& payload, int plies, EngineBoard& board, vector<Move>& moves);
+
+    /**
+     * @class Writer
+     * @brief Streams games into a new archive file.
+     */
+    class Writer
+    {
+    private:
+        ofstream file;                  //The archive being written
+        vector<uint64_t> offsets;       //File offset of every game written so far
+        uint64_t position;              //Current file offset
+        EngineBoard board;              //Scratch board for coding moves
+        string payload;                 //Coded moves of the current game, reused between games
+
+    public:
+        Writer();
+
+        /**
+         * @brief Creates the archive file and writes its header.
+         *
+         * @param path The file to create; an existing file is replaced.
+         * @return False if the file cannot be written.
+         */
+        bool open(const string& path);
+
+        /**
+         * @brief Appends a game.
+         *
+         * @param game The game to store.
+         * @return False if the game holds an illegal move or the write failed.
+         */
+        bool add(const Game& game);
+
+        /**
+         * @brief Gets the number of games written so far.
+         */
+        uint64_t size() const { return offsets.size(); }
+
+        /**
+         * @brief Writes the index and trailer and closes the file.
+         *
+         * @return False if the file was not open or a write failed.
+         */
+        bool close();
+
+        ~Writer();
+    };
+
+    /**
+     * @class Reader
+     * @brief Reads games from an archive file, in order or by number.
+     */
+    class Reader
+    {
+    private:
+        ifstream file;                  //The archive being read
+        vector<uint64_t> offsets;       //File offset of every game
+        uint64_t nextGame;              //Game returned by the next call to next()
+        uint64_t streamGame;            //Game whose data starts at the file position, so in-order reads need no seek
+        EngineBoard board;              //Scratch board for replaying moves
+        string payload;                 //Coded moves of the current game, reused between games
+
+    public:
+        Reader();
+
+        /**
+         * @brief Opens an archive and loads its offset index.
+         *
+         * @param path The archive file.
+         * @param error Set to a short reason on failure.
+         * @return False if the file is missing or not a valid archive.
+         */
+        bool open(const string& path, string& error);
+
+        /**
+         * @brief Gets the number of games in the archive.
+         */
+        uint64_t size() const { return offsets.size(); }
+
+        /**
+         * @brief Reads game N.
+         *
+         * @param index The game number, from 0.
+         * @param game Set to the game.
+         * @return False if there is no such game or its data is damaged.
+         */
+        bool read(uint64_t index, Game& game);
+
+        /**
+         * @brief Reads the game after the one last read by next().
+         *
+         * @param game Set to the game.
+         * @return False at the end of the archive or if the game is damaged.
+         */
+        bool next(Game& game);
+    };
+};
+
+#endif // !GAMEARCHIVE_H
@@ -0,0 +1,200 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Header file for the GameServer class, which hosts many Free Play sessions over sockets.
+
+#ifndef GAMESERVER_H
+#define GAMESERVER_H
+
+#include "ChessBoard.h"         //Provides the boards handed to sessions.
+#include <condition_variable>   //For waking engine threads.
+#include <cstdint>              //Provides fixed-width integer types.
+#include <deque>                //For queued commands and engine jobs.
+#include <mutex>                //For the engine job and reply queues.
+#include <string>               //For addresses and protocol lines.
+#include <thread>               //For the engine thread pool.
+#include <vector>               //For the board pool and sessions.
+
+using namespace std;
+
+/**
+ * @class GameServer
+ * @brief Hosts thousands of Free Play sessions from one process.
+ *
+ * Clients connect to a local TCP port or a Unix socket and send the same
+ * commands as Free Play, one per line; every command is answered with one
+ * JSON line as in the headless mode (see Chess::respond()). All sockets are
+ * served by a single epoll loop. Each session gets a board from a pool
+ * allocated up front. Searches and perft run on a pool of engine threads,
+ * each with its own Search, so a slow search never holds up other
+ * sessions; commands a session sends meanwhile wait in order behind it.
+ * Engine jobs carry a snapshot of the board rather than the board itself,
+ * so only the loop ever touches a session's board.
+ *
+ * Addresses are written "tcp:PORT", "tcp:HOST:PORT" or "unix:PATH".
+ * Only Linux is supported, since the loop is built on epoll.
+ */
+class GameServer
+{
+public:
+    static const int DEFAULT_SESSIONS = 10240;  //Boards in the pool, and so the session limit
+    static const size_t MAX_LINE = 4096;        //Longest accepted command line
+    static const size_t MAX_PENDING = 1024;     //Most commands a session may queue behind an engine job
+    static const int MAX_JOB_DEPTH = 20;        //Deepest "go" a session may ask for
+    static const int MAX_PERFT_DEPTH = 5;       //Deepest "perft" a session may ask for
+    static const uint64_t MAX_JOB_NODES = 2000000;  //Node budget of every "go"
+    static const long long MAX_JOB_TIME = 10000;    //Longest "go" in milliseconds
+
+    /**
+     * @struct Options
+     * @brief Server settings.
+     */
+    struct Options
+    {
+        string address = "tcp:7000";            //Where to listen
+        int sessions = DEFAULT_SESSIONS;        //Board pool size
+        int engineThreads = 0;                  //Engine pool size, 0 for one per hardware thread
+        size_t hashMb = 16;                     //Transposition table size of each engine thread
+    };
+
+private:
+    /**
+     * @struct Session
+     * @brief One connected client, indexed by its socket.
+     */
+    struct Session
+    {
+        int board = -1;             //Index of the session's board in the pool, -1 if unused
+        uint32_t generation = 0;    //Changes whenever the socket number is reused
+        string input;               //Received bytes not yet forming a full line
+        string output;              //Response bytes not yet sent
+        deque<string> pending;      //Commands waiting for an engine reply to finish
+        bool busy = false;          //True while an engine command of the session is running
+        bool closing = false;       //Close once every command is answered and the output is sent
+        bool readClosed = false;    //True once the client has finished sending
+        uint32_t watched = 0;       //epoll events the socket is registered for
+    };
+
+    /**
+     * @struct Job
+     * @brief A command handed to an engine thread, or the reply it produced.
+     */
+    struct Job
+    {
+        int fd;                     //Socket of the session that sent it
+        uint32_t generation;        //Session generation when it was sent
+        BoardSnapshot position;     //Copy of the session's board the command runs on
+        string line;                //The command, then the JSON reply
+    };
+
+    Options options;
+    int listenFd;                   //Listening socket
+    int epollFd;                    //The event loop
+    int wakeFd;                     //eventfd the engine threads signal when a reply is ready
+    vector<ChessBoard> boards;      //Board pool
+    vector<int> freeBoards;         //Indices of unused boards
+    vector<Session> sessions;       //Sessions by socket number
+    uint32_t nextGeneration;        //Generation for the next session
+    uint64_t commandsServed;        //Commands answered since start
+
+    mutex jobMutex;                 //Guards jobs, replies and shuttingDown
+    condition_variable jobReady;    //Signalled when a job is queued or on shutdown
+    deque<Job> jobs;                //Commands waiting for an engine thread
+    vector<Job> replies;            //Finished engine commands waiting for the loop
+    bool shuttingDown;              //Tells the engine threads to exit
+    vector<thread> engineThreads;   //The engine pool
+
+    /**
+     * @brief Runs engine jobs until shutdown. Body of each engine thread.
+     */
+    void engineLoop();
+
+    /**
+     * @brief Accepts every waiting connection.
+     */
+    void acceptClients();
+
+    /**
+     * @brief Reads from a session's socket and runs each complete line.
+     */
+    void readClient(int fd);
+
+    /**
+     * @brief Runs one command line of a session, inline or on the engine pool.
+     */
+    void handleLine(int fd, const string& line);
+
+    /**
+     * @brief Rewrites a "go" or "perft" line with its limits clamped to the server's caps.
+     */
+    static string clampJob(const string& line);
+
+    /**
+     * @brief Runs queued commands of a session until one needs the engine.
+     */
+    void drainPending(int fd);
+
+    /**
+     * @brief Delivers engine replies to their sessions.
+     */
+    void collectReplies();
+
+    /**
+     * @brief Queues a reply line and sends as much as the socket takes.
+     */
+    void sendLine(int fd, const string& line);
+
+    /**
+     * @brief Sends buffered output; closes a closing session once everything is answered and sent.
+     */
+    void flushClient(int fd);
+
+    /**
+     * @brief Closes a session and returns its board to the pool.
+     */
+    void closeClient(int fd);
+
+public:
+    /**
+     * @brief Constructs a server and fills the board pool.
+     *
+     * @param serverOptions The address, pool sizes and engine settings.
+     */
+    explicit GameServer(const Options& serverOptions);
+
+    GameServer(const GameServer&) = delete;
+    GameServer& operator=(const GameServer&) = delete;
+
+    /**
+     * @brief Opens the listening socket and starts the engine threads.
+     *
+     * @param error Set to a short reason on failure.
+     * @return False if the address is invalid or cannot be bound.
+     */
+    bool start(string& error);
+
+    /**
+     * @brief Serves sessions until SIGINT or SIGTERM.
+     *
+     * @return The process exit status.
+     */
+    int run();
+
+    /**
+     * @brief Opens a socket for an address.
+     *
+     * @param address "tcp:PORT", "tcp:HOST:PORT" or "unix:PATH"; TCP without a host means 127.0.0.1.
+     * @param listening True to bind and listen, false to connect.
+     * @param error Set to a short reason on failure.
+     * @return The socket, or -1 on failure.
+     */
+    static int openSocket(const string& address, bool listening, string& error);
+
+    /**
+     * @brief Raises the open file limit towards a number of sockets, up to the hard limit.
+     */
+    static void raiseFileLimit(size_t wanted);
+
+    ~GameServer();
+};
+
+#endif // !GAMESERVER_H
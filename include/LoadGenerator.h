@@ -0,0 +1,48 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Header file for the LoadGenerator class, a client that measures GameServer latency under many sessions.
+
+#ifndef LOADGENERATOR_H
+#define LOADGENERATOR_H
+
+#include <iostream>     //For the report stream.
+#include <string>       //For the server address.
+
+using namespace std;
+
+/**
+ * @class LoadGenerator
+ * @brief Opens many sessions against a GameServer and reports command latency.
+ *
+ * Every session plays the same short script of Free Play commands (piece
+ * queries, moves, "fen", "perft 2" and "reset"), sending its next command
+ * as soon as the previous reply arrives. All sessions share one epoll
+ * loop, so ten thousand of them need only one thread. The report gives the
+ * throughput and the p50, p90, p99 and worst latency from sending a
+ * command to receiving its reply.
+ */
+class LoadGenerator
+{
+public:
+    /**
+     * @struct Options
+     * @brief Load settings.
+     */
+    struct Options
+    {
+        string address = "tcp:7000";    //Server address, as for GameServer
+        int sessions = 10000;           //Concurrent sessions
+        int rounds = 16;                //Commands sent by each session
+    };
+
+    /**
+     * @brief Runs the load and writes the report.
+     *
+     * @param options The server address, session count and commands per session.
+     * @param out Where the report is written.
+     * @return 0 if every command got a reply, otherwise 1.
+     */
+    static int run(const Options& options, ostream& out);
+};
+
+#endif // !LOADGENERATOR_H
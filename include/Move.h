@@ -0,0 +1,109 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Header file for the Move class, a compact move encoding used by the engine.
+
+#ifndef MOVE_H
+#define MOVE_H
+
+#include <cstdint>      //Provides the 16-bit storage type.
+#include <string>       //For converting moves to coordinate notation.
+
+using namespace std;
+
+/**
+ * @class Move
+ * @brief A chess move packed into 16 bits.
+ *
+ * Bits 0-5 hold the origin square, bits 6-11 the target square and
+ * bits 12-15 a flag describing the kind of move (quiet, capture, castling,
+ * promotion...). Squares use the engine numbering (a8 = 0, h1 = 63).
+ */
+class Move
+{
+private:
+    uint16_t data;      //Packed from/to/flag value. Zero means "no move".
+
+public:
+    //Move kinds stored in the flag bits
+    enum Flag
+    {
+        QUIET = 0,
+        DOUBLE_PUSH = 1,
+        KING_CASTLE = 2,
+        QUEEN_CASTLE = 3,
+        CAPTURE = 4,
+        EN_PASSANT = 5,
+        PROMO_KNIGHT = 8,
+        PROMO_BISHOP = 9,
+        PROMO_ROOK = 10,
+        PROMO_QUEEN = 11,
+        PROMO_CAPTURE_KNIGHT = 12,
+        PROMO_CAPTURE_BISHOP = 13,
+        PROMO_CAPTURE_ROOK = 14,
+        PROMO_CAPTURE_QUEEN = 15
+    };
+
+    /**
+     * @brief Constructs the null move.
+     */
+    Move() : data(0) {}
+
+    /**
+     * @brief Constructs a move from its parts.
+     *
+     * @param from The origin square (0-63).
+     * @param to The target square (0-63).
+     * @param flag The move kind.
+     */
+    Move(int from, int to, int flag = QUIET)
+        : data(static_cast<uint16_t>(from | (to << 6) | (flag << 12))) {}
+
+    /**
+     * @brief Rebuilds a move from its raw 16-bit value.
+     */
+    static Move fromRaw(uint16_t raw) { Move m; m.data = raw; return m; }
+
+    uint16_t raw() const { return data; }
+    int getFrom() const { return data & 0x3F; }
+    int getTo() const { return (data >> 6) & 0x3F; }
+    int getFlag() const { return data >> 12; }
+
+    bool isNull() const { return data == 0; }
+    bool isCapture() const { return (getFlag() & CAPTURE) != 0; }
+    bool isPromotion() const { return (getFlag() & 8) != 0; }
+    bool isCastle() const { return getFlag() == KING_CASTLE || getFlag() == QUEEN_CASTLE; }
+
+    /**
+     * @brief Gets the piece type a pawn promotes to (KNIGHT..QUEEN), valid only for promotions.
+     */
+    int promotionType() const { return (getFlag() & 3) + 1; }
+
+    bool operator==(const Move& other) const { return data == other.data; }
+    bool operator!=(const Move& other) const { return data != other.data; }
+
+    /**
+     * @brief Converts the move to coordinate notation (e.g., "e2e4", "e7e8q").
+     *
+     * @return The move text, or "0000" for the null move.
+     */
+    string toString() const;
+};
+
+/**
+ * @struct MoveList
+ * @brief Fixed-capacity list of moves with ordering scores, filled by the move generator.
+ */
+struct MoveList
+{
+    static const int CAPACITY = 256;    //Larger than the maximum number of legal moves in any position
+
+    Move moves[CAPACITY];
+    int scores[CAPACITY];
+    int count = 0;
+
+    void add(const Move& m) { moves[count++] = m; }
+    int size() const { return count; }
+    const Move& operator[](int i) const { return moves[i]; }
+};
+
+#endif // !MOVE_H
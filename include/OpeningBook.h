@@ -0,0 +1,125 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Header file for the OpeningBook class, a memory-mapped Polyglot opening book.
+
+#ifndef OPENINGBOOK_H
+#define OPENINGBOOK_H
+
+#include "BoardSnapshot.h"  //Provides the positions the book is probed with.
+#include <cstddef>          //Provides size_t.
+#include <cstdint>          //Provides fixed-width integer types.
+#include <string>           //For book paths and move text.
+#include <vector>           //For the moves found in a position.
+
+using namespace std;
+
+/**
+ * @struct BookMove
+ * @brief One book move of a position and how often the book recommends it.
+ */
+struct BookMove
+{
+    string move;        //The move in coordinate form, e.g., "e2e4" or "e7e8q"
+    int weight;         //Relative weight from the book; higher is played more often
+};
+
+/**
+ * @class OpeningBook
+ * @brief Looks positions up in a Polyglot (.bin) opening book without loading it.
+ *
+ * A Polyglot book is a file of 16-byte big-endian entries (key, move,
+ * weight, learn) sorted by key, where the key is the Polyglot Zobrist hash
+ * of the position. The file is mapped read-only, so opening even a large
+ * book is instant and only the pages a lookup touches are read. A lookup is
+ * a binary search for the first entry of the key followed by a scan of its
+ * neighbours.
+ */
+class OpeningBook
+{
+private:
+    const unsigned char* entries;   //The mapped file, or nullptr when no book is open
+    size_t entryCount;              //Number of 16-byte entries
+    size_t mappedBytes;             //Size of the mapping, for unmapping
+    vector<unsigned char> buffer;   //The whole file where mapping is not available
+    uint64_t randomState;           //State of the generator used by pick()
+
+    /**
+     * @brief Reads the key of an entry.
+     */
+    uint64_t keyAt(size_t index) const;
+
+public:
+    static const size_t ENTRY_SIZE = 16;    //Bytes per book entry
+
+    OpeningBook();
+    ~OpeningBook();
+
+    OpeningBook(const OpeningBook&) = delete;
+    OpeningBook& operator=(const OpeningBook&) = delete;
+
+    /**
+     * @brief Opens a book file, closing any open book first.
+     *
+     * @param path The .bin file.
+     * @param error Set to the reason when the book cannot be opened.
+     * @return True if the book is open.
+     */
+    bool open(const string& path, string& error);
+
+    /**
+     * @brief Closes the book; later lookups find nothing.
+     */
+    void close();
+
+    /**
+     * @brief Checks whether a book is open.
+     */
+    bool isOpen() const { return entries != nullptr; }
+
+    /**
+     * @brief Gets the number of entries in the open book.
+     */
+    size_t size() const { return entryCount; }
+
+    /**
+     * @brief Computes the Polyglot key of a position.
+     *
+     * The key uses Polyglot's own random numbers, not the engine's Zobrist
+     * keys, so it matches books written by other programs. As Polyglot
+     * requires, the en passant file only counts when a pawn of the side to
+     * move stands next to the pawn that just advanced two squares.
+     *
+     * @param snap The position, e.g., from ChessBoard::snapshot().
+     * @return The 64-bit Polyglot key.
+     */
+    static uint64_t key(const BoardSnapshot& snap);
+
+    /**
+     * @brief Gets every book move of a position.
+     *
+     * Castling, stored by Polyglot as the king taking its own rook, is
+     * returned as the king's two-square move (e1g1, e1c1, e8g8, e8c8).
+     *
+     * @param snap The position.
+     * @return The moves in book order (highest weight first), or none.
+     */
+    vector<BookMove> probe(const BoardSnapshot& snap) const;
+
+    /**
+     * @brief Chooses a book move at random in proportion to the weights.
+     *
+     * @param snap The position.
+     * @return The move, or an empty string when the position is not in the book.
+     */
+    string pick(const BoardSnapshot& snap);
+
+    /**
+     * @brief Chooses one of the given book moves at random in proportion to the weights.
+     *
+     * @param moves Book moves of one position, e.g. those of probe() that are legal on the board.
+     * @return The move, or an empty string when there are none.
+     */
+    string pick(const vector<BookMove>& moves);
+};
+
+#endif // !OPENINGBOOK_H
@@ -0,0 +1,95 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Header file for the PackedPosition struct, a labelled training position in 32 bytes.
+
+#ifndef PACKEDPOSITION_H
+#define PACKEDPOSITION_H
+
+#include "Bitboard.h"       //For walking the occupied squares.
+#include "BoardSnapshot.h"  //Provides the positions being packed.
+#include <cstdint>          //Provides fixed-width integer types.
+#include <cstring>          //For clearing records.
+
+using namespace std;
+
+/**
+ * @struct PackedPosition
+ * @brief A position with its search score and game result in 32 bytes.
+ *
+ * The placement is stored as the occupied squares plus one 4-bit engine
+ * piece code per occupied square, in square order, which fits any legal
+ * position in 24 bytes. Castling rights and en passant squares are not
+ * kept: training positions are quiet ones, where they rarely matter to
+ * the evaluation. Files of these records are written and read as raw
+ * little-endian bytes with no header, so record n starts at byte 32 n and
+ * a file can be mapped and indexed directly.
+ */
+struct PackedPosition
+{
+    uint64_t occupancy;         //Bit n set if square n (a8 = 0 ... h1 = 63) holds a piece
+    uint8_t pieces[16];         //Piece code of each occupied square in square order, two per byte, first in the low nibble
+    int16_t score;              //Search score in centipawns from White's point of view
+    int8_t result;              //Game result: 1 White won, 0 drawn, -1 Black won
+    uint8_t side;               //Side to move (0 White, 1 Black)
+    uint16_t ply;               //Plies played in the game before this position
+    uint8_t halfmoveClock;      //Plies since the last capture or pawn move, capped at 255
+    uint8_t reserved;           //Always zero
+
+    /**
+     * @brief Packs a snapshot with its labels.
+     *
+     * @param snap The position.
+     * @param whiteScore The search score from White's point of view, clamped to 16 bits.
+     * @param whiteResult 1 if White won the game, 0 for a draw, -1 if Black won.
+     * @param gamePly Plies played in the game before the position.
+     */
+    static PackedPosition fromSnapshot(const BoardSnapshot& snap, int whiteScore, int whiteResult, int gamePly)
+    {
+        PackedPosition packed;
+        memset(&packed, 0, sizeof(packed));
+        int count = 0;
+        for (int sq = 0; sq < 64; sq++)
+        {
+            int code = snap.codeAt(sq);
+            if (code != 0 && count < 32)
+            {
+                packed.occupancy |= 1ULL << sq;
+                packed.pieces[count >> 1] |= static_cast<uint8_t>((code - 1) << ((count & 1) * 4));
+                count++;
+            }
+        }
+        whiteScore = whiteScore < -32767 ? -32767 : (whiteScore > 32767 ? 32767 : whiteScore);
+        packed.score = static_cast<int16_t>(whiteScore);
+        packed.result = static_cast<int8_t>(whiteResult);
+        packed.side = snap.side;
+        packed.ply = static_cast<uint16_t>(gamePly > 65535 ? 65535 : gamePly);
+        packed.halfmoveClock = snap.halfmoveClock;
+        return packed;
+    }
+
+    /**
+     * @brief Unpacks the position into a snapshot without castling rights or en passant square.
+     *
+     * The hash is left zero; EngineBoard::loadSnapshot recomputes it.
+     */
+    BoardSnapshot toSnapshot() const
+    {
+        BoardSnapshot snap;
+        memset(&snap, 0, sizeof(snap));
+        uint64_t bits = occupancy;
+        for (int count = 0; bits; count++)
+        {
+            int sq = Bitboards::popLsb(bits);
+            snap.setCode(sq, ((pieces[count >> 1] >> ((count & 1) * 4)) & 15) + 1);
+        }
+        snap.side = side;
+        snap.enPassant = BoardSnapshot::NO_EN_PASSANT;
+        snap.halfmoveClock = halfmoveClock;
+        snap.fullmoveNumber = static_cast<uint16_t>(1 + ply / 2);
+        return snap;
+    }
+};
+
+static_assert(sizeof(PackedPosition) == 32, "PackedPosition is meant to stay 32 bytes");
+
+#endif // !PACKEDPOSITION_H
@@ -0,0 +1,126 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Header file for the PiecePool class, which stores the pieces of one board.
+
+#ifndef PIECEPOOL_H
+#define PIECEPOOL_H
+
+#include "ChessPiece.h"   //Provides the piece base class stored in the slots.
+#include <cstdint>        //Provides fixed-width integer types.
+#include <new>            //For placement new.
+#include <string>         //For the piece color.
+
+using namespace std;
+
+/**
+ * @class PiecePool
+ * @brief Fixed storage for the pieces of one ChessBoard.
+ *
+ * A board never holds more than 32 pieces, so the pool keeps 32 slots inside
+ * the board object itself and never touches the heap. Pieces are built in
+ * place in a free slot; a captured piece gives its slot back to a free list.
+ * The piece classes add no members to ChessPiece, so every slot is the size
+ * of a ChessPiece. A bit per slot marks the live pieces, so reset() and the
+ * destructor can destroy exactly those.
+ */
+class PiecePool
+{
+public:
+    static const int CAPACITY = 32;     //Most pieces a legal position can have
+
+private:
+    alignas(ChessPiece) unsigned char slots[CAPACITY][sizeof(ChessPiece)]; //Raw piece storage
+    void* freeSlots[CAPACITY];          //Released slots, reused first
+    int freeCount;                      //Number of released slots
+    int used;                           //Slots handed out from the front of the storage
+    uint32_t live;                      //Bit n set while slot n holds a piece
+
+    /**
+     * @brief Gets the slot number of a piece created by this pool.
+     */
+    int slotOf(const ChessPiece* piece) const
+    {
+        return static_cast<int>((reinterpret_cast<const unsigned char*>(piece) - slots[0]) / sizeof(ChessPiece));
+    }
+
+public:
+    /**
+     * @brief Constructs an empty pool.
+     */
+    PiecePool() : freeCount(0), used(0), live(0) {}
+
+    /**
+     * @brief Destroys the live pieces.
+     */
+    ~PiecePool() { reset(); }
+
+    PiecePool(const PiecePool&) = delete;
+    PiecePool& operator=(const PiecePool&) = delete;
+
+    /**
+     * @brief Builds a piece in a free slot.
+     *
+     * @param color The color of the piece ("White" or "Black").
+     * @param pos The position of the piece.
+     * @return The new piece, or nullptr if all slots are in use.
+     */
+    template <class T>
+    ChessPiece* create(const string& color, const Position& pos)
+    {
+        static_assert(sizeof(T) <= sizeof(ChessPiece) && alignof(T) <= alignof(ChessPiece),
+            "Piece classes must fit a ChessPiece slot");
+
+        void* slot;
+        if (freeCount > 0)
+        {
+            slot = freeSlots[--freeCount];
+        }
+        else if (used < CAPACITY)
+        {
+            slot = slots[used++];
+        }
+        else
+        {
+            return nullptr;
+        }
+        ChessPiece* piece = new (slot) T(color, pos);
+        live |= 1u << slotOf(piece);
+        return piece;
+    }
+
+    /**
+     * @brief Destroys a piece and frees its slot.
+     *
+     * @param piece A piece created by this pool.
+     */
+    void release(ChessPiece* piece)
+    {
+        live &= ~(1u << slotOf(piece));
+        piece->~ChessPiece();
+        freeSlots[freeCount++] = piece;
+    }
+
+    /**
+     * @brief Destroys the live pieces and frees every slot at once.
+     */
+    void reset()
+    {
+        for (int slot = 0; slot < used; slot++)
+        {
+            if (live & (1u << slot))
+            {
+                reinterpret_cast<ChessPiece*>(slots[slot])->~ChessPiece();
+            }
+        }
+        live = 0;
+        used = 0;
+        freeCount = 0;
+    }
+
+    /**
+     * @brief Gets the number of live pieces.
+     */
+    int size() const { return used - freeCount; }
+};
+
+#endif // !PIECEPOOL_H
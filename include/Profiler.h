@@ -0,0 +1,151 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Header file for the Profiler class, optional scoped timers and allocation counts for hot paths.
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+/**
+ * Profiling is compiled in only when CHESS_PROFILE is defined (for example
+ * with -DCHESS_PROFILE). Without it PROFILE_SCOPE expands to nothing, no
+ * profiling code or data is built, and operator new is not replaced, so a
+ * normal build pays nothing for the instrumented sites.
+ */
+#ifdef CHESS_PROFILE
+
+#include <atomic>       //For counters shared by every thread.
+#include <chrono>       //For timing scopes.
+#include <cstdint>      //Provides fixed-width integer types.
+#include <string>       //For the report path.
+
+using namespace std;
+
+/**
+ * @class ProfileSite
+ * @brief Call count, latency histogram and allocation totals of one instrumented place in the code.
+ *
+ * Sites are function-local statics created by PROFILE_SCOPE, so each one is
+ * built the first time its code runs and registers itself with the
+ * Profiler. Every field is atomic because the server runs sessions and
+ * searches on several threads.
+ */
+class ProfileSite
+{
+public:
+    static const int SUB_BUCKETS = 8;                   //Linear steps within each power of two
+    static const int BUCKETS = 64 * SUB_BUCKETS;        //Histogram buckets, enough for any 64-bit duration
+
+    const char* name;                   //Site name written to the report
+    atomic<uint64_t> calls;             //Completed scopes
+    atomic<uint64_t> totalNs;           //Time spent in all scopes
+    atomic<uint64_t> maxNs;             //Slowest scope
+    atomic<uint64_t> allocations;       //Heap allocations made inside the scopes
+    atomic<uint64_t> allocatedBytes;    //Bytes requested by those allocations
+    atomic<uint64_t> buckets[BUCKETS];  //Scope latencies, log-linear buckets of nanoseconds
+    ProfileSite* next;                  //Next registered site
+
+    /**
+     * @brief Creates a site and registers it for the exit report.
+     *
+     * @param siteName The name written to the report (a string literal).
+     */
+    explicit ProfileSite(const char* siteName);
+
+    /**
+     * @brief Adds one completed scope.
+     */
+    void record(uint64_t ns, uint64_t allocs, uint64_t bytes);
+
+    /**
+     * @brief Gets the histogram bucket of a duration.
+     *
+     * Durations under 8 ns get a bucket each; above that every power of two
+     * is split into SUB_BUCKETS equal steps, so a bucket is never wider than
+     * an eighth of its values.
+     */
+    static int bucketOf(uint64_t ns);
+
+    /**
+     * @brief Gets the largest duration that falls into a bucket.
+     */
+    static uint64_t bucketLimit(int bucket);
+
+    /**
+     * @brief Gets the duration at or below which a fraction of the calls finished.
+     *
+     * @param fraction The fraction of calls, e.g., 0.99 for the 99th percentile.
+     * @return The upper limit of the bucket holding that call, or 0 with no calls.
+     */
+    uint64_t percentile(double fraction) const;
+};
+
+/**
+ * @class ProfileScope
+ * @brief Times one run of a scope and counts the heap allocations made in it.
+ */
+class ProfileScope
+{
+private:
+    ProfileSite& site;                              //Where the result is added
+    chrono::steady_clock::time_point start;         //When the scope was entered
+    uint64_t startAllocations;                      //This thread's allocation count on entry
+    uint64_t startBytes;                            //This thread's allocated bytes on entry
+
+public:
+    explicit ProfileScope(ProfileSite& target);
+    ~ProfileScope();
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
+
+/**
+ * @class Profiler
+ * @brief The registered sites, the per-thread allocation counters and the exit report.
+ *
+ * The first site to register arranges for writeReport() to run at exit.
+ * The report goes to the file named by the CHESS_PROFILE_FILE environment
+ * variable, or chess_profile.json in the working directory.
+ */
+class Profiler
+{
+public:
+    /**
+     * @brief Adds a site to the report and, for the first site, registers the exit report.
+     */
+    static void registerSite(ProfileSite* site);
+
+    /**
+     * @brief Gets the number of heap allocations made so far by the calling thread.
+     */
+    static uint64_t threadAllocations();
+
+    /**
+     * @brief Gets the number of bytes requested so far by the calling thread.
+     */
+    static uint64_t threadAllocatedBytes();
+
+    /**
+     * @brief Writes every site's counts, latencies and allocations as JSON.
+     *
+     * @param path The file to write.
+     * @return True if the file was written.
+     */
+    static bool writeReport(const string& path);
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+//Times the rest of the enclosing scope under the given site name
+#define PROFILE_SCOPE(siteName) \
+    static ProfileSite PROFILE_CONCAT(profileSite, __LINE__)(siteName); \
+    ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(PROFILE_CONCAT(profileSite, __LINE__))
+
+#else
+
+#define PROFILE_SCOPE(siteName) ((void)0)
+
+#endif // CHESS_PROFILE
+
+#endif // !PROFILER_H
@@ -0,0 +1,365 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Header file for the Search class, the alpha-beta engine that picks a move for a position.
+
+#ifndef SEARCH_H
+#define SEARCH_H
+
+#include "EngineBoard.h"    //Provides the position being searched.
+#include "Move.h"           //Provides the Move type.
+#include "TimeManager.h"    //Provides the soft and hard time limits.
+#include "TranspositionTable.h" //Provides the hash table of searched positions.
+#include <atomic>           //For the stop flag and per-thread counters.
+#include <chrono>           //For measuring search time.
+#include <cstdint>          //Provides fixed-width integer types.
+#include <iostream>         //For writing UCI-style info lines.
+#include <memory>           //For owning the per-thread workers.
+#include <string>           //For option names.
+#include <vector>           //For the principal variation and workers.
+
+using namespace std;
+
+class Tablebase;
+
+/**
+ * @struct SearchOptions
+ * @brief Runtime switches for each selective search technique.
+ *
+ * Every technique can be turned off on its own so its effect on node
+ * count and time-to-depth can be measured on a fixed position set.
+ */
+struct SearchOptions
+{
+    bool nullMove = true;               //Null-move pruning
+    bool nullMoveVerification = true;   //Verify null-move cutoffs with a reduced search in low-material positions
+    bool lateMoveReductions = true;     //Reduce late quiet moves using the logarithmic table
+    bool futilityPruning = true;        //Skip hopeless quiet moves and prune hopeless nodes near the leaves
+    bool razoring = true;               //Drop straight into quiescence when far below alpha near the leaves
+    bool checkExtensions = true;        //Search one ply deeper when in check
+    bool aspirationWindows = true;      //Search the root with a narrow window around the last score
+    bool tablebases = true;             //Score positions covered by the loaded endgame tables exactly
+    bool instrumentation = false;       //Print search statistics and time move generation and evaluation
+    int threads = 1;                    //Search threads sharing the transposition table
+    string metricsFile;                 //Key/value metrics file refreshed during search, empty for none
+    int metricsInterval = 1000;         //Milliseconds between metrics file refreshes
+};
+
+/**
+ * @struct SearchLimits
+ * @brief When to stop searching. Zero means "no limit" for nodes and time.
+ *
+ * A fixed moveTime takes precedence over the clock fields.
+ */
+struct SearchLimits
+{
+    int depth = 64;                     //Maximum iteration depth
+    uint64_t nodes = 0;                 //Node budget
+    long long moveTime = 0;             //Time budget in milliseconds
+    long long time[2] = { 0, 0 };       //Time left on each side's clock in milliseconds, by Color
+    long long increment[2] = { 0, 0 };  //Increment per move in milliseconds, by Color
+    int movesToGo = 0;                  //Moves until the next time control, 0 for sudden death
+};
+
+/**
+ * @struct SearchCounters
+ * @brief A plain snapshot of search statistics, summed over threads.
+ */
+struct SearchCounters
+{
+    uint64_t nodes = 0;             //Main and quiescence search nodes
+    uint64_t qnodes = 0;            //Quiescence search nodes
+    uint64_t ttProbes = 0;          //Transposition table lookups
+    uint64_t ttHits = 0;            //Lookups that found the position
+    uint64_t ttCutoffs = 0;         //Nodes answered straight from the table
+    uint64_t betaCutoffs = 0;       //Nodes that failed high after trying moves
+    uint64_t firstMoveCutoffs = 0;  //Fail-highs on the first move tried
+    uint64_t moveGenNs = 0;         //Estimated nanoseconds in move generation
+    uint64_t evalNs = 0;            //Estimated nanoseconds in evaluation
+
+    SearchCounters& operator+=(const SearchCounters& other);
+};
+
+/**
+ * @struct SearchResult
+ * @brief The outcome of a search.
+ */
+struct SearchResult
+{
+    Move bestMove;              //Best move found (null if the side to move has no legal moves)
+    int score = 0;              //Score in centipawns from the side to move's point of view
+    int depth = 0;              //Last fully completed depth
+    uint64_t nodes = 0;         //Nodes searched by all threads, including quiescence nodes
+    long long timeMs = 0;       //Elapsed time in milliseconds
+    long long overshootMs = 0;  //Time spent past the hard limit before the search returned
+    vector<Move> pv;            //Principal variation starting with bestMove
+};
+
+/**
+ * @class Search
+ * @brief Iterative-deepening principal variation search with selective pruning.
+ *
+ * On top of plain alpha-beta the search uses null-move pruning, late-move
+ * reductions, futility pruning, razoring, check extensions and aspiration
+ * windows, each controlled by SearchOptions. Results are cached in a
+ * transposition table. Moves are ordered by the hash move (or the previous
+ * principal variation), MVV-LVA for captures, killer moves and a history
+ * table.
+ *
+ * With more than one thread, helper threads run the same search on their
+ * own copy of the position and share only the transposition table (lazy
+ * SMP); the main thread's result is returned.
+ */
+class Search
+{
+public:
+    static const int MAX_PLY = 128;             //Deepest ply the search can reach
+    static const int INFINITE_SCORE = 32001;    //Larger than any real score
+    static const int MATE_SCORE = 32000;        //Score for delivering mate at the root
+    static const int MATE_BOUND = MATE_SCORE - MAX_PLY;  //Scores beyond this are mate scores
+    static const int MAX_THREADS = 256;         //Upper bound for the threads option
+
+private:
+    /**
+     * @struct StatCounter
+     * @brief A counter written by one thread and read by any.
+     *
+     * Relaxed load-and-store (not an atomic add) compiles to a plain
+     * increment, so counting costs the same as a normal integer while
+     * other threads may still read it safely.
+     */
+    struct StatCounter
+    {
+        atomic<uint64_t> value{ 0 };
+
+        void add(uint64_t n = 1) { value.store(value.load(memory_order_relaxed) + n, memory_order_relaxed); }
+        uint64_t get() const { return value.load(memory_order_relaxed); }
+        void reset() { value.store(0, memory_order_relaxed); }
+    };
+
+    /**
+     * @struct Worker
+     * @brief Everything one search thread owns. Cache-line aligned so
+     * threads never share a line.
+     */
+    struct alignas(64) Worker
+    {
+        int id = 0;                         //Thread index, 0 for the main thread
+        EngineBoard board;                  //Private copy of the root position
+        Move killers[MAX_PLY][2];           //Quiet moves that caused a cutoff at each ply
+        int history[2][64][64];             //Cutoff history by side, from and to square
+        Move pvTable[MAX_PLY][MAX_PLY];     //Triangular principal variation table
+        int pvLength[MAX_PLY];              //Length of the principal variation from each ply
+        Move prevPv[MAX_PLY];               //Principal variation of the previous iteration
+        int prevPvLength = 0;               //Length of prevPv
+        bool followPv = false;              //True while searching the leftmost path of prevPv
+        int selDepth = 0;                   //Deepest ply reached this iteration
+        unsigned sampleTick = 0;            //Call counter for sampled timing
+        double branchingFactor = 0;         //Effective branching factor of the last completed iteration
+
+        StatCounter nodes, qnodes, ttProbes, ttHits, ttCutoffs, betaCutoffs, firstMoveCutoffs, moveGenNs, evalNs;
+
+        SearchResult result;                //Last completed iteration of this thread
+
+        /**
+         * @brief Clears killers and history.
+         */
+        void clearTables();
+
+        /**
+         * @brief Zeroes all counters.
+         */
+        void resetCounters();
+
+        /**
+         * @brief Copies the counters into a plain snapshot.
+         */
+        SearchCounters counters() const;
+    };
+
+    SearchOptions options;              //Technique switches
+    SearchLimits limits;                //Limits of the current search
+    TranspositionTable tt;              //Hash table of searched positions, shared by all threads
+    TimeManager timeManager;            //Soft and hard time limits of the current search
+    ostream* info;                      //Where to write info lines, or nullptr for silence
+    const Tablebase* tablebase;         //Endgame tables probed below the root, or nullptr for none
+    atomic<bool> stopped;               //Set when a limit is hit; read by every thread
+    chrono::steady_clock::time_point startTime;
+    long long lastMetricsWrite;         //Elapsed ms of the last metrics file refresh
+    vector<unique_ptr<Worker>> workers; //One per thread; workers[0] runs on the caller's thread
+
+    static int lmrTable[64][64];        //Late-move reductions by depth and move number
+
+    /**
+     * @brief Fills the late-move reduction table.
+     */
+    static void initLmr();
+
+    /**
+     * @brief Checks the node limit and hard time limit and sets the stop flag. Main thread only.
+     */
+    void checkLimits();
+
+    /**
+     * @brief Gets the elapsed search time in milliseconds.
+     */
+    long long elapsedMs() const;
+
+    /**
+     * @brief Creates or removes workers to match options.threads.
+     */
+    void resizeWorkers();
+
+    /**
+     * @brief Assigns an ordering score to every move of a list.
+     */
+    void scoreMoves(const Worker& w, MoveList& list, Move hashMove, int ply) const;
+
+    /**
+     * @brief Moves the best-scored remaining move to position index and returns it.
+     */
+    static Move pickMove(MoveList& list, int index);
+
+    /**
+     * @brief Generates moves, timing one call in 16 when instrumentation is on.
+     *
+     * @tparam US The side to move on the worker's board.
+     */
+    template <int US>
+    void generate(Worker& w, MoveList& list, bool capturesOnly);
+
+    /**
+     * @brief Generates moves for whichever side is to move.
+     */
+    void generate(Worker& w, MoveList& list, bool capturesOnly);
+
+    /**
+     * @brief Evaluates the position, timing one call in 16 when instrumentation is on.
+     */
+    int evaluate(Worker& w);
+
+    /**
+     * @brief Searches a node with the principal variation search algorithm.
+     *
+     * @param w The worker whose board is searched.
+     * @param depth Remaining depth in plies.
+     * @param alpha Lower bound of the window.
+     * @param beta Upper bound of the window.
+     * @param ply Distance from the root.
+     * @param allowNull False right after a null move, to forbid two in a row.
+     * @return The score from the side to move's point of view.
+     */
+    int negamax(Worker& w, int depth, int alpha, int beta, int ply, bool allowNull);
+
+    /**
+     * @brief Searches captures until the position is quiet.
+     *
+     * @tparam US The side to move; each ply calls the other side's instance,
+     *            so moves are generated, made and unmade without side checks.
+     */
+    template <int US>
+    int quiescence(Worker& w, int alpha, int beta, int ply);
+
+    /**
+     * @brief Starts the quiescence search for whichever side is to move.
+     */
+    int quiescence(Worker& w, int alpha, int beta, int ply);
+
+    /**
+     * @brief Runs iterative deepening on one worker until stopped.
+     */
+    void iterate(Worker& w);
+
+    /**
+     * @brief Writes the info lines for a completed iteration of the main thread.
+     */
+    void reportIteration(const Worker& w, int depth, int score, double branchingFactor) const;
+
+    /**
+     * @brief Rewrites the metrics file with the current counters.
+     */
+    void writeMetrics(int depth, double branchingFactor) const;
+
+public:
+    /**
+     * @brief Constructs a single-threaded search with all techniques enabled.
+     */
+    Search();
+
+    /**
+     * @brief Gets the technique switches for reading or changing.
+     */
+    SearchOptions& getOptions() { return options; }
+
+    /**
+     * @brief Changes one option by name.
+     *
+     * Switches take "on" or "off"; "threads", "hash" (MB) and
+     * "metricsinterval" (ms) take a number; "metrics" takes a file path or "off".
+     *
+     * @param name One of the names listed by describeOptions().
+     * @param value The new value as text.
+     * @return False if the name is unknown or the value is not accepted.
+     */
+    bool setOption(const string& name, const string& value);
+
+    /**
+     * @brief Lists every option name with its current state.
+     */
+    string describeOptions() const;
+
+    /**
+     * @brief Resizes the transposition table.
+     *
+     * @param megabytes The new size in MB.
+     * @return False if the memory could not be allocated.
+     */
+    bool setHashSize(size_t megabytes) { return tt.resize(megabytes); }
+
+    /**
+     * @brief Gets the transposition table.
+     */
+    TranspositionTable& getTable() { return tt; }
+
+    /**
+     * @brief Sets the endgame tables probed below the root; nullptr for none.
+     *
+     * The tables must not be loaded or generated while a search runs.
+     */
+    void setTablebase(const Tablebase* tables) { tablebase = tables; }
+
+    /**
+     * @brief Sets where info lines are written; nullptr silences them.
+     */
+    void setInfoOutput(ostream* out) { info = out; }
+
+    /**
+     * @brief Clears the transposition, killer and history tables so a new game starts fresh.
+     */
+    void clear();
+
+    /**
+     * @brief Searches a position until a limit is reached.
+     *
+     * @param board The position to search. It is not modified.
+     * @param searchLimits Depth, node and time limits.
+     * @return The best move, score and statistics of the main thread's last completed iteration.
+     */
+    SearchResult think(const EngineBoard& board, const SearchLimits& searchLimits);
+
+    /**
+     * @brief Asks a running search to stop as soon as possible. Safe from any thread.
+     */
+    void stop() { stopped = true; }
+
+    /**
+     * @brief Sums the counters of all threads. Safe to call during a search.
+     */
+    SearchCounters counters() const;
+
+    /**
+     * @brief Formats a score as UCI text ("cp 35" or "mate 3").
+     */
+    static string formatScore(int score);
+};
+
+#endif // !SEARCH_H
@@ -0,0 +1,201 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Header file for the Tablebase class, generated endgame tables with perfect play for few pieces.
+
+#ifndef TABLEBASE_H
+#define TABLEBASE_H
+
+#include "EngineBoard.h"    //Provides the positions probed by the search.
+#include <cstddef>          //Provides size_t.
+#include <cstdint>          //Provides fixed-width integer types.
+#include <iostream>         //For generation and verification reports.
+#include <memory>           //For owning the loaded tables.
+#include <string>           //For material names, paths and error text.
+#include <unordered_map>    //For finding a table by material.
+#include <vector>           //For the loaded tables and mapped buffers.
+
+using namespace std;
+
+/**
+ * @class Tablebase
+ * @brief Generates, maps and probes win/draw/loss and distance-to-mate tables of small endgames.
+ *
+ * A table covers one material balance, named by the White pieces followed
+ * by the Black pieces with the stronger side as White, e.g., "KQK", "KPK",
+ * "KBNK" or "KQKR". Positions are indexed by the side to move and the
+ * squares of every piece, with the White king folded into the a1-d1-d4
+ * triangle (or the a-d files when there are pawns) by the board's
+ * symmetries. Tables are built by retrograde analysis: mates are found
+ * first, then each pass walks one ply back from the positions decided in
+ * the previous pass, with the passes split across threads. Captures and
+ * promotions leave the table and are looked up in the smaller tables,
+ * which are generated first.
+ *
+ * A table file holds 2 bits of win/draw/loss and just enough bits of
+ * distance to mate per position, and is mapped read-only so the search
+ * reads only the pages it touches. Tables ignore castling and en passant,
+ * so positions with castling rights or an en passant square are not probed.
+ */
+class Tablebase
+{
+public:
+    static const int MAX_PIECES = 5;        //Most pieces in a table, kings included
+
+    //Results from the side to move's point of view
+    enum Wdl { TB_LOSS = -1, TB_DRAW = 0, TB_WIN = 1 };
+
+private:
+    /**
+     * @struct Table
+     * @brief One material balance: its index layout and its mapped values.
+     */
+    struct Table
+    {
+        string name;                        //Material, e.g., "KBNK"
+        int pieceCount = 0;                 //Pieces in every position, kings included
+        int codes[MAX_PIECES] = {};         //Engine piece code of each index slot; the kings come first
+        bool pawns = false;                 //True if the White king is folded by files only
+        uint64_t size = 0;                  //Positions in the index
+        int dtmBits = 0;                    //Bits of distance to mate per position
+        int maxDtm = 0;                     //Longest mate in the table, in plies
+        const unsigned char* wdl = nullptr; //2 bits per position
+        const unsigned char* dtm = nullptr; //dtmBits bits per position
+        void* mapping = nullptr;            //Start of the mapped file
+        size_t mappedBytes = 0;             //Size of the mapping
+        vector<unsigned char> buffer;       //The whole file where mapping is not available
+
+        ~Table();
+
+        /**
+         * @brief Gets the stored win/draw/loss code of a position (see Tablebase.cpp).
+         */
+        int wdlAt(uint64_t index) const { return (wdl[index >> 2] >> ((index & 3) * 2)) & 3; }
+
+        /**
+         * @brief Gets the stored distance to mate of a position.
+         */
+        int dtmAt(uint64_t index) const
+        {
+            uint64_t bit = index * static_cast<uint64_t>(dtmBits);
+            unsigned pair = dtm[bit >> 3] | (static_cast<unsigned>(dtm[(bit >> 3) + 1]) << 8);
+            return static_cast<int>((pair >> (bit & 7)) & ((1u << dtmBits) - 1));
+        }
+    };
+
+    vector<unique_ptr<Table>> tables;               //Every loaded table
+    unordered_map<uint64_t, Table*> byMaterial;     //Tables by material key
+    string directory;                               //Where table files are written and found
+    int largest;                                    //Most pieces in any loaded table
+
+    /**
+     * @brief Fills in a table's name, slots and size from a material name.
+     *
+     * @return False if the name is not two kings and at most MAX_PIECES pieces.
+     */
+    static bool parseMaterial(const string& name, Table& table);
+
+    /**
+     * @brief Gets a material name with the stronger side as White.
+     */
+    static string normalise(const string& name);
+
+    /**
+     * @brief Maps a table file and adds it to the loaded tables.
+     */
+    bool mapTable(const string& path, string& error);
+
+    /**
+     * @brief Finds the table of a set of pieces, in either colour orientation.
+     *
+     * @param codes The engine piece codes.
+     * @param count The number of pieces.
+     * @param flipped Set to true if the table has the colours the other way round.
+     * @return The table, or nullptr if none is loaded.
+     */
+    const Table* find(const int codes[], int count, bool& flipped) const;
+
+    /**
+     * @brief Looks up a position given as pieces, squares and side to move.
+     *
+     * @param dtm Set to the distance to mate in plies for a win or loss.
+     * @return False if no table covers the pieces.
+     */
+    bool lookup(const int codes[], const int squares[], int count, int side, int& wdl, int& dtm) const;
+
+    /**
+     * @brief Builds one table whose smaller tables are already loaded, and writes it.
+     */
+    bool build(Table& table, int threads, ostream& out, string& error);
+
+public:
+    /**
+     * @brief Constructs an empty tablebase that keeps its files in the working directory.
+     */
+    Tablebase();
+
+    Tablebase(const Tablebase&) = delete;
+    Tablebase& operator=(const Tablebase&) = delete;
+
+    /**
+     * @brief Maps every table file found in a directory.
+     *
+     * Later generated tables are written to the same directory.
+     *
+     * @param path The directory.
+     * @return The number of tables loaded.
+     */
+    int load(const string& path);
+
+    /**
+     * @brief Generates a table and every smaller table it depends on.
+     *
+     * Tables that are already loaded or already have a file are reused.
+     * Each generated table is written to "<directory>/<material>.ctb",
+     * mapped and reported with its generation time and memory use.
+     *
+     * @param material The material, e.g., "KQK" or "KBNK".
+     * @param threads Threads to generate with; 0 for one per core.
+     * @param out Where the reports go.
+     * @param error Set to the reason on failure.
+     * @return True if the table is loaded.
+     */
+    bool generate(const string& material, int threads, ostream& out, string& error);
+
+    /**
+     * @brief Gets the most pieces of any loaded table; 0 with no tables.
+     */
+    int maxPieces() const { return largest; }
+
+    /**
+     * @brief Gets the number of loaded tables.
+     */
+    size_t tableCount() const { return tables.size(); }
+
+    /**
+     * @brief Looks a position up.
+     *
+     * @param board The position.
+     * @param wdl Set to TB_WIN, TB_DRAW or TB_LOSS for the side to move.
+     * @param dtm Set to the plies until mate with best play, 0 for a draw.
+     * @return False if no table covers the position or it has castling rights or an en passant square.
+     */
+    bool probe(const EngineBoard& board, int& wdl, int& dtm) const;
+
+    /**
+     * @brief Checks a table against a brute-force mate search on random positions.
+     *
+     * Every sampled position is searched full width to a fixed depth; the
+     * search must find a mate in exactly the table's distance when it is
+     * within the depth, and no mate otherwise. Half of the samples are
+     * drawn from positions with mates within the depth.
+     *
+     * @param material The table to check.
+     * @param samples The number of positions.
+     * @param depth The search depth in plies.
+     * @param out Where mismatches and the summary go.
+     * @return The number of mismatches, or -1 if the table is not loaded.
+     */
+    int verify(const string& material, int samples, int depth, ostream& out) const;
+};
+
+#endif // !TABLEBASE_H
@@ -0,0 +1,91 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Header file for the TimeManager class, which decides how long the search may think on a clock.
+
+#ifndef TIMEMANAGER_H
+#define TIMEMANAGER_H
+
+#include "Move.h"       //Provides the Move type used to track best-move stability.
+
+using namespace std;
+
+/**
+ * @class TimeManager
+ * @brief Turns clock limits into a soft and a hard time limit for one search.
+ *
+ * The soft limit is the time the search normally aims for; it is checked
+ * only between iterations and stretched or shrunk by how stable the best
+ * move and score have been. The hard limit is never exceeded on purpose:
+ * the search checks it every few thousand nodes and stops mid-iteration.
+ */
+class TimeManager
+{
+public:
+    static const long long MOVE_OVERHEAD = 10;  //Milliseconds kept back for input, output and thread shutdown
+    static const int DEFAULT_MOVES_TO_GO = 30;  //Moves assumed left in sudden death
+
+private:
+    long long softLimit;        //Time the search aims to use, 0 when not timed
+    long long hardLimit;        //Time the search must not pass, 0 when not timed
+    bool adaptive;              //False for a fixed move time
+    Move lastBestMove;          //Best move of the previous iteration
+    int lastScore;              //Score of the previous iteration
+    int stableIterations;       //Consecutive iterations with the same best move
+
+public:
+    /**
+     * @brief Constructs an untimed manager.
+     */
+    TimeManager();
+
+    /**
+     * @brief Sets the limits for a new search.
+     *
+     * A fixed move time makes both limits equal. Otherwise the soft limit is
+     * an even share of the remaining time over the moves left plus most of
+     * the increment, and the hard limit a few times that, capped well inside
+     * the remaining time.
+     *
+     * @param moveTime Fixed time for this move in ms, or 0.
+     * @param remaining Time left on the side to move's clock in ms, or 0.
+     * @param increment Increment per move in ms.
+     * @param movesToGo Moves until the next time control, or 0 for sudden death.
+     */
+    void start(long long moveTime, long long remaining, long long increment, int movesToGo);
+
+    /**
+     * @brief Checks whether a clock is being used at all.
+     */
+    bool isTimed() const { return hardLimit > 0; }
+
+    /**
+     * @brief Gets the soft limit in ms.
+     */
+    long long getSoftLimit() const { return softLimit; }
+
+    /**
+     * @brief Gets the hard limit in ms.
+     */
+    long long getHardLimit() const { return hardLimit; }
+
+    /**
+     * @brief Checks whether the hard limit has been reached.
+     */
+    bool hardLimitReached(long long elapsedMs) const { return hardLimit > 0 && elapsedMs >= hardLimit; }
+
+    /**
+     * @brief Decides after a completed iteration whether to start another.
+     *
+     * A best move that keeps changing or a falling score extends the soft
+     * limit (up to the hard limit); a best move that has held for several
+     * iterations shortens it.
+     *
+     * @param elapsedMs Time used so far.
+     * @param bestMove Best move of the iteration just completed.
+     * @param score Score of the iteration just completed.
+     * @return True if the search should stop now.
+     */
+    bool iterationDone(long long elapsedMs, Move bestMove, int score);
+};
+
+#endif // !TIMEMANAGER_H
@@ -0,0 +1,131 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Header file for the Tournament class, parallel engine-versus-engine matches with a sequential test.
+
+#ifndef TOURNAMENT_H
+#define TOURNAMENT_H
+
+#include "EngineBoard.h"    //Provides the boards the games are played on.
+#include "Search.h"         //Provides the engines.
+#include <iostream>         //For the live report.
+#include <string>           //For option settings and opening files.
+#include <vector>           //For the opening list.
+
+using namespace std;
+
+/**
+ * @class Tournament
+ * @brief Plays two engine configurations against each other on every core and tests which is stronger.
+ *
+ * Each game thread owns both engines and its board, so the games share
+ * nothing but the standings. Every opening is played twice, once with each
+ * configuration as White. After every game the standings give the score,
+ * the Elo difference with its 95% error bar, the games per hour, and the
+ * log-likelihood ratio of a sequential probability ratio test (SPRT) of
+ * "B is elo1 stronger than A" against "B is elo0 stronger than A". The
+ * match stops as soon as the ratio leaves the bounds set by alpha and beta,
+ * or after the game limit.
+ */
+class Tournament
+{
+public:
+    /**
+     * @struct Options
+     * @brief Match settings.
+     */
+    struct Options
+    {
+        string engineA;                 //Option settings of the baseline, e.g., "lmr=off hash=8"
+        string engineB;                 //Option settings of the candidate
+        uint64_t nodes = 20000;         //Node limit per move, 0 for none
+        int depth = 0;                  //Depth limit per move, 0 for none
+        long long moveTime = 0;         //Time per move in milliseconds, 0 for none
+        int concurrency = 0;            //Games played at once, 0 for one per core
+        int maxGames = 2000;            //Games before the match stops undecided
+        string openings;                //Opening file, empty for the built-in openings
+        double elo0 = 0.0;              //Elo gain of the null hypothesis
+        double elo1 = 5.0;              //Elo gain of the alternative hypothesis
+        double alpha = 0.05;            //Chance of accepting a change that does not gain elo0
+        double beta = 0.05;             //Chance of rejecting a change that gains elo1
+    };
+
+    /**
+     * @struct Standings
+     * @brief Results from the candidate's point of view.
+     */
+    struct Standings
+    {
+        int wins = 0;
+        int draws = 0;
+        int losses = 0;
+
+        int games() const { return wins + draws + losses; }
+    };
+
+    /**
+     * @brief Reads opening positions.
+     *
+     * Each line is a FEN, or a list of moves from the start position such
+     * as "e2e4 e7e5 g1f3". Blank lines and lines starting with '#' are skipped.
+     *
+     * @param path The opening file, or empty for the built-in openings.
+     * @param openings Set to the positions as FEN.
+     * @param error Set to the reason on failure.
+     * @return False if the file cannot be read or a line is not a position.
+     */
+    static bool loadOpenings(const string& path, vector<string>& openings, string& error);
+
+    /**
+     * @brief Applies "name=value" settings (separated by spaces or commas) to an engine.
+     *
+     * @return False with the failing setting in error if an option is not accepted.
+     */
+    static bool configure(Search& engine, const string& settings, string& error);
+
+    /**
+     * @brief Gets the Elo difference that gives an expected score.
+     */
+    static double eloFromScore(double score);
+
+    /**
+     * @brief Gets the half-width of the 95% confidence interval of the Elo difference.
+     */
+    static double eloError(const Standings& standings);
+
+    /**
+     * @brief Gets the log-likelihood ratio of elo1 against elo0 for a set of results.
+     *
+     * Uses the normal approximation of the trinomial model: with the mean
+     * score s, its variance v per game and n games,
+     * LLR = n (s1 - s0) (2s - s0 - s1) / (2v), where s0 and s1 are the
+     * scores the two Elo hypotheses predict.
+     */
+    static double sprtLlr(const Standings& standings, double elo0, double elo1);
+
+    /**
+     * @brief Plays one game to the end.
+     *
+     * The game ends in mate, stalemate, a draw by the fifty-move rule,
+     * repetition or material, or by adjudication: a win once both engines
+     * have given one side at least 1000 centipawns for eight plies in a
+     * row, a draw after 400 plies.
+     *
+     * @param white The engine playing White.
+     * @param black The engine playing Black.
+     * @param fen The start position.
+     * @param limits The search limits of every move.
+     * @return 1 if White won, -1 if Black won, 0 for a draw.
+     */
+    static int playGame(Search& white, Search& black, const string& fen, const SearchLimits& limits);
+
+    /**
+     * @brief Runs a match and writes a line per game and a final verdict.
+     *
+     * @param options The engines, limits, openings and test bounds.
+     * @param out Where the report is written.
+     * @return 0 once the match is over, 1 if the options or openings were not accepted.
+     */
+    static int run(const Options& options, ostream& out);
+};
+
+#endif // !TOURNAMENT_H
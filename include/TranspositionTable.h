@@ -0,0 +1,212 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Header file for the TranspositionTable class, the search's hash table of already searched positions.
+
+#ifndef TRANSPOSITIONTABLE_H
+#define TRANSPOSITIONTABLE_H
+
+#include "Move.h"       //Provides the Move type stored in entries.
+#include <cstddef>      //Provides size_t.
+#include <cstdint>      //Provides fixed-width integer types.
+#include <string>       //For hash file paths.
+
+#if defined(_MSC_VER)
+#include <xmmintrin.h>  //Provides _mm_prefetch on MSVC.
+#endif
+
+using namespace std;
+
+//Kinds of score stored in an entry
+enum Bound { BOUND_NONE = 0, BOUND_UPPER = 1, BOUND_LOWER = 2, BOUND_EXACT = 3 };
+
+/**
+ * @struct TTEntry
+ * @brief One 8-byte transposition table slot.
+ *
+ * Only 16 bits of the position key are kept. The cluster index comes
+ * from the upper bits, so the entry keeps the lower 16 bits, which the
+ * index never uses; the two together identify the position.
+ */
+struct TTEntry
+{
+    uint16_t key16;         //Lower 16 bits of the position hash
+    uint16_t move;          //Best or refutation move, raw Move encoding
+    int16_t score;          //Search score, mate scores relative to this node
+    uint8_t depth;          //Remaining depth the score was searched to
+    uint8_t genBound;       //Search generation (upper 6 bits) and Bound (lower 2 bits)
+
+    int bound() const { return genBound & 3; }
+    int generation() const { return genBound >> 2; }
+};
+
+/**
+ * @class TranspositionTable
+ * @brief Clustered, size-configurable hash table of search results.
+ *
+ * Entries are grouped in clusters of ENTRIES_PER_CLUSTER that fill exactly
+ * one aligned 32-byte block (set ENTRIES_PER_CLUSTER to 8 for 64-byte
+ * clusters), so a probe touches a single cache line. When a cluster is full,
+ * the entry with the lowest depth, counting old generations as shallower,
+ * is replaced. Memory is requested with transparent huge pages where the
+ * platform supports it.
+ *
+ * The table can be saved to a file and mapped back later, so a long
+ * analysis can resume with everything it had already searched.
+ */
+class TranspositionTable
+{
+public:
+    static const int ENTRIES_PER_CLUSTER = 4;   //8-byte entries per cluster
+    static const size_t DEFAULT_SIZE_MB = 16;   //Size used until resize() is called
+    static const uint32_t FILE_VERSION = 2;     //Hash file format version
+    static const size_t FILE_HEADER_SIZE = 4096; //Header bytes, one page so the clusters map aligned
+
+    /**
+     * @struct Cluster
+     * @brief Entries that share one hash index, aligned to their own size.
+     */
+    struct alignas(ENTRIES_PER_CLUSTER * sizeof(TTEntry)) Cluster
+    {
+        TTEntry entries[ENTRIES_PER_CLUSTER];
+    };
+
+private:
+    Cluster* table;             //Cluster array
+    size_t clusterCount;        //Number of clusters
+    size_t allocatedBytes;      //Bytes actually allocated (cluster array rounded up)
+    uint8_t generation;         //Current search generation (0-63)
+    bool mapped;                //True if table points into a mapped hash file
+
+    /**
+     * @brief Maps a hash to its cluster with a multiply-high, so any cluster count works.
+     *
+     * Only the upper bits of the hash decide the cluster, leaving the
+     * lower bits for keyOf().
+     */
+    Cluster* clusterFor(uint64_t hash) const
+    {
+#if defined(__SIZEOF_INT128__)
+        return &table[static_cast<size_t>((static_cast<unsigned __int128>(hash) * clusterCount) >> 64)];
+#elif defined(_MSC_VER) && defined(_M_X64)
+        return &table[static_cast<size_t>(__umulh(hash, clusterCount))];
+#else
+        return &table[static_cast<size_t>(((hash >> 32) * clusterCount) >> 32)];
+#endif
+    }
+
+    /**
+     * @brief Gets the 16 bits of a hash an entry keeps to tell positions in one cluster apart.
+     */
+    static uint16_t keyOf(uint64_t hash) { return static_cast<uint16_t>(hash); }
+
+    void release();
+
+public:
+    /**
+     * @brief Constructs a table of DEFAULT_SIZE_MB megabytes.
+     */
+    TranspositionTable();
+
+    TranspositionTable(const TranspositionTable&) = delete;
+    TranspositionTable& operator=(const TranspositionTable&) = delete;
+
+    /**
+     * @brief Reallocates the table to the given size and clears it.
+     *
+     * @param megabytes The table size in MB (at least 1).
+     * @return False if the memory could not be allocated; the table then keeps its old size.
+     */
+    bool resize(size_t megabytes);
+
+    /**
+     * @brief Empties every entry. Large tables are cleared by several threads.
+     */
+    void clear();
+
+    /**
+     * @brief Starts a new search generation so older entries age out first.
+     */
+    void newSearch() { generation = (generation + 1) & 63; }
+
+    /**
+     * @brief Looks up a position.
+     *
+     * @param hash The position hash.
+     * @param found Set to true if an entry for the position exists.
+     * @return The matching entry, or the entry that store() would replace.
+     */
+    TTEntry* probe(uint64_t hash, bool& found) const;
+
+    /**
+     * @brief Writes a search result into an entry returned by probe().
+     *
+     * An existing move is kept when the new result has none, and a deeper
+     * result for the same position is not overwritten by a shallow bound.
+     */
+    void store(TTEntry* entry, uint64_t hash, Move move, int score, int depth, int bound);
+
+    /**
+     * @brief Starts loading the cluster for a hash into the cache.
+     */
+    void prefetch(uint64_t hash) const
+    {
+#if defined(_MSC_VER)
+        _mm_prefetch(reinterpret_cast<const char*>(clusterFor(hash)), _MM_HINT_T0);
+#else
+        __builtin_prefetch(clusterFor(hash));
+#endif
+    }
+
+    /**
+     * @brief Writes the table to a file.
+     *
+     * The header records the format version, cluster layout, Zobrist seed
+     * and generation. The clusters are then streamed straight from the
+     * table in chunks, so saving needs no second copy in memory. The file
+     * is written as "<path>.tmp" and renamed over the target, so saving
+     * back to the file the table was loaded from is safe and an old file
+     * survives a failed save.
+     *
+     * @param path The file to create or overwrite.
+     * @return False if the file could not be written.
+     */
+    bool save(const string& path) const;
+
+    /**
+     * @brief Replaces the table with one saved by save().
+     *
+     * Where the platform allows, the file is memory-mapped copy-on-write
+     * instead of read, so loading is nearly instant and the file itself is
+     * never modified by the search.
+     *
+     * @param path The file to load.
+     * @param error Set to a short reason on failure.
+     * @return False if the file is missing or its header does not match
+     *         this build (version, layout or Zobrist seed); the table is then unchanged.
+     */
+    bool load(const string& path, string& error);
+
+    /**
+     * @brief Estimates table usage in permille by sampling the first 1000 clusters.
+     */
+    int hashfull() const;
+
+    /**
+     * @brief Gets the table size in megabytes.
+     */
+    size_t sizeMb() const { return clusterCount * sizeof(Cluster) / (1024 * 1024); }
+
+    /**
+     * @brief Converts a score to "mate from this node" form for storing.
+     */
+    static int scoreToTT(int score, int ply, int mateBound);
+
+    /**
+     * @brief Converts a stored score back to "mate from the root" form.
+     */
+    static int scoreFromTT(int score, int ply, int mateBound);
+
+    ~TranspositionTable();
+};
+
+#endif // !TRANSPOSITIONTABLE_H
@@ -0,0 +1,68 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Header file for the Tuner class, which fits the evaluation weights to labelled positions.
+
+#ifndef TUNER_H
+#define TUNER_H
+
+#include <iostream>     //For the epoch report.
+#include <string>       //For file paths.
+
+using namespace std;
+
+/**
+ * @class Tuner
+ * @brief Tunes the evaluation weights by gradient descent on a file of PackedPosition records.
+ *
+ * Each position is reduced once to a sparse feature vector: how many of
+ * each piece type White has over Black, one entry per piece for the
+ * piece-square tables, the bishop pair and mobility differences, the game
+ * phase and the untuned king safety term. The vectors go into a cache
+ * file next to the data ("<data>.features"). The data and cache files are
+ * both memory-mapped, so datasets far larger than memory can be tuned;
+ * pages are read in as the passes reach them.
+ *
+ * The evaluation is linear in its weights for a given phase, so a
+ * position's score is a sum over its few features. The tuner first finds
+ * the scale K that best maps the current scores to the results. It then
+ * minimises the mean squared error between the logistic prediction
+ * 1 / (1 + 10^(-K s / 400)) and the target. The target is the game result
+ * (1, 1/2 or 0), optionally blended with the prediction of the search score.
+ * Every batch is split across threads. Each thread sums the gradient of its
+ * share into its own array, the arrays are added together, and one Adam
+ * step is taken. The tuned weights are written in the format of
+ * EvalWeights.h, ready to replace it and be compiled in.
+ */
+class Tuner
+{
+public:
+    /**
+     * @struct Options
+     * @brief Tuning settings.
+     */
+    struct Options
+    {
+        string data;                        //File of PackedPosition records
+        string output = "EvalWeights.h";    //Where the tuned weights are written
+        int epochs = 50;                    //Passes over the data
+        int batchSize = 65536;              //Positions per gradient step
+        double learningRate = 1.0;          //Adam step size in centipawns
+        double lambda = 1.0;                //Weight of the game result in the target; the rest is the search score
+        int threads = 0;                    //Threads, 0 for one per core
+    };
+
+    /**
+     * @brief Tunes the weights and writes them as a header.
+     *
+     * Builds the feature cache first if it is missing or was made from
+     * other data. Reports the fitted K, how closely the features reproduce
+     * the evaluation, and the loss and time of every epoch.
+     *
+     * @param options The data, output and training settings.
+     * @param out Where the report is written.
+     * @return 0 once the header is written, 1 on a file error.
+     */
+    static int run(const Options& options, ostream& out);
+};
+
+#endif // !TUNER_H
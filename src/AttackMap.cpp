@@ -0,0 +1,264 @@
+//Qusay Edkymish
+//Oct/19/2026
+//AttackMap Class Implementation
+
+#include "AttackMap.h"
+
+//Files as square sets (col 0 is the A file)
+static const uint64_t FILE_A = 0x0101010101010101ULL;
+static const uint64_t FILE_B = FILE_A << 1;
+static const uint64_t FILE_G = FILE_A << 6;
+static const uint64_t FILE_H = FILE_A << 7;
+
+/**
+ * @brief Shifts every square of a set by a square offset, dropping squares that would wrap a file.
+ *
+ * @tparam DELTA The square offset; row 0 is the eighth rank, so north is -8.
+ * @tparam LANDING The squares the shifted set may land on.
+ */
+template <int DELTA, uint64_t LANDING>
+static inline uint64_t shift(uint64_t b)
+{
+    return (DELTA > 0 ? b << (DELTA & 63) : b >> (-DELTA & 63)) & LANDING;
+}
+
+/**
+ * @brief Attacks of a set of sliders along one ray, stopping at the first piece (Kogge-Stone fill).
+ */
+template <int DELTA, uint64_t LANDING>
+static inline uint64_t slide(uint64_t sliders, uint64_t empty)
+{
+    empty &= LANDING;
+    sliders |= empty & shift<DELTA, LANDING>(sliders);
+    empty &= shift<DELTA, LANDING>(empty);
+    sliders |= empty & shift<DELTA * 2, ~0ULL>(sliders);
+    empty &= shift<DELTA * 2, ~0ULL>(empty);
+    sliders |= empty & shift<DELTA * 4, ~0ULL>(sliders);
+    return shift<DELTA, LANDING>(sliders);
+}
+
+/**
+ * @class Counter
+ * @brief Bit-sliced attacker counts of one side while a map is built.
+ *
+ * Kept in locals rather than written through to the map after every add,
+ * so the compiler can hold the planes in registers.
+ */
+class Counter
+{
+public:
+    uint64_t planes[AttackMap::COUNT_BITS] = {};    //Bit k of every square's count
+    uint64_t typeSet = 0;                           //Squares hit since the last call to takeType()
+
+    /**
+     * @brief Returns the squares hit by the piece type just added and starts the next one.
+     */
+    uint64_t takeType()
+    {
+        uint64_t set = typeSet;
+        typeSet = 0;
+        return set;
+    }
+
+    /**
+     * @brief Adds one to the count of every square in a set (ripple carry over the bit planes).
+     */
+    void add(uint64_t squares)
+    {
+        typeSet |= squares;
+        uint64_t carry = planes[0] & squares;
+        planes[0] ^= squares;
+        squares = carry & planes[1];
+        planes[1] ^= carry;
+        carry = squares & planes[2];
+        planes[2] ^= squares;
+        squares = carry & planes[3];
+        planes[3] ^= carry;
+        planes[4] ^= squares;
+    }
+
+    /**
+     * @brief Adds a step pattern (pawn, knight or king) shifted from every piece of a set.
+     */
+    template <int DELTA, uint64_t LANDING>
+    void step(uint64_t pieces)
+    {
+        add(shift<DELTA, LANDING>(pieces));
+    }
+
+    /**
+     * @brief Adds the attacks of a set of sliders along one ray.
+     */
+    template <int DELTA, uint64_t LANDING>
+    void ray(uint64_t sliders, uint64_t empty)
+    {
+        add(slide<DELTA, LANDING>(sliders, empty));
+    }
+};
+
+//Squares a step may land on without wrapping around the board edge
+static const uint64_t NOT_A = ~FILE_A;
+static const uint64_t NOT_H = ~FILE_H;
+static const uint64_t NOT_AB = ~(FILE_A | FILE_B);
+static const uint64_t NOT_GH = ~(FILE_G | FILE_H);
+static const uint64_t ALL = ~0ULL;
+
+/**
+ * @brief Adds the rook-like rays (N, S, E, W) of a set of sliders.
+ */
+static inline void orthogonal(Counter& counter, uint64_t sliders, uint64_t empty)
+{
+    counter.ray<-8, ALL>(sliders, empty);
+    counter.ray<8, ALL>(sliders, empty);
+    counter.ray<1, NOT_A>(sliders, empty);
+    counter.ray<-1, NOT_H>(sliders, empty);
+}
+
+/**
+ * @brief Adds the bishop-like rays (NE, NW, SE, SW) of a set of sliders.
+ */
+static inline void diagonal(Counter& counter, uint64_t sliders, uint64_t empty)
+{
+    counter.ray<-7, NOT_A>(sliders, empty);
+    counter.ray<-9, NOT_H>(sliders, empty);
+    counter.ray<9, NOT_A>(sliders, empty);
+    counter.ray<7, NOT_H>(sliders, empty);
+}
+
+/**
+ * @brief Builds the map for a position.
+ *
+ * Each step direction contributes a set in which every square is hit at
+ * most once, so each set is added to the counters as a single +1. Piece
+ * types a side does not have are skipped.
+ */
+void AttackMap::build(const uint64_t pieces[12])
+{
+    uint64_t occupied = 0;
+    for (int code = 0; code < 12; code++)
+    {
+        occupied |= pieces[code];
+    }
+    uint64_t empty = ~occupied;
+
+    for (int color = WHITE; color <= BLACK; color++)
+    {
+        const uint64_t* own = pieces + color * 6;
+        Counter counter;
+
+        //White pawns capture toward row 0, Black pawns toward row 7
+        if (color == WHITE)
+        {
+            counter.step<-9, NOT_H>(own[PAWN]);
+            counter.step<-7, NOT_A>(own[PAWN]);
+        }
+        else
+        {
+            counter.step<7, NOT_H>(own[PAWN]);
+            counter.step<9, NOT_A>(own[PAWN]);
+        }
+        byType[color][PAWN] = counter.takeType();
+
+        if (own[KNIGHT])
+        {
+            counter.step<-15, NOT_A>(own[KNIGHT]);
+            counter.step<-6, NOT_AB>(own[KNIGHT]);
+            counter.step<10, NOT_AB>(own[KNIGHT]);
+            counter.step<17, NOT_A>(own[KNIGHT]);
+            counter.step<15, NOT_H>(own[KNIGHT]);
+            counter.step<6, NOT_GH>(own[KNIGHT]);
+            counter.step<-10, NOT_GH>(own[KNIGHT]);
+            counter.step<-17, NOT_H>(own[KNIGHT]);
+        }
+        byType[color][KNIGHT] = counter.takeType();
+
+        if (own[BISHOP])
+        {
+            diagonal(counter, own[BISHOP], empty);
+        }
+        byType[color][BISHOP] = counter.takeType();
+
+        if (own[ROOK])
+        {
+            orthogonal(counter, own[ROOK], empty);
+        }
+        byType[color][ROOK] = counter.takeType();
+
+        if (own[QUEEN])
+        {
+            orthogonal(counter, own[QUEEN], empty);
+            diagonal(counter, own[QUEEN], empty);
+        }
+        byType[color][QUEEN] = counter.takeType();
+
+        //A king's neighbours are one step along each ray
+        counter.step<-8, ALL>(own[KING]);
+        counter.step<8, ALL>(own[KING]);
+        counter.step<1, NOT_A>(own[KING]);
+        counter.step<-1, NOT_H>(own[KING]);
+        counter.step<-7, NOT_A>(own[KING]);
+        counter.step<-9, NOT_H>(own[KING]);
+        counter.step<9, NOT_A>(own[KING]);
+        counter.step<7, NOT_H>(own[KING]);
+        byType[color][KING] = counter.takeType();
+
+        attacks[color] = byType[color][PAWN] | byType[color][KNIGHT] | byType[color][BISHOP]
+            | byType[color][ROOK] | byType[color][QUEEN] | byType[color][KING];
+        for (int k = 0; k < COUNT_BITS; k++)
+        {
+            counts[color][k] = counter.planes[k];
+        }
+    }
+}
+
+/**
+ * @brief Gets the number of pieces of one side attacking a square.
+ */
+int AttackMap::count(int color, int sq) const
+{
+    int n = 0;
+    for (int k = 0; k < COUNT_BITS; k++)
+    {
+        n |= static_cast<int>((counts[color][k] >> sq) & 1) << k;
+    }
+    return n;
+}
+
+/**
+ * @brief Gets the squares attacked by at least some number of pieces of one side.
+ *
+ * Compares every square's count against n at once, from the top bit down:
+ * a square is above n once it has a 1 where n has a 0 with all higher bits
+ * equal, and it stays equal only while its bits match n's.
+ */
+uint64_t AttackMap::atLeast(int color, int n) const
+{
+    uint64_t above = 0;
+    uint64_t equal = ~0ULL;
+    for (int k = COUNT_BITS - 1; k >= 0; k--)
+    {
+        if ((n >> k) & 1)
+        {
+            equal &= counts[color][k];
+        }
+        else
+        {
+            above |= equal & counts[color][k];
+            equal &= ~counts[color][k];
+        }
+    }
+    return above | equal;
+}
+
+/**
+ * @brief Adds up the attacker counts of one side over a set of squares.
+ */
+int AttackMap::totalOn(int color, uint64_t squares) const
+{
+    int total = 0;
+    for (int k = 0; k < COUNT_BITS; k++)
+    {
+        total += Bitboards::popCount(counts[color][k] & squares) << k;
+    }
+    return total;
+}
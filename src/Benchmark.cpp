@@ -0,0 +1,514 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Benchmark Class Implementation
+
+#include "Benchmark.h"
+#include "Chess.h"      //Provides the notation parser measured by the micro benchmarks.
+#include <chrono>       //For timing the board and archive benchmarks.
+#include <cstdio>       //For removing the archive benchmark file.
+#include <streambuf>    //For discarding rendered boards.
+
+/**
+ * @brief Gets the fixed benchmark positions.
+ *
+ * A mix of openings, tactical middlegames and endgames, so that every
+ * pruning technique gets exercised.
+ */
+const vector<string>& Benchmark::positions()
+{
+    static const vector<string> fens =
+    {
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+        "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+        "r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3",
+        "r1bq1rk1/ppp2ppp/2np1n2/2b1p3/2B1P3/2NP1N2/PPP2PPP/R1BQ1RK1 w - - 0 7",
+        "2rq1rk1/pp1bppbp/3p1np1/4n3/3NP3/1BN1BP2/PPPQ2PP/2KR3R w - - 0 13",
+        "r1b2rk1/2q1bppp/p2p1n2/np2p3/3PP3/5N1P/PPBN1PP1/R1BQR1K1 w - - 0 13",
+        "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+        "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+        "8/8/4k3/8/2p5/8/B2K4/8 w - - 0 1",
+        "6k1/5ppp/8/8/8/8/5PPP/3R2K1 w - - 0 1",
+        "8/5pk1/6p1/8/8/6P1/5PK1/8 w - - 0 1",
+        "4k3/8/8/8/8/8/4P3/4K3 w - - 0 1"
+    };
+    return fens;
+}
+
+/**
+ * @brief Searches every benchmark position to a fixed depth.
+ *
+ * @param search The search to run, with its options already set.
+ * @param depth The depth to search each position to.
+ * @param out Where to write the report.
+ * @param nps If not null, receives the nodes per second of the total line.
+ * @return The total number of nodes searched.
+ */
+uint64_t Benchmark::run(Search& search, int depth, ostream& out, uint64_t* nps)
+{
+    uint64_t totalNodes = 0;
+    long long totalMs = 0;
+    EngineBoard board;
+
+    SearchLimits limits;
+    limits.depth = depth;
+
+    search.setInfoOutput(nullptr);
+    out << "Options: " << search.describeOptions() << "\n";
+
+    const vector<string>& fens = positions();
+    for (size_t i = 0; i < fens.size(); i++)
+    {
+        board.loadFen(fens[i]);
+        search.clear();
+        SearchResult result = search.think(board, limits);
+
+        totalNodes += result.nodes;
+        totalMs += result.timeMs;
+        out << "Position " << (i + 1) << "/" << fens.size()
+            << ": bestmove " << result.bestMove.toString()
+            << " score " << Search::formatScore(result.score)
+            << " nodes " << result.nodes << " time " << result.timeMs << "\n";
+    }
+    search.setInfoOutput(&cout);
+
+    uint64_t totalNps = totalMs > 0 ? totalNodes * 1000 / totalMs : totalNodes;
+    out << "Total nodes: " << totalNodes << "  time: " << totalMs << " ms  nps: " << totalNps << "\n";
+    if (nps != nullptr)
+    {
+        *nps = totalNps;
+    }
+    return totalNodes;
+}
+
+/**
+ * @brief Counts the legal move tree through the side-agnostic entry points.
+ *
+ * Every generate, make and unmake call checks the side to move and then
+ * runs the same side-specific code that EngineBoard::perft() calls
+ * directly, so the difference between the two is only that per-call
+ * dispatch, not the whole gain of the side-specialised code.
+ */
+static uint64_t perftRuntimeSide(EngineBoard& board, int depth)
+{
+    if (depth == 0)
+    {
+        return 1;
+    }
+
+    MoveList list;
+    board.generateMoves(list);
+    uint64_t nodes = 0;
+    for (int i = 0; i < list.size(); i++)
+    {
+        if (board.makeMove(list[i]))
+        {
+            nodes += perftRuntimeSide(board, depth - 1);
+            board.unmakeMove();
+        }
+    }
+    return nodes;
+}
+
+/**
+ * @brief Runs perft over every benchmark position through both entry points.
+ *
+ * @param depth The perft depth for each position.
+ * @param out Where to write the report.
+ * @return Leaf nodes per second of EngineBoard::perft().
+ */
+uint64_t Benchmark::runPerft(int depth, ostream& out)
+{
+    depth = max(1, depth);
+    const vector<string>& fens = positions();
+    EngineBoard board;
+
+    uint64_t runtimeNodes = 0;
+    auto start = chrono::steady_clock::now();
+    for (const string& fen : fens)
+    {
+        board.loadFen(fen);
+        runtimeNodes += perftRuntimeSide(board, depth);
+    }
+    long long runtimeUs = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+
+    uint64_t templateNodes = 0;
+    start = chrono::steady_clock::now();
+    for (const string& fen : fens)
+    {
+        board.loadFen(fen);
+        templateNodes += board.perft(depth);
+    }
+    long long templateUs = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+
+    uint64_t runtimeNps = runtimeNodes * 1000000 / static_cast<uint64_t>(max(1LL, runtimeUs));
+    uint64_t templateNps = templateNodes * 1000000 / static_cast<uint64_t>(max(1LL, templateUs));
+    out << "Dispatching entry points: " << runtimeNodes << " nodes in " << runtimeUs / 1000 << " ms  nps: " << runtimeNps << "\n";
+    out << "Side-specific perft: " << templateNodes << " nodes in " << templateUs / 1000 << " ms  nps: " << templateNps
+        << (templateNodes == runtimeNodes ? "" : " (node count mismatch)") << "\n";
+    return templateNps;
+}
+
+//Short game played by the board benchmark: Scholar's Mate, ending in a capture
+static const int BOARD_GAME[][4] =
+{
+    { 6, 4, 4, 4 }, { 1, 4, 3, 4 }, { 7, 5, 4, 2 }, { 0, 1, 2, 2 },
+    { 7, 3, 3, 7 }, { 0, 6, 2, 5 }, { 3, 7, 1, 5 }
+};
+
+/**
+ * @brief Plays the board benchmark game on a board.
+ */
+static void playBoardGame(ChessBoard& board)
+{
+    for (const auto& step : BOARD_GAME)
+    {
+        board.movePiece(Position(step[0], step[1]), Position(step[2], step[3]));
+    }
+}
+
+/**
+ * @brief Measures how fast Free Play boards are set up and played through.
+ *
+ * Also times a snapshot round trip of the played position.
+ *
+ * @param games The number of games to play in each part.
+ * @param out Where to write the report.
+ * @return Games per second on newly constructed boards.
+ */
+uint64_t Benchmark::runBoards(int games, ostream& out)
+{
+    games = max(1, games);
+
+    auto start = chrono::steady_clock::now();
+    for (int g = 0; g < games; g++)
+    {
+        ChessBoard board;
+        playBoardGame(board);
+    }
+    long long newUs = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+
+    ChessBoard reused;
+    start = chrono::steady_clock::now();
+    for (int g = 0; g < games; g++)
+    {
+        reused.initializeBoard();
+        playBoardGame(reused);
+    }
+    long long resetUs = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+
+    //Snapshot round trip: export the played position, then restore it
+    BoardSnapshot played = reused.snapshot();
+    uint64_t hashes = 0;
+    start = chrono::steady_clock::now();
+    for (int g = 0; g < games; g++)
+    {
+        reused.restore(played);
+        hashes ^= reused.snapshot().hash;
+    }
+    long long snapshotNs = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+
+    uint64_t newRate = static_cast<uint64_t>(games) * 1000000 / static_cast<uint64_t>(max(1LL, newUs));
+    uint64_t resetRate = static_cast<uint64_t>(games) * 1000000 / static_cast<uint64_t>(max(1LL, resetUs));
+    out << "New board per game: " << games << " games in " << newUs / 1000 << " ms  " << newRate << " games/s\n";
+    out << "Reset board per game: " << games << " games in " << resetUs / 1000 << " ms  " << resetRate << " games/s\n";
+    out << "Snapshot restore and export: " << snapshotNs / games << " ns"
+        << (hashes == played.hash * (games & 1) ? "" : " (hash mismatch)") << "\n";
+    return newRate;
+}
+
+/**
+ * @brief Plays one reproducible random game for the archive benchmark.
+ *
+ * @param board Scratch board, reset to the start position.
+ * @param seed Random state, advanced by the game.
+ * @return The game, ending in mate, stalemate, a draw or after 200 plies.
+ */
+static GameArchive::Game randomGame(EngineBoard& board, uint64_t& seed)
+{
+    GameArchive::Game game;
+    board.setStartPosition();
+    MoveList legal;
+    while (game.moves.size() < 200 && !board.isDraw())
+    {
+        board.generateLegalMoves(legal);
+        if (legal.size() == 0)
+        {
+            game.result = !board.inCheck() ? GameArchive::DRAWN
+                : (board.sideToMove() == WHITE ? GameArchive::BLACK_WINS : GameArchive::WHITE_WINS);
+            return game;
+        }
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        Move move = legal[static_cast<int>(seed % static_cast<uint64_t>(legal.size()))];
+        board.makeMove(move);
+        game.moves.push_back(move);
+    }
+    game.result = board.isDraw() ? GameArchive::DRAWN : GameArchive::RESULT_UNKNOWN;
+    return game;
+}
+
+/**
+ * @brief Measures the game archive on random games.
+ *
+ * @param games The number of games to store.
+ * @param path The archive file to use.
+ * @param out Where to write the report.
+ * @return Moves decoded per second, or 0 if a game did not read back the same.
+ */
+uint64_t Benchmark::runArchive(int games, const string& path, ostream& out)
+{
+    games = max(1, games);
+    EngineBoard board;
+    uint64_t seed = 0x2545F4914F6CDD1DULL;
+    vector<GameArchive::Game> played;
+    uint64_t totalMoves = 0;
+    for (int g = 0; g < games; g++)
+    {
+        played.push_back(randomGame(board, seed));
+        totalMoves += played.back().moves.size();
+    }
+
+    auto start = chrono::steady_clock::now();
+    GameArchive::Writer writer;
+    if (!writer.open(path))
+    {
+        out << "Cannot write " << path << "\n";
+        return 0;
+    }
+    for (const GameArchive::Game& game : played)
+    {
+        writer.add(game);
+    }
+    writer.close();
+    long long writeUs = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+
+    GameArchive::Reader reader;
+    string error;
+    if (!reader.open(path, error))
+    {
+        out << "Cannot read " << path << ": " << error << "\n";
+        return 0;
+    }
+    ifstream sizeCheck(path, ios::binary | ios::ate);
+    uint64_t fileBytes = static_cast<uint64_t>(sizeCheck.tellg());
+    sizeCheck.close();
+
+    bool same = reader.size() == played.size();
+    GameArchive::Game game;
+    start = chrono::steady_clock::now();
+    for (size_t g = 0; same && g < played.size(); g++)
+    {
+        same = reader.next(game) && game.moves == played[g].moves && game.result == played[g].result;
+    }
+    long long readUs = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+
+    int lookups = min(games, 1000);
+    start = chrono::steady_clock::now();
+    for (int i = 0; same && i < lookups; i++)
+    {
+        uint64_t index = (static_cast<uint64_t>(i) * 2654435761u) % played.size();
+        same = reader.read(index, game) && game.moves == played[index].moves;
+    }
+    long long lookupUs = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+    remove(path.c_str());
+
+    if (!same)
+    {
+        out << "Archive games did not read back the same\n";
+        return 0;
+    }
+
+    //Bytes per move without the fixed per-game and per-file parts
+    uint64_t fixedBytes = 16 + 16 + static_cast<uint64_t>(games) * (8 + 8);
+    uint64_t moveRate = totalMoves * 1000000 / static_cast<uint64_t>(max(1LL, readUs));
+    out << "Games: " << games << "  moves: " << totalMoves << "  file: " << fileBytes << " bytes  "
+        << fixed << setprecision(2) << static_cast<double>(fileBytes - fixedBytes) / static_cast<double>(max<uint64_t>(1, totalMoves))
+        << " bytes/move coded, " << static_cast<double>(fileBytes) / static_cast<double>(max<uint64_t>(1, totalMoves))
+        << " with headers and index\n" << defaultfloat;
+    out << "Write: " << writeUs / 1000 << " ms  read in order: " << readUs / 1000 << " ms  "
+        << moveRate << " moves/s decoded\n";
+    out << "Read by number: " << lookups << " games in " << lookupUs / 1000 << " ms\n";
+    return moveRate;
+}
+
+/**
+ * @class NullBuffer
+ * @brief A stream buffer that accepts and drops everything written to it.
+ *
+ * Installed under cout while boards are rendered, so the benchmark measures
+ * building and writing the frame but not the terminal.
+ */
+class NullBuffer : public streambuf
+{
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize n) override { return n; }
+};
+
+/**
+ * @brief Runs a measured body a number of rounds and prints the time per call.
+ *
+ * @param name The label of the report line.
+ * @param rounds How many times to run the body.
+ * @param body Runs one round and returns the number of calls it made.
+ * @param out Where to write the report.
+ */
+template <class Body>
+static void timeCalls(const char* name, int rounds, Body body, ostream& out)
+{
+    uint64_t calls = 0;
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++)
+    {
+        calls += body();
+    }
+    long long ns = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+    out << name << ": " << calls << " calls  " << fixed << setprecision(1)
+        << static_cast<double>(ns) / static_cast<double>(max<uint64_t>(1, calls)) << " ns/call\n" << defaultfloat;
+}
+
+/**
+ * @brief Times the Free Play board operations over the benchmark positions.
+ *
+ * Every position is loaded into its own board first. Path checks cover
+ * every piece to every square on a line with it; moves are every piece's
+ * legal moves, each played on a board restored from a snapshot after it;
+ * notation is the from and to square of every legal move.
+ */
+uint64_t Benchmark::runMicro(int rounds, ostream& out)
+{
+    rounds = max(1, rounds);
+    const vector<string>& fens = positions();
+    vector<ChessBoard> boards(fens.size());
+    vector<BoardSnapshot> snaps;
+    vector<pair<Position, Position>> paths;
+    vector<size_t> pathBoard;
+    vector<pair<Position, Position>> moves;
+    vector<size_t> moveBoard;
+    vector<string> notation;
+    vector<const ChessPiece*> byType[6];
+    vector<size_t> pieceBoard[6];
+    const string symbols = "PNBRQK";
+
+    for (size_t b = 0; b < fens.size(); b++)
+    {
+        boards[b].loadFen(fens[b]);
+        snaps.push_back(boards[b].snapshot());
+        for (int sq = 0; sq < 64; sq++)
+        {
+            const ChessPiece* piece = boards[b].getPieceAt(sq / 8, sq % 8);
+            if (!piece)
+            {
+                continue;
+            }
+            Position from(sq / 8, sq % 8);
+            size_t type = symbols.find(static_cast<char>(toupper(piece->getSymbol())));
+            byType[type].push_back(piece);
+            pieceBoard[type].push_back(b);
+            for (int to = 0; to < 64; to++)
+            {
+                if (to != sq && Bitboards::line(sq, to))
+                {
+                    paths.push_back(make_pair(from, Position(to / 8, to % 8)));
+                    pathBoard.push_back(b);
+                }
+            }
+            for (const Position& to : boards[b].getMovesFrom(from))
+            {
+                moves.push_back(make_pair(from, to));
+                moveBoard.push_back(b);
+                notation.push_back(Chess::formatChessNotation(from));
+                notation.push_back(Chess::formatChessNotation(to));
+            }
+        }
+    }
+
+    //Results are summed so the compiler cannot drop the measured calls
+    uint64_t checksum = 0;
+    out << "Positions: " << fens.size() << "  rounds: " << rounds << "\n";
+
+    timeCalls("isPathClear", rounds, [&]()
+    {
+        for (size_t i = 0; i < paths.size(); i++)
+        {
+            checksum += boards[pathBoard[i]].isPathClear(paths[i].first, paths[i].second);
+        }
+        return static_cast<uint64_t>(paths.size());
+    }, out);
+
+    for (int type = 0; type < 6; type++)
+    {
+        string name = string("getLegalMoves ") + symbols[type];
+        timeCalls(name.c_str(), rounds, [&]()
+        {
+            for (size_t i = 0; i < byType[type].size(); i++)
+            {
+                checksum += byType[type][i]->getLegalMoves(boards[pieceBoard[type][i]]).size();
+            }
+            return static_cast<uint64_t>(byType[type].size());
+        }, out);
+    }
+
+    ChessBoard scratch;
+    timeCalls("movePiece and restore", rounds, [&]()
+    {
+        for (size_t i = 0; i < moves.size(); i++)
+        {
+            scratch.restore(snaps[moveBoard[i]]);
+            scratch.movePiece(moves[i].first, moves[i].second);
+            checksum += scratch.getVersion();
+        }
+        return static_cast<uint64_t>(moves.size());
+    }, out);
+    timeCalls("restore alone", rounds, [&]()
+    {
+        for (size_t i = 0; i < moves.size(); i++)
+        {
+            scratch.restore(snaps[moveBoard[i]]);
+            checksum += scratch.getVersion();
+        }
+        return static_cast<uint64_t>(moves.size());
+    }, out);
+
+    //The report may itself go to cout, so the sink is only in place while boards are drawn
+    NullBuffer sink;
+    timeCalls("displayBoard", rounds, [&]()
+    {
+        streambuf* console = cout.rdbuf(&sink);
+        for (const ChessBoard& board : boards)
+        {
+            board.displayBoard();
+        }
+        cout.rdbuf(console);
+        return static_cast<uint64_t>(boards.size());
+    }, out);
+
+    timeCalls("parseChessNotation", rounds, [&]()
+    {
+        for (const string& square : notation)
+        {
+            Position pos = Chess::parseChessNotation(square);
+            checksum += static_cast<uint64_t>(pos.getRow() * 8 + pos.getCol());
+        }
+        return static_cast<uint64_t>(notation.size());
+    }, out);
+
+    out << "Checksum: " << checksum << "\n";
+    return checksum;
+}
+
+/**
+ * @brief Runs the micro benchmarks and then the search benchmark with default options.
+ */
+uint64_t Benchmark::runSuite(int depth, ostream& out)
+{
+    runMicro(MICRO_ROUNDS, out);
+
+    //Reuse the search-time figure so the signature matches the total line
+    Search search;
+    uint64_t nps = 0;
+    uint64_t nodes = run(search, depth, out, &nps);
+    out << "Signature: " << nodes << "  nps: " << nps << "\n";
+    return nodes;
+}
@@ -0,0 +1,66 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Bitboard Class Implementation
+
+#include "Bitboard.h"
+
+//Directions whose square numbers increase along the ray (S, E, SE, SW).
+static const bool RAY_POSITIVE[8] = { false, true, true, false, false, false, true, true };
+
+/**
+ * @brief Computes slider attacks along one ray.
+ *
+ * The full ray is taken from the table; if it contains a blocker, the part of
+ * the ray beyond the nearest blocker is removed.
+ *
+ * @param dir The ray direction index.
+ * @param sq The origin square.
+ * @param occupied The occupied squares.
+ * @return The attacked squares along the ray, including the blocker.
+ */
+uint64_t Bitboards::rayAttacks(int dir, int sq, uint64_t occupied)
+{
+    uint64_t attacks = TABLES.ray[dir][sq];
+    uint64_t blockers = attacks & occupied;
+    if (blockers)
+    {
+        int blocker = RAY_POSITIVE[dir] ? lsb(blockers) : msb(blockers);
+        attacks ^= TABLES.ray[dir][blocker];
+    }
+    return attacks;
+}
+
+/**
+ * @brief Bishop attacks from a square given the board occupancy.
+ */
+uint64_t Bitboards::bishopAttacks(int sq, uint64_t occupied)
+{
+    return rayAttacks(4, sq, occupied) | rayAttacks(5, sq, occupied)
+        | rayAttacks(6, sq, occupied) | rayAttacks(7, sq, occupied);
+}
+
+/**
+ * @brief Rook attacks from a square given the board occupancy.
+ */
+uint64_t Bitboards::rookAttacks(int sq, uint64_t occupied)
+{
+    return rayAttacks(0, sq, occupied) | rayAttacks(1, sq, occupied)
+        | rayAttacks(2, sq, occupied) | rayAttacks(3, sq, occupied);
+}
+
+/**
+ * @brief Renders a bitboard as an 8x8 grid, eighth rank first.
+ */
+string Bitboards::toString(uint64_t b)
+{
+    string out;
+    for (int row = 0; row < 8; row++)
+    {
+        for (int col = 0; col < 8; col++)
+        {
+            out += (b & squareBit(row * 8 + col)) ? 'x' : '.';
+        }
+        out += '\n';
+    }
+    return out;
+}
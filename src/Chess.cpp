@@ -1,363 +1,989 @@
-//Qusay Edkymish
-//Dec/1/2024
-//Chess Class Implementation
-
-#include "Chess.h"
-
-/**
- * @brief Constructor for the Chess class.
- *
- * Initializes the Chess instance and sets up the game environment.
- */
-Chess::Chess() {}
-
-/**
- * @brief Displays a menu header with the given name.
- *
- * Creates a visually appealing header for menus with centered titles and borders.
- *
- * @param name The name of the menu to display.
- */
-void Chess::menuName(const string& name) const
-{
-	//Define a minimum width for the title box
-	int minWidth = 30;  //Set a minimum width to keep borders wide enough
-	int totalWidth = max(static_cast<int>(name.size()) + 8, minWidth);  //Ensure padding, minimum width
-
-	//Calculate padding on each side for centering
-	int padding = (totalWidth - static_cast<int>(name.size())) / 2;
-
-	//Top border
-	cout << "\n" << string(totalWidth, '=') << "\n";
-
-	//Centered title with padding
-	cout << string(padding, ' ') << name << string(padding, ' ');
-
-	//If the title length is odd, add one extra space for alignment
-	if (static_cast<int>(name.size()) % 2 != 0)
-	{
-		cout << " ";
-	}
-
-	cout << "\n";
-
-	//Bottom border
-	cout << string(totalWidth, '=') << "\n\n";
-}
-
-/**
- * @brief Displays the program header with ASCII art and a welcome message.
- *
- * Prompts the user to start the game.
- */
-void Chess::displayHeader() const
-{
-	//ASCII art __By Alefith 22.02.95__
-	cout << R"(
-                                                        ::
-                                            _()_       _::_
-                                  _O      _/____\_   _/____\_
-           _  _  _     ^^__      / //\    \      /   \      /
-          | || || |   /  - \_   {     }    \____/     \____/
-          |_______| <|    __<    \___/     (____)     (____)
-    _     \__ ___ / <|    \      (___)      |  |       |  |
-   (_)     |___|_|  <|     \      |_|       |__|       |__|
-  (___)    |_|___|  <|______\    /   \     /    \     /    \
-  _|_|_    |___|_|   _|____|_   (_____)   (______)   (______)
- (_____)  (_______) (________) (_______) (________) (________)
- /_____\  /_______\ /________\ /_______\ /________\ /________\
-    )" << "\n";
-	
-	//Prompt user to start the program.
-	cout << "Welcome to the Chess Game! Press any key to start...\n";
-	cin.get();
-}
-
-/**
- * @brief Displays the main menu and handles user navigation.
- *
- * The main menu allows the user to:
- * - Start a game.
- * - View program information.
- * - Exit the program.
- */
-void Chess::mainMenu()
-{
-	//Variable to store the user's menu selection.
-	int choice;
-
-	//Main menu loop
-	while (true)
-	{
-		//Print out menu name
-		menuName("Main Menu");
-
-		//Display menu options
-		cout << "1. Start a Game\n";
-		cout << "2. About\n";
-		//cout << "3. Options\n";
-		cout << "0. Quit\n";
-
-
-		while (true)
-		{
-			cout << "Enter your choice: ";
-			if (!(cin >> choice) || choice > 2 || choice < 0)
-			{
-				cin.clear(); //Clear the error state
-				cin.ignore(numeric_limits<streamsize>::max(), '\n'); //Ignore any remaining invalid input
-				cout << "Invalid input. Please enter a number from 0 to 2.\n";
-			}
-			//Valid input
-			else
-			{
-				break;
-			}
-		}
-
-		//Choices
-		switch (choice)
-		{
-		case 1:
-			gameMenu();
-			break;
-
-		case 2:
-			aboutMenu();
-			break;
-
-		case 0:
-			cout << "\nThanks for playing. Good bye!\n";
-			return;
-
-		default:
-			cout << "Invalid input. Enter a valid choice (0 to 2.)";
-			break;
-		}
-	}
-}
-
-/**
- * @brief Displays the game menu and handles game mode selection.
- *
- * Currently supports Free Play mode. Future updates will add more modes.
- */
-void Chess::gameMenu()
-{
-	int choice;		//Variable to store the user's menu selection.
-
-	//Main menu loop
-	while (true)
-	{
-		//Print out menu name
-		menuName("Game Menu");
-
-		//Display menu options
-		cout << "1. Free Play\n";
-		//cout << "2. 1v1\n";
-		//cout << "3. 1vBot\n";
-		cout << "0. Back to main menu\n";
-
-
-		while (true)
-		{
-			cout << "Choose game mode: ";
-			if (!(cin >> choice) || choice > 1 || choice < 0)
-			{
-				cin.clear(); //Clear the error state
-				cin.ignore(numeric_limits<streamsize>::max(), '\n'); //Ignore any remaining invalid input
-				cout << "Invalid input. Please enter a number from 0 to 1.\n";
-			}
-			else
-			{
-				//Valid input
-				break; 
-			}
-		}
-
-		//Choices
-		switch (choice)
-		{
-		case 1:
-			freePlay();
-			break;
-
-		case 0:
-			return;
-
-		default:
-			cout << "Invalid input. Enter a valid choice (0 to 1.)";
-			break;
-		}
-	}
-}
-
-/**
- * @brief Parses chess notation into a Position object.
- *
- * Converts a string like "e4" into the corresponding row and column indices.
- *
- * @param notation The chess notation string to parse.
- * @return A Position object representing the parsed location.
- */
-Position Chess::parseChessNotation(const string& notation) const 
-{
-	int col = notation[0] - 'a';          //Convert 'a'-'h' to 0-7
-	int row = (notation[1] - '0') - 1;	  //Convert to zero index
-	return Position(row, col);
-}
-
-/**
- * @brief Converts a Position object into chess notation.
- *
- * Converts board indices into human-readable chess notation (e.g., "e4").
- *
- * @param pos The Position object to convert.
- * @return A string representing the chess notation.
- */
-string Chess::formatChessNotation(const Position& pos) const 
-{
-	char col = 'a' + pos.getCol();        //Convert 0-7 to 'a'-'h'
-	char row = '1' + pos.getRow();        //Convert to zero index
-	return string(1, col) + string(1, row);
-}
-
-
-/**
- * @brief Starts the Free Play mode.
- *
- * Allows the user to move pieces freely and view legal moves for each piece.
- */
-void Chess::freePlay() 
-{
-	//Instructions and mode information
-	cout << "\nInstructions:\n";
-	cout << ". Enter a position (e.g., 'e2') to see the legal moves for a piece.\n";
-	cout << ". Enter a move command (e.g., 'e2e4') to move a piece.\n";
-	cout << ". Enter 'q' at any time to quit the game.\n";
-	cout << string(50, '=') << "\n";
-
-	while (true) 
-	{
-		cout << "\n";
-
-		//Display the board
-		chessBoard.displayBoard();
-
-		//Prompt the user
-		cout << "\nEnter your move ('e2' for legal moves, 'e2e4' to move, or 'q' to quit): ";
-		string input;
-		cin >> input;
-
-		if (input == "q") 
-		{
-			cout << "\nExiting Free Play Mode.\n";
-
-			//Reset the board after quitting
-			chessBoard.initializeBoard();
-			break;
-		}
-
-		if (input.length() == 2) 
-		{
-			Position pos = parseChessNotation(input);
-			const ChessPiece* piece = chessBoard.getPieceAt(pos.getRow(), pos.getCol());
-
-			if (!piece) 
-			{
-				cout << "\nNo piece at " << input << ". Try again.\n";
-			}
-			else 
-			{
-				cout << "\n";
-				chessBoard.displayLegalMoves(pos);
-				cout << "\nLegal moves for " << input << ": ";
-				vector<Position> moves = piece->getLegalMoves(chessBoard);
-				for (const Position& move : moves) 
-				{
-					cout << formatChessNotation(move) << " ";
-				}
-				cout << endl;
-			}
-		}
-		else if (input.length() == 4) 
-		{
-			Position from = parseChessNotation(input.substr(0, 2));
-			Position to = parseChessNotation(input.substr(2, 2));
-			ChessPiece* piece = const_cast<ChessPiece*>(chessBoard.getPieceAt(from.getRow(), from.getCol()));
-
-			if (!piece) 
-			{
-				cout << "\nNo piece at " << input.substr(0, 2) << ". Try again.\n";
-			}
-			else 
-			{
-				vector<Position> moves = piece->getLegalMoves(chessBoard);
-				if (find(moves.begin(), moves.end(), to) != moves.end()) 
-				{
-					chessBoard.movePiece(from, to);
-					cout << "\nMoved " << piece->getSymbol() << " to " << input.substr(2, 2) << ".\n";
-				}
-				else 
-				{
-					cout << "\nIllegal move for " << piece->getSymbol() << ". Try again.\n";
-				}
-			}
-		}
-		else 
-		{
-			cout << "\nInvalid input. Try again.\n";
-		}
-	}
-}
-
-/**
- * @brief Displays the About menu.
- *
- * Provides details about the program, its purpose, and its features.
- */
-void Chess::aboutMenu()
-{
-	//Print Menu name
-	menuName("About This Program");
-
-	//Program information 
-	cout << "Program Name: The Chess Game\n";
-	cout << "Version: 0.1.0\n";
-	cout << "Developer: Qusay Edkymish\n";
-
-	//Purpose of the program
-	cout << "\nPurpose:\n";
-	cout << "- This program is the final project for the CSIS-297 Intermediate C++ Programming course at Grossmont College.\n";
-	cout << "- It demonstrates the application of object-oriented programming principles, including inheritance, polymorphism, and encapsulation.\n";
-	cout << "- The project serves as both a learning experience and a functional chess game simulation.\n";
-	cout << "- It applies concepts learned throughout the semester, building on skills developed in previous projects.\n";
-
-	//Features of the program
-	cout << "\nFeatures:\n";
-	cout << "- Full implementation of chess rules for all pieces (Pawn, Rook, Knight, Bishop, Queen, King).\n";
-	cout << "- Accurate handling of legal moves, including diagonal captures and two-step pawn moves.\n";
-	cout << "- Board visualization with an intuitive interface.\n";
-	cout << "- Support for Free Play mode.\n";
-	cout << "- Modular design that separates game logic from the UI.\n";	
-
-	//Upcoming features for program
-	cout << "\nUpcoming Features:\n";
-	cout << "- Add a colorful, visually appealing interface to enhance user experience.\n";
-	cout << "- Support for 1v1 multiplayer mode and AI-based opponents.\n";
-	cout << "- Add an undo/redo system for moves.\n";
-	cout << "- Add check mate move, and special move like: En passant, pawn promotion logic, and castling.\n";
-	cout << "- Advanced options menu for customization (e.g., board colors, timer settings).\n";
-	cout << "- Save and load game functionality for ongoing matches.\n";
-	cout << "- And more.....\n";
-
-	//End of the About menu
-	cout << "\nThank you for playing the Chess Game. Enjoy your experience!\n\n";
-}
-
-/**
- * @brief Destructor for the Chess class.
- *
- * Cleans up resources and finalizes the game.
- */
-Chess::~Chess() {}
\ No newline at end of file
+//Qusay Edkymish
+//Dec/1/2024
+//Chess Class Implementation
+
+#include "Chess.h"
+#include "Benchmark.h"
+#include "Profiler.h"
+#include <cctype>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+
+/**
+ * @brief Constructor for the Chess class.
+ *
+ * Initializes the Chess instance and sets up the game environment.
+ */
+Chess::Chess()
+{
+	search.setTablebase(&tablebase);
+}
+
+/**
+ * @brief Displays a menu header with the given name.
+ *
+ * Creates a visually appealing header for menus with centered titles and borders.
+ *
+ * @param name The name of the menu to display.
+ */
+void Chess::menuName(const string& name) const
+{
+	//Define a minimum width for the title box
+	int minWidth = 30;  //Set a minimum width to keep borders wide enough
+	int totalWidth = max(static_cast<int>(name.size()) + 8, minWidth);  //Ensure padding, minimum width
+
+	//Calculate padding on each side for centering
+	int padding = (totalWidth - static_cast<int>(name.size())) / 2;
+
+	//Top border
+	cout << "\n" << string(totalWidth, '=') << "\n";
+
+	//Centered title with padding
+	cout << string(padding, ' ') << name << string(padding, ' ');
+
+	//If the title length is odd, add one extra space for alignment
+	if (static_cast<int>(name.size()) % 2 != 0)
+	{
+		cout << " ";
+	}
+
+	cout << "\n";
+
+	//Bottom border
+	cout << string(totalWidth, '=') << "\n\n";
+}
+
+/**
+ * @brief Displays the program header with ASCII art and a welcome message.
+ *
+ * Prompts the user to start the game.
+ */
+void Chess::displayHeader() const
+{
+	//ASCII art __By Alefith 22.02.95__
+	cout << R"(
+                                                        ::
+                                            _()_       _::_
+                                  _O      _/____\_   _/____\_
+           _  _  _     ^^__      / //\    \      /   \      /
+          | || || |   /  - \_   {     }    \____/     \____/
+          |_______| <|    __<    \___/     (____)     (____)
+    _     \__ ___ / <|    \      (___)      |  |       |  |
+   (_)     |___|_|  <|     \      |_|       |__|       |__|
+  (___)    |_|___|  <|______\    /   \     /    \     /    \
+  _|_|_    |___|_|   _|____|_   (_____)   (______)   (______)
+ (_____)  (_______) (________) (_______) (________) (________)
+ /_____\  /_______\ /________\ /_______\ /________\ /________\
+    )" << "\n";
+	
+	//Prompt user to start the program.
+	cout << "Welcome to the Chess Game! Press any key to start...\n";
+	cin.get();
+}
+
+/**
+ * @brief Displays the main menu and handles user navigation.
+ *
+ * The main menu allows the user to:
+ * - Start a game.
+ * - View program information.
+ * - Exit the program.
+ */
+void Chess::mainMenu()
+{
+	//Variable to store the user's menu selection.
+	int choice;
+
+	//Main menu loop
+	while (true)
+	{
+		//Print out menu name
+		menuName("Main Menu");
+
+		//Display menu options
+		cout << "1. Start a Game\n";
+		cout << "2. About\n";
+		//cout << "3. Options\n";
+		cout << "0. Quit\n";
+
+
+		while (true)
+		{
+			cout << "Enter your choice: ";
+			if (!(cin >> choice) || choice > 2 || choice < 0)
+			{
+				cin.clear(); //Clear the error state
+				cin.ignore(numeric_limits<streamsize>::max(), '\n'); //Ignore any remaining invalid input
+				cout << "Invalid input. Please enter a number from 0 to 2.\n";
+			}
+			//Valid input
+			else
+			{
+				break;
+			}
+		}
+
+		//Choices
+		switch (choice)
+		{
+		case 1:
+			gameMenu();
+			break;
+
+		case 2:
+			aboutMenu();
+			break;
+
+		case 0:
+			cout << "\nThanks for playing. Good bye!\n";
+			return;
+
+		default:
+			cout << "Invalid input. Enter a valid choice (0 to 2.)";
+			break;
+		}
+	}
+}
+
+/**
+ * @brief Displays the game menu and handles game mode selection.
+ *
+ * Currently supports Free Play mode. Future updates will add more modes.
+ */
+void Chess::gameMenu()
+{
+	int choice;		//Variable to store the user's menu selection.
+
+	//Main menu loop
+	while (true)
+	{
+		//Print out menu name
+		menuName("Game Menu");
+
+		//Display menu options
+		cout << "1. Free Play\n";
+		//cout << "2. 1v1\n";
+		//cout << "3. 1vBot\n";
+		cout << "0. Back to main menu\n";
+
+
+		while (true)
+		{
+			cout << "Choose game mode: ";
+			if (!(cin >> choice) || choice > 1 || choice < 0)
+			{
+				cin.clear(); //Clear the error state
+				cin.ignore(numeric_limits<streamsize>::max(), '\n'); //Ignore any remaining invalid input
+				cout << "Invalid input. Please enter a number from 0 to 1.\n";
+			}
+			else
+			{
+				//Valid input
+				break; 
+			}
+		}
+
+		//Choices
+		switch (choice)
+		{
+		case 1:
+			freePlay();
+			break;
+
+		case 0:
+			return;
+
+		default:
+			cout << "Invalid input. Enter a valid choice (0 to 1.)";
+			break;
+		}
+	}
+}
+
+/**
+ * @brief Parses chess notation into a Position object.
+ *
+ * Converts a string like "e4" into the corresponding row and column indices.
+ *
+ * @param notation The chess notation string to parse.
+ * @return A Position object representing the parsed location.
+ */
+Position Chess::parseChessNotation(const string& notation)
+{
+	int col = notation[0] - 'a';          //Convert 'a'-'h' to 0-7
+	int row = '8' - notation[1];		  //Rank 8 is row 0
+	return Position(row, col);
+}
+
+/**
+ * @brief Converts a Position object into chess notation.
+ *
+ * Converts board indices into human-readable chess notation (e.g., "e4").
+ *
+ * @param pos The Position object to convert.
+ * @return A string representing the chess notation.
+ */
+string Chess::formatChessNotation(const Position& pos)
+{
+	char col = 'a' + pos.getCol();        //Convert 0-7 to 'a'-'h'
+	char row = '8' - pos.getRow();        //Row 0 is rank 8
+	return string(1, col) + string(1, row);
+}
+
+/**
+ * @brief Checks whether two characters of a command name a square, a file a-h then a rank 1-8.
+ *
+ * @param text The command.
+ * @param at Where the square name starts.
+ */
+static bool isSquareName(const string& text, size_t at)
+{
+	return text.length() >= at + 2 && text[at] >= 'a' && text[at] <= 'h' && text[at + 1] >= '1' && text[at + 1] <= '8';
+}
+
+/**
+ * @brief Checks whether a command is a move, with or without a promotion letter.
+ *
+ * Named commands of four or five letters ("book", "heat", "reset") are not
+ * moves, so both squares are checked.
+ *
+ * @param text The command, e.g., "e2e4" or "e7e8n".
+ * @return True for two squares, optionally followed by q, r, b or n.
+ */
+static bool isMoveCommand(const string& text)
+{
+	if (!isSquareName(text, 0) || !isSquareName(text, 2))
+	{
+		return false;
+	}
+	return text.length() == 4 || (text.length() == 5 && strchr("qrbnQRBN", text[4]) != nullptr);
+}
+
+
+/**
+ * @brief Starts the Free Play mode.
+ *
+ * Allows the user to move pieces freely and view legal moves for each piece.
+ * Moves alternate between the colors and may not leave the mover's king in check.
+ */
+void Chess::freePlay() 
+{
+	//Instructions and mode information
+	cout << "\nInstructions:\n";
+	cout << ". Enter a position (e.g., 'e2') to see the legal moves for a piece.\n";
+	cout << ". Enter a move command (e.g., 'e2e4') to move a piece; add q, r, b or n to choose a promotion (e.g., 'e7e8n').\n";
+	cout << ". Enter 'go depth 6' to let the engine search the board, 'set' to list its options.\n";
+	cout << ". Enter 'fen' to show or load a position, 'perft 4' to count moves, 'bench' to time the engine.\n";
+	cout << ". Enter 'hashsave <file>' / 'hashload <file>' to keep the engine's analysis between sessions.\n";
+	cout << ". Enter 'book <file>' to open a Polyglot opening book for 'go', 'book' to list its moves.\n";
+	cout << ". Enter 'tb gen KQK' to build an endgame table for the engine, 'tb probe' to look the board up.\n";
+	cout << ". Enter 'redraw on' to keep the board in place and redraw only changed squares (ANSI terminals).\n";
+	cout << ". Enter 'heat on' to show which side controls each square, 'heat off' for the plain board.\n";
+	cout << ". Enter 'q' at any time to quit the game.\n";
+	cout << string(50, '=') << "\n";
+
+	while (true) 
+	{
+		cout << "\n";
+
+		//Display the board
+		chessBoard.displayBoard();
+
+		//Prompt the user
+		cout << "\nEnter your move ('e2' for legal moves, 'e2e4' to move, or 'q' to quit): ";
+		string input;
+		cin >> input;
+		PROFILE_SCOPE("freePlay.dispatch");
+
+		if (input == "q") 
+		{
+			cout << "\nExiting Free Play Mode.\n";
+
+			//Reset the board and display after quitting
+			chessBoard.setAnsiRedraw(false);
+			chessBoard.setHeatmap(false);
+			chessBoard.initializeBoard();
+			break;
+		}
+
+		if (input == "go" || input == "fen" || input == "perft" || input == "set" || input == "bench"
+			|| input == "hashsave" || input == "hashload" || input == "book" || input == "tb")
+		{
+			string arguments;
+			getline(cin, arguments);
+			cout << "\n";
+			engineCommand(input, arguments);
+		}
+		else if (input == "redraw")
+		{
+			string mode;
+			cin >> mode;
+			chessBoard.setAnsiRedraw(mode == "on");
+		}
+		else if (input == "heat")
+		{
+			string mode;
+			cin >> mode;
+			chessBoard.setHeatmap(mode == "on");
+		}
+		else if (input.length() == 2 && isSquareName(input, 0)) 
+		{
+			Position pos = parseChessNotation(input);
+			const ChessPiece* piece = chessBoard.getPieceAt(pos.getRow(), pos.getCol());
+
+			if (!piece) 
+			{
+				cout << "\nNo piece at " << input << ". Try again.\n";
+			}
+			else 
+			{
+				cout << "\n";
+				chessBoard.displayLegalMoves(pos);
+				cout << "\nLegal moves for " << input << ": ";
+				vector<Position> moves = chessBoard.getMovesFrom(pos);
+				for (const Position& move : moves) 
+				{
+					cout << formatChessNotation(move) << " ";
+				}
+				cout << endl;
+
+				//Book moves of this piece, next to its legal moves
+				if (book.isOpen())
+				{
+					vector<BookMove> bookMoves = legalBookMoves();
+					int total = 0;
+					for (const BookMove& move : bookMoves)
+					{
+						total += move.weight;
+					}
+					cout << "Book moves for " << input << ": ";
+					for (const BookMove& move : bookMoves)
+					{
+						if (move.move.compare(0, 2, input) == 0)
+						{
+							cout << move.move.substr(2) << " (" << (total ? move.weight * 100 / total : 0) << "%) ";
+						}
+					}
+					cout << endl;
+				}
+			}
+		}
+		else if (isMoveCommand(input)) 
+		{
+			Position from = parseChessNotation(input.substr(0, 2));
+			Position to = parseChessNotation(input.substr(2, 2));
+			ChessPiece* piece = const_cast<ChessPiece*>(chessBoard.getPieceAt(from.getRow(), from.getCol()));
+
+			if (!piece) 
+			{
+				cout << "\nNo piece at " << input.substr(0, 2) << ". Try again.\n";
+			}
+			else 
+			{
+				if (chessBoard.isLegal(from, to)) 
+				{
+					char symbol = piece->getSymbol();
+					chessBoard.movePiece(from, to, input.length() == 5 ? input[4] : 'Q');
+					cout << "\nMoved " << symbol << " to " << input.substr(2, 2) << ".\n";
+				}
+				else if (piece->getColor() != chessBoard.getSideToMove())
+				{
+					cout << "\nIt is " << chessBoard.getSideToMove() << "'s move. Try again.\n";
+				}
+				else 
+				{
+					cout << "\nIllegal move for " << piece->getSymbol() << ". Try again.\n";
+				}
+			}
+		}
+		else 
+		{
+			cout << "\nInvalid input. Try again.\n";
+		}
+	}
+}
+
+/**
+ * @brief Runs an engine command on the current board.
+ *
+ * The board is handed to the engine as FEN, so the engine sees the same
+ * side to move, castling rights and en passant square as the game.
+ *
+ * @param command The command word.
+ * @param arguments The rest of the input line.
+ * @return True if the command was recognised; otherwise, false.
+ */
+bool Chess::engineCommand(const string& command, const string& arguments)
+{
+	istringstream args(arguments);
+
+	if (command == "fen")
+	{
+		string fen;
+		getline(args >> ws, fen);
+		if (fen.empty())
+		{
+			cout << chessBoard.toFen() << "\n";
+		}
+		else if (!chessBoard.loadFen(fen))
+		{
+			cout << "Invalid FEN.\n";
+		}
+		return true;
+	}
+
+	if (command == "set")
+	{
+		string name, value;
+		if (!(args >> name >> value))
+		{
+			cout << search.describeOptions() << "\n";
+		}
+		else if (!search.setOption(name, value))
+		{
+			cout << "Cannot set " << name << " to " << value << ".\n";
+		}
+		return true;
+	}
+
+	if (command == "hashsave" || command == "hashload")
+	{
+		string path;
+		getline(args >> ws, path);
+		if (path.empty())
+		{
+			cout << "Usage: " << command << " <file>\n";
+		}
+		else if (command == "hashsave")
+		{
+			cout << (search.getTable().save(path) ? "Saved hash to " : "Could not write ") << path << "\n";
+		}
+		else
+		{
+			string error;
+			if (search.getTable().load(path, error))
+			{
+				cout << "Loaded " << search.getTable().sizeMb() << " MB hash from " << path << "\n";
+			}
+			else
+			{
+				cout << "Could not load hash: " << error << "\n";
+			}
+		}
+		return true;
+	}
+
+	if (command == "book")
+	{
+		string path;
+		getline(args >> ws, path);
+		if (path == "off")
+		{
+			book.close();
+			cout << "Book closed.\n";
+		}
+		else if (!path.empty())
+		{
+			string error;
+			if (book.open(path, error))
+			{
+				cout << "Opened book " << path << ": " << book.size() << " entries\n";
+			}
+			else
+			{
+				cout << "Could not open book: " << error << "\n";
+			}
+		}
+		else if (!book.isOpen())
+		{
+			cout << "No book open. Usage: book <file> | book off\n";
+		}
+		else
+		{
+			vector<BookMove> moves = legalBookMoves();
+			int total = 0;
+			for (const BookMove& move : moves)
+			{
+				total += move.weight;
+			}
+			if (moves.empty())
+			{
+				cout << "Position not in book.\n";
+			}
+			for (const BookMove& move : moves)
+			{
+				cout << move.move << "  weight " << move.weight << "  (" << (total ? move.weight * 100 / total : 0) << "%)\n";
+			}
+		}
+		return true;
+	}
+
+	if (command == "tb")
+	{
+		string word, value;
+		args >> word >> value;
+		if (word == "gen" && !value.empty())
+		{
+			int threads = 0;
+			args >> threads;
+			string error;
+			if (!tablebase.generate(value, threads, cout, error))
+			{
+				cout << "Could not generate " << value << ": " << error << "\n";
+			}
+		}
+		else if (word == "load")
+		{
+			int loaded = tablebase.load(value);
+			cout << "Loaded " << loaded << " tables; " << tablebase.tableCount() << " in use.\n";
+		}
+		else if (word == "verify" && !value.empty())
+		{
+			int samples = 200, depth = 5;
+			args >> samples >> depth;
+			if (tablebase.verify(value, samples, depth, cout) < 0)
+			{
+				cout << value << " is not loaded.\n";
+			}
+		}
+		else if (word == "probe")
+		{
+			EngineBoard position;
+			int wdl, dtm;
+			if (!position.loadSnapshot(chessBoard.snapshot()) || !tablebase.probe(position, wdl, dtm))
+			{
+				cout << "Position not in the loaded tables.\n";
+			}
+			else if (wdl == Tablebase::TB_DRAW)
+			{
+				cout << "Draw\n";
+			}
+			else
+			{
+				cout << (wdl == Tablebase::TB_WIN ? "Win" : "Loss") << " for the side to move, mate in " << dtm << " plies\n";
+			}
+		}
+		else
+		{
+			cout << "Usage: tb gen <material> [threads] | tb load <dir> | tb probe | tb verify <material> [samples] [depth]\n";
+		}
+		return true;
+	}
+
+	if (command == "bench")
+	{
+		string word;
+		if (args >> word && word == "boards")
+		{
+			int games = 100000;
+			args >> games;
+			Benchmark::runBoards(games, cout);
+			return true;
+		}
+		if (word == "micro")
+		{
+			int rounds = Benchmark::MICRO_ROUNDS;
+			args >> rounds;
+			Benchmark::runMicro(rounds, cout);
+			return true;
+		}
+		if (word == "perft")
+		{
+			int depth = 4;
+			args >> depth;
+			Benchmark::runPerft(depth, cout);
+			return true;
+		}
+		if (word == "archive")
+		{
+			int games = 10000;
+			args >> games;
+			Benchmark::runArchive(games, "bench_archive.cga", cout);
+			return true;
+		}
+		int depth = 8;
+		if (!word.empty())
+		{
+			istringstream(word) >> depth;
+		}
+		Benchmark::run(search, depth, cout);
+		return true;
+	}
+
+	if (command != "go" && command != "perft")
+	{
+		return false;
+	}
+
+	EngineBoard position;
+	if (!position.loadSnapshot(chessBoard.snapshot()))
+	{
+		cout << "The engine needs exactly one king per side and no pawns on the back ranks.\n";
+		return true;
+	}
+
+	if (command == "perft")
+	{
+		int depth = 1;
+		args >> depth;
+		auto start = chrono::steady_clock::now();
+		uint64_t count = position.perft(depth);
+		long long ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+		cout << "perft " << depth << ": " << count << " nodes in " << ms << " ms\n";
+		return true;
+	}
+
+	//Play from the book while the game is in it, choosing among the legal entries only
+	vector<BookMove> bookMoves = book.isOpen() ? legalBookMoves() : vector<BookMove>();
+	if (!bookMoves.empty())
+	{
+		cout << "bestmove " << book.pick(bookMoves) << " (book)\n";
+		return true;
+	}
+
+	SearchLimits limits = parseLimits(args);
+	SearchResult result = search.think(position, limits);
+	cout << "bestmove " << result.bestMove.toString() << "\n";
+	return true;
+}
+
+/**
+ * @brief Gets the legal book moves of the current position.
+ *
+ * @return The moves, highest weight first.
+ */
+vector<BookMove> Chess::legalBookMoves() const
+{
+	vector<BookMove> legal;
+	for (const BookMove& move : book.probe(chessBoard.snapshot()))
+	{
+		Position from = parseChessNotation(move.move.substr(0, 2));
+		Position to = parseChessNotation(move.move.substr(2, 2));
+		if (chessBoard.isLegal(from, to))
+		{
+			legal.push_back(move);
+		}
+	}
+	return legal;
+}
+
+/**
+ * @brief Reads "go" arguments into search limits.
+ *
+ * @param args The words after "go".
+ * @return The parsed limits; depth 6 when no limit was given.
+ */
+SearchLimits Chess::parseLimits(istream& args)
+{
+	SearchLimits limits;
+	string key;
+	while (args >> key)
+	{
+		if (key == "depth")
+		{
+			args >> limits.depth;
+		}
+		else if (key == "nodes")
+		{
+			args >> limits.nodes;
+		}
+		else if (key == "movetime")
+		{
+			args >> limits.moveTime;
+		}
+		else if (key == "wtime" || key == "btime")
+		{
+			args >> limits.time[key[0] == 'w' ? WHITE : BLACK];
+		}
+		else if (key == "winc" || key == "binc")
+		{
+			args >> limits.increment[key[0] == 'w' ? WHITE : BLACK];
+		}
+		else if (key == "movestogo")
+		{
+			args >> limits.movesToGo;
+		}
+	}
+	bool timed = limits.moveTime > 0 || limits.time[WHITE] > 0 || limits.time[BLACK] > 0;
+	if (limits.nodes == 0 && !timed && limits.depth == SearchLimits().depth)
+	{
+		limits.depth = 6;
+	}
+	return limits;
+}
+
+/**
+ * @brief Quotes a string for a JSON response.
+ *
+ * @param text The text to quote.
+ * @return The text in double quotes with quotes, backslashes and control characters escaped.
+ */
+static string jsonString(const string& text)
+{
+	string quoted = "\"";
+	for (char c : text)
+	{
+		if (c == '"' || c == '\\')
+		{
+			quoted += '\\';
+			quoted += c;
+		}
+		else if (static_cast<unsigned char>(c) < 0x20)
+		{
+			quoted += ' ';
+		}
+		else
+		{
+			quoted += c;
+		}
+	}
+	return quoted + "\"";
+}
+
+/**
+ * @brief Runs one Free Play command on a board and builds its JSON response.
+ *
+ * Moves are checked with the same piece rules as Free Play. Engine
+ * commands see the board through its FEN, as in engineCommand().
+ *
+ * @param board The board the command applies to.
+ * @param engine The engine used by "go" and "set", or nullptr to refuse engine commands.
+ * @param line The command line.
+ * @param response Set to the JSON response, without a newline.
+ * @return True if the command succeeded.
+ */
+bool Chess::respond(ChessBoard& board, Search* engine, const string& line, string& response)
+{
+	PROFILE_SCOPE("respond");
+
+	auto start = chrono::steady_clock::now();
+	istringstream args(line);
+	string command;
+	args >> command;
+
+	ostringstream fields;	//Extra JSON fields, each starting with a comma
+	string error;			//Failure reason; empty on success
+
+	if (command.length() == 2 && isSquareName(command, 0))
+	{
+		Position pos = parseChessNotation(command);
+		const ChessPiece* piece = board.getPieceAt(pos.getRow(), pos.getCol());
+		if (!piece)
+		{
+			error = "no piece at " + command;
+		}
+		else
+		{
+			fields << ",\"piece\":\"" << piece->getSymbol() << "\",\"moves\":[";
+			vector<Position> moves = board.getMovesFrom(pos);
+			for (size_t i = 0; i < moves.size(); i++)
+			{
+				fields << (i ? "," : "") << "\"" << formatChessNotation(moves[i]) << "\"";
+			}
+			fields << "]";
+		}
+	}
+	else if (isMoveCommand(command))
+	{
+		Position from = parseChessNotation(command.substr(0, 2));
+		Position to = parseChessNotation(command.substr(2, 2));
+		const ChessPiece* piece = board.getPieceAt(from.getRow(), from.getCol());
+		if (!piece)
+		{
+			error = "no piece at " + command.substr(0, 2);
+		}
+		else
+		{
+			if (piece->getColor() != board.getSideToMove())
+			{
+				error = "not " + piece->getColor() + "'s move";
+			}
+			else if (!board.isLegal(from, to))
+			{
+				error = "illegal move";
+			}
+			else
+			{
+				char symbol = piece->getSymbol();
+				board.movePiece(from, to, command.length() == 5 ? command[4] : 'Q');
+				fields << ",\"piece\":\"" << symbol << "\",\"fen\":" << jsonString(board.toFen());
+			}
+		}
+	}
+	else if (command == "fen" || command == "reset")
+	{
+		string fen;
+		getline(args >> ws, fen);
+		if (command == "reset")
+		{
+			board.initializeBoard();
+		}
+		else if (!fen.empty() && !board.loadFen(fen))
+		{
+			error = "invalid FEN";
+		}
+		fields << ",\"fen\":" << jsonString(board.toFen());
+	}
+	else if ((command == "set" || command == "go") && !engine)
+	{
+		error = "engine not available";
+	}
+	else if (command == "set")
+	{
+		string name, value;
+		if ((args >> name >> value) && !engine->setOption(name, value))
+		{
+			error = "cannot set " + name + " to " + value;
+		}
+		fields << ",\"options\":" << jsonString(engine->describeOptions());
+	}
+	else if (command == "perft" || command == "go")
+	{
+		EngineBoard position;
+		if (!position.loadSnapshot(board.snapshot()))
+		{
+			error = "position not searchable";
+		}
+		else if (command == "perft")
+		{
+			int depth = 1;
+			args >> depth;
+			fields << ",\"depth\":" << depth << ",\"nodes\":" << position.perft(depth);
+		}
+		else
+		{
+			SearchResult result = engine->think(position, parseLimits(args));
+			fields << ",\"bestmove\":\"" << result.bestMove.toString() << "\""
+				<< ",\"score\":\"" << Search::formatScore(result.score) << "\""
+				<< ",\"depth\":" << result.depth << ",\"nodes\":" << result.nodes;
+		}
+	}
+	else
+	{
+		error = "unknown command";
+	}
+
+	long long us = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+	ostringstream out;
+	out << "{\"cmd\":" << jsonString(line) << ",\"ok\":" << (error.empty() ? "true" : "false");
+	if (error.empty())
+	{
+		out << fields.str();
+	}
+	else
+	{
+		out << ",\"error\":" << jsonString(error);
+	}
+	out << ",\"us\":" << us << "}";
+	response = out.str();
+	return error.empty();
+}
+
+/**
+ * @brief Runs Free Play commands from a stream without banners, menus or prompts.
+ *
+ * Output is flushed whenever no more input is already waiting, so a
+ * replayed file streams at full speed while a driver talking through a
+ * pipe still sees each response as soon as it is ready.
+ *
+ * @param in The commands, one per line.
+ * @param out Where the responses are written.
+ * @return The number of commands that failed.
+ */
+int Chess::runScript(istream& in, ostream& out)
+{
+	search.setInfoOutput(nullptr);
+	auto start = chrono::steady_clock::now();
+	int commands = 0;
+	int errors = 0;
+
+	string line;
+	while (getline(in, line))
+	{
+		if (!line.empty() && line.back() == '\r')
+		{
+			line.pop_back();
+		}
+		size_t first = line.find_first_not_of(" \t");
+		if (first == string::npos || line[first] == '#')
+		{
+			continue;
+		}
+		line = line.substr(first);
+		if (line == "q" || line == "quit")
+		{
+			break;
+		}
+
+		string response;
+		commands++;
+		if (!respond(chessBoard, &search, line, response))
+		{
+			errors++;
+		}
+		out << response << "\n";
+		if (in.rdbuf()->in_avail() <= 0)
+		{
+			out.flush();
+		}
+	}
+
+	long long us = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+	out << "{\"cmd\":\"summary\",\"ok\":" << (errors == 0 ? "true" : "false")
+		<< ",\"commands\":" << commands << ",\"errors\":" << errors << ",\"us\":" << us << "}\n";
+	out.flush();
+	search.setInfoOutput(&cout);
+	return errors;
+}
+
+/**
+ * @brief Displays the About menu.
+ *
+ * Provides details about the program, its purpose, and its features.
+ */
+void Chess::aboutMenu()
+{
+	//Print Menu name
+	menuName("About This Program");
+
+	//Program information 
+	cout << "Program Name: The Chess Game\n";
+	cout << "Version: 0.1.0\n";
+	cout << "Developer: Qusay Edkymish\n";
+
+	//Purpose of the program
+	cout << "\nPurpose:\n";
+	cout << "- This program is the final project for the CSIS-297 Intermediate C++ Programming course at Grossmont College.\n";
+	cout << "- It demonstrates the application of object-oriented programming principles, including inheritance, polymorphism, and encapsulation.\n";
+	cout << "- The project serves as both a learning experience and a functional chess game simulation.\n";
+	cout << "- It applies concepts learned throughout the semester, building on skills developed in previous projects.\n";
+
+	//Features of the program
+	cout << "\nFeatures:\n";
+	cout << "- Full implementation of chess rules for all pieces (Pawn, Rook, Knight, Bishop, Queen, King).\n";
+	cout << "- Accurate handling of legal moves, including diagonal captures and two-step pawn moves.\n";
+	cout << "- Board visualization with an intuitive interface.\n";
+	cout << "- Support for Free Play mode.\n";
+	cout << "- Modular design that separates game logic from the UI.\n";	
+
+	//Upcoming features for program
+	cout << "\nUpcoming Features:\n";
+	cout << "- Add a colorful, visually appealing interface to enhance user experience.\n";
+	cout << "- Support for 1v1 multiplayer mode and AI-based opponents.\n";
+	cout << "- Add an undo/redo system for moves.\n";
+	cout << "- Add check mate move, and special move like: En passant, pawn promotion logic, and castling.\n";
+	cout << "- Advanced options menu for customization (e.g., board colors, timer settings).\n";
+	cout << "- Save and load game functionality for ongoing matches.\n";
+	cout << "- And more.....\n";
+
+	//End of the About menu
+	cout << "\nThank you for playing the Chess Game. Enjoy your experience!\n\n";
+}
+
+/**
+ * @brief Destructor for the Chess class.
+ *
+ * Cleans up resources and finalizes the game.
+ */
+Chess::~Chess() {}
@@ -1,205 +1,1320 @@
-//Qusay Edkymish
-//Nov/17/2024
-//ChessBoard Class Implementation
-
-
-#include "ChessBoard.h"
-#include "ChessPiece.h"
-
-
-/**
- * @brief Constructor for the ChessBoard class.
- *
- * Initializes the chessboard by calling the `initializeBoard` method.
- */
-ChessBoard::ChessBoard()
-{
-    initializeBoard();
-}
-
-/**
- * @brief Initializes the chessboard with pieces in their starting positions.
- *
- * - Sets all squares to `nullptr` (empty).
- * - Places Pawns, Rooks, Knights, Bishops, Queen, and King for White (Plannig to add black soon).
- */
-void ChessBoard::initializeBoard()
-{
-    //Initialize all spaces with nullptr (empty)
-    for (int i = 0; i < SIZE; i++)
-    {
-        for (int j = 0; j < SIZE; j++)
-        {
-            board[i][j] = nullptr;
-        }
-    }
-
-    //Place white pieces (bottom side)
-    board[7][0] = make_unique<Rook>("White", Position(7, 0));
-    board[7][1] = make_unique<Knight>("White", Position(7, 1));
-    board[7][2] = make_unique<Bishop>("White", Position(7, 2));
-    board[7][3] = make_unique<Queen>("White", Position(7, 3));
-    board[7][4] = make_unique<King>("White", Position(7, 4));
-    board[7][5] = make_unique<Bishop>("White", Position(7, 5));
-    board[7][6] = make_unique<Knight>("White", Position(7, 6));
-    board[7][7] = make_unique<Rook>("White", Position(7, 7));
-
-    //Place white pawns
-    for (int j = 0; j < SIZE; j++)
-    {
-        board[6][j] = make_unique<Pawn>("White", Position(6, j));
-    }
-}
-
-/**
- * @brief Displays the chessboard, optionally highlighting specific positions.
- *
- * - Pieces are displayed using their symbols.
- * - Empty spaces are displayed as '.'.
- * - Highlighted positions (if provided) are marked with 'x'.
- *
- * @param highlightedPositions A vector of positions to highlight (e.g., legal moves). Defaults to an empty vector.
- */
-void ChessBoard::displayBoard(const vector<Position>& highlightedPositions) const
-{
-    cout << "   ";
-    for (char c = 'A'; c < 'A' + SIZE; c++) {
-        cout << setw(3) << c; // Column headers (A-H)
-    }
-    cout << endl;
-
-    for (int i = 0; i < SIZE; i++) {
-        cout << setw(2) << (i + 1) << " "; // Row numbers (1-8)
-        for (int j = 0; j < SIZE; j++) {
-            Position currentPos(i, j);
-
-            // Check if the current position is in the list of highlighted positions
-            if (find(highlightedPositions.begin(), highlightedPositions.end(), currentPos) != highlightedPositions.end()) {
-                cout << setw(3) << "x"; // Highlight position
-            }
-            else if (board[i][j]) {
-                cout << setw(3) << board[i][j]->getSymbol(); // Display piece symbol
-            }
-            else {
-                cout << setw(3) << "."; // Empty space
-            }
-        }
-        cout << endl;
-    }
-}
-
-
-/**
- * @brief Gets the chess piece at a specific position.
- *
- * @param row The row index of the position (0-7).
- * @param col The column index of the position (0-7).
- * @return A constant pointer to the ChessPiece at the specified position, or nullptr if the square is empty.
- */
-const ChessPiece* ChessBoard::getPieceAt(int row, int col) const
-{
-    if (row >= 0 && row < SIZE && col >= 0 && col < SIZE) 
-    {
-        const ChessPiece* piece = board[row][col].get();
-        return piece;
-    }
-    return nullptr;
-}
-
-/**
- * @brief Checks if the path between two positions is clear.
- *
- * This method validates that no pieces block the path between the starting and ending positions.
- *
- * @param start The starting position of the path.
- * @param end The ending position of the path.
- * @return True if the path is clear; otherwise, false.
- */
-bool ChessBoard::isPathClear(const Position& start, const Position& end) const 
-{
-    int startRow = start.getRow();
-    int startCol = start.getCol();
-    int endRow = end.getRow();
-    int endCol = end.getCol();
-
-    int rowDelta = endRow - startRow;
-    int colDelta = endCol - startCol;
-
-    //Determine the step direction
-    int rowStep = (rowDelta == 0) ? 0 : (rowDelta > 0 ? 1 : -1);
-    int colStep = (colDelta == 0) ? 0 : (colDelta > 0 ? 1 : -1);
-
-    //Check each position along the path (excluding the start and end)
-    int currentRow = startRow + rowStep;
-    int currentCol = startCol + colStep;
-
-    while (currentRow != endRow || currentCol != endCol) 
-    {
-        if (board[currentRow][currentCol] != nullptr) 
-        {
-            //Path is blocked
-            return false;
-        }
-        currentRow += rowStep;
-        currentCol += colStep;
-    }
-    //Path is clear
-    return true;
-}
-
-/**
- * @brief Moves a chess piece from one position to another.
- *
- * Updates the board to reflect the move and modifies the piece's internal position.
- *
- * @param from The starting position of the piece.
- * @param to The target position of the piece.
- */
-void ChessBoard::movePiece(const Position& from, const Position& to)
-{
-    //Get the piece at the source position
-    ChessPiece* piece = board[from.getRow()][from.getCol()].get();
-
-    //Update the piece's internal position if it exists
-    if (piece)
-    {
-        piece->setPosition(to.getRow(), to.getCol());
-    }
-
-    //Move the piece to the new position on the board
-    board[to.getRow()][to.getCol()] = move(board[from.getRow()][from.getCol()]);
-    //Clear the old position
-    board[from.getRow()][from.getCol()] = nullptr;
-}
-
-/**
- * @brief Displays all legal moves for the chess piece at a given position.
- *
- * - Legal moves are marked with 'x'.
- * - Empty spaces are marked with '.'.
- * - Piece symbols are displayed normally.
- *
- * @param piecePos The position of the piece to evaluate.
- */
-void ChessBoard::displayLegalMoves(const Position& piecePos) const
-{
-    const ChessPiece* piece = getPieceAt(piecePos.getRow(), piecePos.getCol());
-
-    if (!piece) {
-        cout << "No piece at the given position." << endl;
-        return;
-    }
-
-    // Get the legal moves for the piece
-    vector<Position> legalMoves = piece->getLegalMoves(*this);
-
-    // Use the modified displayBoard to highlight legal moves
-    displayBoard(legalMoves);
-}
-
-/**
- * @brief Destructor for the Chess class.
- *
- * Cleans up resources and finalizes the game.
- */
+//Qusay Edkymish
+//Nov/17/2024
+//ChessBoard Class Implementation
+
+
+#include "ChessBoard.h"
+#include "ChessPiece.h"
+#include "EngineBoard.h"
+#include "Profiler.h"
+#include <cctype>       //For converting piece letters between colors.
+#include <cstdlib>      //For the size of a heatmap balance.
+#include <cstring>      //For finding piece letters and copying snapshot codes.
+#include <sstream>      //For splitting FEN fields and building the heatmap.
+
+//Piece letters indexed by snapshot code - 1 (white pieces first, as in the engine)
+static const char SNAPSHOT_LETTERS[] = "PNBRQKpnbrqk";
+
+//Castling letters in the order of the snapshot's castling bits
+static const char CASTLING_LETTERS[] = "KQkq";
+
+/**
+ * @brief Gets the snapshot code of a FEN piece letter.
+ */
+static int snapshotCode(char letter)
+{
+    return static_cast<int>(strchr(SNAPSHOT_LETTERS, letter) - SNAPSHOT_LETTERS) + 1;
+}
+
+
+/**
+ * @brief Constructor for the ChessBoard class.
+ *
+ * Initializes the chessboard by calling the `initializeBoard` method.
+ */
+ChessBoard::ChessBoard() : board(), squareCodes(), pieceBits(), colorBits(), pieceSquares(), pieceCounts(), listSlot(),
+    version(0), cachedVersion(~0ULL),
+    moveCache(), ansiRedraw(false), heatmap(false), lastFrame()
+{
+    initializeBoard();
+}
+
+/**
+ * @brief Initializes the chessboard with pieces in their starting positions.
+ *
+ * - Empties the piece pool and sets all squares to `nullptr` (empty).
+ * - Places Pawns, Rooks, Knights, Bishops, Queen, and King for Black (top side) and White (bottom side).
+ * - Resets the game state: White to move, all castling rights, no en passant square.
+ */
+void ChessBoard::initializeBoard()
+{
+    //Initialize all spaces with nullptr (empty)
+    pieces.reset();
+    for (int i = 0; i < SIZE; i++)
+    {
+        for (int j = 0; j < SIZE; j++)
+        {
+            board[i][j] = nullptr;
+        }
+    }
+
+    //Place black pieces (top side)
+    board[0][0] = pieces.create<Rook>("Black", Position(0, 0));
+    board[0][1] = pieces.create<Knight>("Black", Position(0, 1));
+    board[0][2] = pieces.create<Bishop>("Black", Position(0, 2));
+    board[0][3] = pieces.create<Queen>("Black", Position(0, 3));
+    board[0][4] = pieces.create<King>("Black", Position(0, 4));
+    board[0][5] = pieces.create<Bishop>("Black", Position(0, 5));
+    board[0][6] = pieces.create<Knight>("Black", Position(0, 6));
+    board[0][7] = pieces.create<Rook>("Black", Position(0, 7));
+
+    //Place black pawns
+    for (int j = 0; j < SIZE; j++)
+    {
+        board[1][j] = pieces.create<Pawn>("Black", Position(1, j));
+    }
+
+    //Place white pieces (bottom side)
+    board[7][0] = pieces.create<Rook>("White", Position(7, 0));
+    board[7][1] = pieces.create<Knight>("White", Position(7, 1));
+    board[7][2] = pieces.create<Bishop>("White", Position(7, 2));
+    board[7][3] = pieces.create<Queen>("White", Position(7, 3));
+    board[7][4] = pieces.create<King>("White", Position(7, 4));
+    board[7][5] = pieces.create<Bishop>("White", Position(7, 5));
+    board[7][6] = pieces.create<Knight>("White", Position(7, 6));
+    board[7][7] = pieces.create<Rook>("White", Position(7, 7));
+
+    //Place white pawns
+    for (int j = 0; j < SIZE; j++)
+    {
+        board[6][j] = pieces.create<Pawn>("White", Position(6, j));
+    }
+
+    //Piece codes of the starting position, built once
+    static const BoardSnapshot start = []
+    {
+        static const char* const layout = "rnbqkbnrpppppppp" "                " "                " "PPPPPPPPRNBQKBNR";
+        BoardSnapshot codes = {};
+        for (int sq = 0; sq < SIZE * SIZE; sq++)
+        {
+            codes.setCode(sq, layout[sq] == ' ' ? 0 : snapshotCode(layout[sq]));
+        }
+        return codes;
+    }();
+    memcpy(squareCodes.squares, start.squares, sizeof(squareCodes.squares));
+    rebuildPieceSets();
+    version++;
+
+    //Reset the game state
+    sideToMove = "White";
+    castlingRights = "KQkq";
+    enPassantSquare = "-";
+    halfmoveClock = 0;
+    fullmoveNumber = 1;
+}
+
+//Text layout of the board: a header line and one line per rank, all LINE_WIDTH
+//characters including the newline. Each square takes three characters.
+static const int LINE_WIDTH = 28;
+static const int LABEL_WIDTH = 3;
+static const int CELL_WIDTH = 3;
+
+/**
+ * @brief Gets the character drawn for a square.
+ */
+char ChessBoard::squareSymbol(int row, int col, uint64_t highlightMask) const
+{
+    if (highlightMask & (1ULL << (row * SIZE + col)))
+    {
+        return 'x';
+    }
+    if (!board[row][col])
+    {
+        return '.';
+    }
+    char symbol = board[row][col]->getSymbol();
+    return board[row][col]->getColor() == "Black" ? static_cast<char>(tolower(symbol)) : symbol;
+}
+
+/**
+ * @brief Renders the whole board into one preformatted text buffer.
+ *
+ * The labels and spacing never change, so they are built once into a
+ * template and only the 64 square characters are filled in per frame.
+ */
+string ChessBoard::renderBoard(uint64_t highlightMask) const
+{
+    static const string layout = []
+    {
+        string text(LINE_WIDTH * (SIZE + 1), ' ');
+        for (int j = 0; j < SIZE; j++)
+        {
+            text[LABEL_WIDTH + CELL_WIDTH * j + 2] = static_cast<char>('A' + j); // Column headers (A-H)
+        }
+        for (int i = 0; i < SIZE; i++)
+        {
+            text[LINE_WIDTH * (i + 1) + 1] = static_cast<char>('0' + SIZE - i); // Rank numbers (8-1)
+        }
+        for (int line = 1; line <= SIZE + 1; line++)
+        {
+            text[LINE_WIDTH * line - 1] = '\n';
+        }
+        return text;
+    }();
+
+    string text = layout;
+    for (int i = 0; i < SIZE; i++)
+    {
+        for (int j = 0; j < SIZE; j++)
+        {
+            text[LINE_WIDTH * (i + 1) + LABEL_WIDTH + CELL_WIDTH * j + 2] = squareSymbol(i, j, highlightMask);
+        }
+    }
+    return text;
+}
+
+/**
+ * @brief Renders the ANSI escape sequence that updates the last frame in place.
+ */
+string ChessBoard::renderAnsiFrame(uint64_t highlightMask) const
+{
+    string out;
+    if (lastFrame[0] == 0)
+    {
+        //Home and clear, draw everything, then pin the board above a scroll region
+        out = "\x1b[H\x1b[2J" + renderBoard(highlightMask);
+        out += "\x1b[" + to_string(SIZE + 3) + "r\x1b[" + to_string(SIZE + 3) + ";1H";
+        for (int i = 0; i < SIZE; i++)
+        {
+            for (int j = 0; j < SIZE; j++)
+            {
+                lastFrame[i * SIZE + j] = squareSymbol(i, j, highlightMask);
+            }
+        }
+        return out;
+    }
+
+    //Save the cursor, rewrite the changed squares by absolute position, restore it
+    out = "\x1b" "7";
+    for (int i = 0; i < SIZE; i++)
+    {
+        for (int j = 0; j < SIZE; j++)
+        {
+            char symbol = squareSymbol(i, j, highlightMask);
+            if (symbol != lastFrame[i * SIZE + j])
+            {
+                out += "\x1b[" + to_string(i + 2) + ";" + to_string(LABEL_WIDTH + CELL_WIDTH * j + 3) + "H";
+                out += symbol;
+                lastFrame[i * SIZE + j] = symbol;
+            }
+        }
+    }
+    out += "\x1b" "8";
+    return out;
+}
+
+/**
+ * @brief Displays the chessboard, optionally highlighting specific positions.
+ *
+ * - Pieces are displayed using their symbols (lowercase for Black).
+ * - Empty spaces are displayed as '.'.
+ * - Highlighted positions (if provided) are marked with 'x'.
+ * - Row 0 is the eighth rank, so rank labels count down from 8.
+ *
+ * The highlighted positions are folded into a 64-bit mask first, so each
+ * square is tested with one bit instead of a search of the list, and the
+ * frame reaches the terminal in a single write.
+ *
+ * @param highlightedPositions A vector of positions to highlight (e.g., legal moves). Defaults to an empty vector.
+ */
+void ChessBoard::displayBoard(const vector<Position>& highlightedPositions) const
+{
+    uint64_t highlightMask = 0;
+    for (const Position& pos : highlightedPositions)
+    {
+        if (pos.getRow() >= 0 && pos.getRow() < SIZE && pos.getCol() >= 0 && pos.getCol() < SIZE)
+        {
+            highlightMask |= 1ULL << (pos.getRow() * SIZE + pos.getCol());
+        }
+    }
+    displayMask(highlightMask);
+}
+
+/**
+ * @brief Displays the chessboard with the squares of a mask highlighted.
+ */
+void ChessBoard::displayMask(uint64_t highlightMask) const
+{
+    PROFILE_SCOPE("displayBoard");
+
+    string frame;
+    if (heatmap && highlightMask == 0)
+    {
+        frame = renderHeatmap();
+
+        //The heatmap is plain text, so the next ANSI frame has to redraw everything
+        fill(begin(lastFrame), end(lastFrame), 0);
+    }
+    else
+    {
+        frame = ansiRedraw ? renderAnsiFrame(highlightMask) : renderBoard(highlightMask);
+    }
+    cout.write(frame.data(), static_cast<streamsize>(frame.size()));
+    cout.flush();
+}
+
+/**
+ * @brief Turns in-place ANSI redrawing on or off.
+ */
+void ChessBoard::setAnsiRedraw(bool enabled)
+{
+    if (ansiRedraw && !enabled)
+    {
+        //Give the whole screen back to normal scrolling
+        cout << "\x1b[r" << flush;
+    }
+    ansiRedraw = enabled;
+    fill(begin(lastFrame), end(lastFrame), 0);
+}
+
+
+/**
+ * @brief Turns the heatmap display on or off.
+ */
+void ChessBoard::setHeatmap(bool enabled)
+{
+    heatmap = enabled;
+
+    //The heatmap is drawn as plain text, so an ANSI board has to start over
+    fill(begin(lastFrame), end(lastFrame), 0);
+}
+
+/**
+ * @brief Renders the board with each square's control balance next to its piece.
+ *
+ * Each cell is the square's piece (or '.') followed by White's attackers
+ * minus Black's, left blank when the square is balanced.
+ */
+string ChessBoard::renderHeatmap() const
+{
+    AttackMap map = getAttackMap();
+    ostringstream text;
+    text << "   ";
+    for (int j = 0; j < SIZE; j++)
+    {
+        text << "  " << static_cast<char>('A' + j) << "  ";
+    }
+    text << "\n";
+    for (int i = 0; i < SIZE; i++)
+    {
+        text << " " << (SIZE - i) << " ";
+        for (int j = 0; j < SIZE; j++)
+        {
+            int net = map.count(WHITE, i * SIZE + j) - map.count(BLACK, i * SIZE + j);
+            text << "  " << squareSymbol(i, j, 0);
+            if (net == 0)
+            {
+                text << "  ";
+            }
+            else
+            {
+                text << (net > 0 ? "+" : "-") << abs(net);
+            }
+        }
+        text << "\n";
+    }
+    text << "   (+n: White attacks the square n more times than Black; -n: Black does)\n";
+    return text.str();
+}
+
+/**
+ * @brief Gets the squares each side attacks and the attacker counts of every square.
+ */
+AttackMap ChessBoard::getAttackMap() const
+{
+    AttackMap map;
+    map.build(pieceBits);
+    return map;
+}
+
+/**
+ * @brief Gets the chess piece at a specific position.
+ *
+ * @param row The row index of the position (0-7).
+ * @param col The column index of the position (0-7).
+ * @return A constant pointer to the ChessPiece at the specified position, or nullptr if the square is empty.
+ */
+const ChessPiece* ChessBoard::getPieceAt(int row, int col) const
+{
+    if (row >= 0 && row < SIZE && col >= 0 && col < SIZE) 
+    {
+        const ChessPiece* piece = board[row][col];
+        return piece;
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Checks if the path between two positions is clear.
+ *
+ * This method validates that no pieces block the path between the starting and ending positions.
+ *
+ * @param start The starting position of the path.
+ * @param end The ending position of the path.
+ * @return True if the path is clear; otherwise, false.
+ */
+bool ChessBoard::isPathClear(const Position& start, const Position& end) const 
+{
+    int startRow = start.getRow();
+    int startCol = start.getCol();
+    int endRow = end.getRow();
+    int endCol = end.getCol();
+
+    int rowDelta = endRow - startRow;
+    int colDelta = endCol - startCol;
+
+    //Determine the step direction
+    int rowStep = (rowDelta == 0) ? 0 : (rowDelta > 0 ? 1 : -1);
+    int colStep = (colDelta == 0) ? 0 : (colDelta > 0 ? 1 : -1);
+
+    //Check each position along the path (excluding the start and end)
+    int currentRow = startRow + rowStep;
+    int currentCol = startCol + colStep;
+
+    while (currentRow != endRow || currentCol != endCol) 
+    {
+        if (board[currentRow][currentCol] != nullptr) 
+        {
+            //Path is blocked
+            return false;
+        }
+        currentRow += rowStep;
+        currentCol += colStep;
+    }
+    //Path is clear
+    return true;
+}
+
+/**
+ * @brief Moves a chess piece from one position to another.
+ *
+ * Updates the board to reflect the move and modifies the piece's internal position.
+ * The game state follows the move: the other color is to move next, rights
+ * to castle with a king or rook that left (or was captured on) its home
+ * square are dropped, and a pawn double step sets the en passant square.
+ * A king moving two squares castles, so its rook moves as well.
+ *
+ * @param from The starting position of the piece.
+ * @param to The target position of the piece.
+ */
+void ChessBoard::movePiece(const Position& from, const Position& to, char promotion)
+{
+    PROFILE_SCOPE("movePiece");
+
+    //Get the piece at the source position
+    ChessPiece* piece = board[from.getRow()][from.getCol()];
+    ChessPiece* captured = board[to.getRow()][to.getCol()];
+
+    //A pawn moving diagonally onto an empty square captures en passant
+    bool enPassant = piece && piece->getSymbol() == 'P' && !captured && from.getCol() != to.getCol();
+    bool capture = captured != nullptr || enPassant;
+
+    //Update the piece's internal position if it exists
+    if (piece)
+    {
+        piece->setPosition(to.getRow(), to.getCol());
+
+        //Update the game state
+        bool pawn = piece->getSymbol() == 'P';
+        halfmoveClock = (pawn || capture) ? 0 : halfmoveClock + 1;
+        if (piece->getColor() == "Black")
+        {
+            fullmoveNumber++;
+        }
+        sideToMove = (piece->getColor() == "White") ? "Black" : "White";
+
+        enPassantSquare = "-";
+        if (pawn && abs(to.getRow() - from.getRow()) == 2)
+        {
+            enPassantSquare = string(1, static_cast<char>('a' + from.getCol()))
+                + static_cast<char>('8' - (from.getRow() + to.getRow()) / 2);
+        }
+
+        //Each corner and king square guards the castling rights that use it
+        const struct { int row; int col; const char* rights; } homes[] =
+        {
+            { 7, 4, "KQ" }, { 7, 7, "K" }, { 7, 0, "Q" },
+            { 0, 4, "kq" }, { 0, 7, "k" }, { 0, 0, "q" }
+        };
+        for (const auto& home : homes)
+        {
+            bool touched = (from.getRow() == home.row && from.getCol() == home.col)
+                || (to.getRow() == home.row && to.getCol() == home.col);
+            if (!touched)
+            {
+                continue;
+            }
+            for (const char* right = home.rights; *right; right++)
+            {
+                castlingRights.erase(remove(castlingRights.begin(), castlingRights.end(), *right), castlingRights.end());
+            }
+        }
+        if (castlingRights.empty())
+        {
+            castlingRights = "-";
+        }
+    }
+
+    //A captured piece gives its slot back to the pool
+    if (captured && captured != piece)
+    {
+        pieces.release(captured);
+    }
+
+    //Move the piece to the new position on the board
+    board[to.getRow()][to.getCol()] = piece;
+    //Clear the old position
+    board[from.getRow()][from.getCol()] = nullptr;
+
+    //Keep the piece codes, square sets and piece lists in step
+    version++;
+    int fromSquare = from.getRow() * SIZE + from.getCol();
+    int toSquare = to.getRow() * SIZE + to.getCol();
+    int moving = squareCodes.codeAt(fromSquare);
+    clearCode(toSquare);
+    if (moving && fromSquare != toSquare)
+    {
+        shiftCode(fromSquare, toSquare);
+    }
+
+    //Castling: the king moves two squares and the rook jumps to the square it crossed
+    if (moving && (moving - 1) % 6 == KING && from.getRow() == to.getRow() && abs(to.getCol() - from.getCol()) == 2)
+    {
+        int row = from.getRow();
+        int rookFrom = (to.getCol() > from.getCol()) ? SIZE - 1 : 0;
+        int rookTo = (from.getCol() + to.getCol()) / 2;
+        ChessPiece* rook = board[row][rookFrom];
+        if (rook && !board[row][rookTo])
+        {
+            rook->setPosition(row, rookTo);
+            board[row][rookTo] = rook;
+            board[row][rookFrom] = nullptr;
+            shiftCode(row * SIZE + rookFrom, row * SIZE + rookTo);
+        }
+    }
+
+    //The pawn taken en passant stands beside the moving pawn's start square
+    if (enPassant)
+    {
+        pieces.release(board[from.getRow()][to.getCol()]);
+        board[from.getRow()][to.getCol()] = nullptr;
+        clearCode(from.getRow() * SIZE + to.getCol());
+    }
+
+    //A pawn reaching the last row is replaced by the chosen piece
+    if (moving && (moving - 1) % 6 == PAWN && (to.getRow() == 0 || to.getRow() == SIZE - 1))
+    {
+        char letter = static_cast<char>(toupper(promotion));
+        if (letter != 'N' && letter != 'B' && letter != 'R')
+        {
+            letter = 'Q';
+        }
+        if ((moving - 1) / 6 == BLACK)
+        {
+            letter = static_cast<char>(tolower(letter));
+        }
+        pieces.release(piece);
+        board[to.getRow()][to.getCol()] = createPiece(letter, to.getRow(), to.getCol());
+
+        clearCode(toSquare);
+        placeCode(toSquare, snapshotCode(letter));
+    }
+}
+
+/**
+ * @brief Checks a move without generating any move list.
+ *
+ * @param from The starting position of the piece.
+ * @param to The target position.
+ * @return True if the move may be played; otherwise, false.
+ */
+bool ChessBoard::isLegal(const Position& from, const Position& to) const
+{
+    if (from.getRow() < 0 || from.getRow() >= SIZE || from.getCol() < 0 || from.getCol() >= SIZE
+        || to.getRow() < 0 || to.getRow() >= SIZE || to.getCol() < 0 || to.getCol() >= SIZE)
+    {
+        return false;
+    }
+
+    int fromSquare = from.getRow() * SIZE + from.getCol();
+    int toSquare = to.getRow() * SIZE + to.getCol();
+    int code = squareCodes.codeAt(fromSquare);
+    int us = (sideToMove == "White") ? WHITE : BLACK;
+    uint64_t target = Bitboards::squareBit(toSquare);
+
+    //Ownership: one of our pieces moves, and not onto another of ours
+    if (code == 0 || (code - 1) / 6 != us || (colorBits[us] & target))
+    {
+        return false;
+    }
+
+    if ((code - 1) % 6 == KING && (castlingSquares(fromSquare) & target))
+    {
+        return true;
+    }
+    return (reachableSquares(fromSquare) & target) && keepsKingSafe(fromSquare, toSquare);
+}
+
+/**
+ * @brief Gets the squares a piece can move to by its movement rules.
+ *
+ * Set-wise version of the pieces' getLegalMoves(): table lookups for
+ * knights, kings and pawn captures, slider attacks for the others.
+ */
+uint64_t ChessBoard::reachableSquares(int square) const
+{
+    int code = squareCodes.codeAt(square);
+    if (code == 0)
+    {
+        return 0;
+    }
+
+    int color = (code - 1) / 6;
+    uint64_t occupied = colorBits[WHITE] | colorBits[BLACK];
+    uint64_t targets;
+    switch ((code - 1) % 6)
+    {
+    case PAWN:
+    {
+        //White pawns move toward row 0, so their pushes go down in square number
+        int step = (color == WHITE) ? -SIZE : SIZE;
+        int startRow = (color == WHITE) ? 6 : 1;
+        targets = Bitboards::pawnAttacks(color, square) & (colorBits[color ^ 1] | enPassantSquares(color));
+        int single = square + step;
+        if (single >= 0 && single < SIZE * SIZE && !(occupied & Bitboards::squareBit(single)))
+        {
+            targets |= Bitboards::squareBit(single);
+            int twice = single + step;
+            if (square / SIZE == startRow && !(occupied & Bitboards::squareBit(twice)))
+            {
+                targets |= Bitboards::squareBit(twice);
+            }
+        }
+        return targets;
+    }
+    case KNIGHT: targets = Bitboards::knightAttacks(square); break;
+    case BISHOP: targets = Bitboards::bishopAttacks(square, occupied); break;
+    case ROOK:   targets = Bitboards::rookAttacks(square, occupied); break;
+    case QUEEN:  targets = Bitboards::queenAttacks(square, occupied); break;
+    default:     targets = Bitboards::kingAttacks(square); break;
+    }
+    return targets & ~colorBits[color];
+}
+
+/**
+ * @brief Checks that a move does not leave the mover's own king attacked.
+ *
+ * Looks at the board as it would be after the move: the moving piece gone
+ * from its square, the target occupied and any piece on it captured.
+ */
+bool ChessBoard::keepsKingSafe(int fromSquare, int toSquare) const
+{
+    int code = squareCodes.codeAt(fromSquare);
+    int us = (code - 1) / 6;
+    if (pieceCounts[us * 6 + KING] == 0)
+    {
+        return true;
+    }
+
+    int them = us ^ 1;
+    uint64_t target = Bitboards::squareBit(toSquare);
+    int king = ((code - 1) % 6 == KING) ? toSquare : pieceSquares[us * 6 + KING][0];
+    uint64_t after = ((colorBits[WHITE] | colorBits[BLACK]) ^ Bitboards::squareBit(fromSquare)) | target;
+
+    //En passant also empties the captured pawn's square, which can open the row it stood on
+    uint64_t removed = target;
+    if ((code - 1) % 6 == PAWN && toSquare == enPassantTarget())
+    {
+        uint64_t passed = Bitboards::squareBit((fromSquare / SIZE) * SIZE + toSquare % SIZE);
+        after ^= passed;
+        removed |= passed;
+    }
+    uint64_t attackers = (Bitboards::knightAttacks(king) & pieceBits[them * 6 + KNIGHT])
+        | (Bitboards::kingAttacks(king) & pieceBits[them * 6 + KING])
+        | (Bitboards::pawnAttacks(us, king) & pieceBits[them * 6 + PAWN])
+        | (Bitboards::bishopAttacks(king, after) & (pieceBits[them * 6 + BISHOP] | pieceBits[them * 6 + QUEEN]))
+        | (Bitboards::rookAttacks(king, after) & (pieceBits[them * 6 + ROOK] | pieceBits[them * 6 + QUEEN]));
+    return (attackers & ~removed) == 0;
+}
+
+/**
+ * @brief Checks whether any piece of a color attacks a square.
+ */
+bool ChessBoard::isAttacked(int square, int byColor) const
+{
+    uint64_t occupied = colorBits[WHITE] | colorBits[BLACK];
+    int base = byColor * 6;
+    return (Bitboards::knightAttacks(square) & pieceBits[base + KNIGHT])
+        || (Bitboards::kingAttacks(square) & pieceBits[base + KING])
+        || (Bitboards::pawnAttacks(byColor ^ 1, square) & pieceBits[base + PAWN])
+        || (Bitboards::bishopAttacks(square, occupied) & (pieceBits[base + BISHOP] | pieceBits[base + QUEEN]))
+        || (Bitboards::rookAttacks(square, occupied) & (pieceBits[base + ROOK] | pieceBits[base + QUEEN]));
+}
+
+/**
+ * @brief Gets the squares the king on a square can castle to.
+ *
+ * Each castling needs its right, the king on its home square and the rook
+ * on its corner, every square between them empty, and the king's start,
+ * the square it crosses and the square it lands on free of attack.
+ */
+uint64_t ChessBoard::castlingSquares(int square) const
+{
+    int code = squareCodes.codeAt(square);
+    if (code == 0 || (code - 1) % 6 != KING)
+    {
+        return 0;
+    }
+    int color = (code - 1) / 6;
+    int home = (color == WHITE) ? 60 : 4;
+    if (square != home || isAttacked(square, color ^ 1))
+    {
+        return 0;
+    }
+
+    //Each castling: its right, the rook's corner and the king's step toward it
+    const struct { char right; int rook; int step; } wings[] =
+    {
+        { 'K', home + 3, 1 }, { 'Q', home - 4, -1 }
+    };
+    uint64_t occupied = colorBits[WHITE] | colorBits[BLACK];
+    uint64_t targets = 0;
+    for (const auto& wing : wings)
+    {
+        char right = (color == WHITE) ? wing.right : static_cast<char>(tolower(wing.right));
+        if (castlingRights.find(right) == string::npos || squareCodes.codeAt(wing.rook) != color * 6 + ROOK + 1
+            || (occupied & Bitboards::between(square, wing.rook)))
+        {
+            continue;
+        }
+        if (!isAttacked(square + wing.step, color ^ 1) && !isAttacked(square + 2 * wing.step, color ^ 1))
+        {
+            targets |= Bitboards::squareBit(square + 2 * wing.step);
+        }
+    }
+    return targets;
+}
+
+/**
+ * @brief Gets the square an en passant capture would land on, from the FEN field.
+ */
+int ChessBoard::enPassantTarget() const
+{
+    if (enPassantSquare.size() != 2 || enPassantSquare[0] < 'a' || enPassantSquare[0] > 'h'
+        || enPassantSquare[1] < '1' || enPassantSquare[1] > '8')
+    {
+        return NO_SQUARE;
+    }
+    return (SIZE - (enPassantSquare[1] - '0')) * SIZE + (enPassantSquare[0] - 'a');
+}
+
+/**
+ * @brief Gets the en passant target as a square set if pawns of a color could capture onto it.
+ *
+ * The target is on row 2 after a Black double push and row 5 after a White one.
+ */
+uint64_t ChessBoard::enPassantSquares(int color) const
+{
+    int target = enPassantTarget();
+    if (target == NO_SQUARE || target / SIZE != ((color == WHITE) ? 2 : 5))
+    {
+        return 0;
+    }
+    return Bitboards::squareBit(target);
+}
+
+/**
+ * @brief Adds the king-safe moves of one kind of pawn move to the move cache.
+ */
+void ChessBoard::cachePawnMoves(uint64_t targets, int delta) const
+{
+    while (targets)
+    {
+        int to = Bitboards::popLsb(targets);
+        if (keepsKingSafe(to - delta, to))
+        {
+            moveCache[to - delta] |= Bitboards::squareBit(to);
+        }
+    }
+}
+
+/**
+ * @brief Adds the king-safe moves of every piece of one type, both colors, to the move cache.
+ *
+ * Kings also get the squares they can castle to.
+ */
+void ChessBoard::cachePieceMoves(int type) const
+{
+    for (int color = WHITE; color <= BLACK; color++)
+    {
+        const uint8_t* squares = pieceSquares[color * 6 + type];
+        for (int i = 0; i < pieceCounts[color * 6 + type]; i++)
+        {
+            int square = squares[i];
+            uint64_t targets = reachableSquares(square);
+            uint64_t safe = 0;
+            while (targets)
+            {
+                int target = Bitboards::popLsb(targets);
+                if (keepsKingSafe(square, target))
+                {
+                    safe |= Bitboards::squareBit(target);
+                }
+            }
+            moveCache[square] = (type == KING) ? safe | castlingSquares(square) : safe;
+        }
+    }
+}
+
+/**
+ * @brief Fills the move cache for every piece on the board in one pass.
+ *
+ * The pawns of each color are generated together, one whole-set shift per
+ * kind of move (push, double push, capture toward each side, en passant
+ * included); the other pieces are taken from the piece lists, so empty
+ * squares are never visited.
+ */
+void ChessBoard::fillMoveCache() const
+{
+    PROFILE_SCOPE("fillMoveCache");
+
+    fill(begin(moveCache), end(moveCache), 0);
+    {
+        PROFILE_SCOPE("fillMoveCache.Pawn");
+        uint64_t occupied = colorBits[WHITE] | colorBits[BLACK];
+        for (int color = WHITE; color <= BLACK; color++)
+        {
+            //White pawns move toward row 0, so their pushes go down in square number
+            uint64_t own = pieceBits[color * 6 + PAWN];
+            int forward = (color == WHITE) ? -SIZE : SIZE;
+            uint64_t single = Bitboards::shift(own, forward) & ~occupied;
+            uint64_t twice = Bitboards::shift(single, forward) & ~occupied & Bitboards::rowSquares(color == WHITE ? 4 : 3);
+            uint64_t victims = colorBits[color ^ 1] | enPassantSquares(color);
+            cachePawnMoves(single, forward);
+            cachePawnMoves(twice, 2 * forward);
+            cachePawnMoves(Bitboards::shift(own, forward - 1) & victims & ~FILE_H_SQUARES, forward - 1);
+            cachePawnMoves(Bitboards::shift(own, forward + 1) & victims & ~FILE_A_SQUARES, forward + 1);
+        }
+    }
+
+    //The other pieces come straight from the piece lists, one profiling site per type
+    { PROFILE_SCOPE("fillMoveCache.Knight"); cachePieceMoves(KNIGHT); }
+    { PROFILE_SCOPE("fillMoveCache.Bishop"); cachePieceMoves(BISHOP); }
+    { PROFILE_SCOPE("fillMoveCache.Rook"); cachePieceMoves(ROOK); }
+    { PROFILE_SCOPE("fillMoveCache.Queen"); cachePieceMoves(QUEEN); }
+    { PROFILE_SCOPE("fillMoveCache.King"); cachePieceMoves(KING); }
+    cachedVersion = version;
+}
+
+/**
+ * @brief Gets the board version.
+ *
+ * @return A number that changes whenever a piece moves or the position is replaced.
+ */
+uint64_t ChessBoard::getVersion() const
+{
+    return version;
+}
+
+/**
+ * @brief Gets the squares the piece on a square can move to.
+ *
+ * @param row The row index of the piece (0-7).
+ * @param col The column index of the piece (0-7).
+ * @return The target squares, bit (row * 8 + col); 0 for an empty square.
+ */
+uint64_t ChessBoard::getMoveTargets(int row, int col) const
+{
+    PROFILE_SCOPE("getMoveTargets");
+
+    if (row < 0 || row >= SIZE || col < 0 || col >= SIZE)
+    {
+        return 0;
+    }
+    if (cachedVersion != version)
+    {
+        fillMoveCache();
+    }
+    return moveCache[row * SIZE + col];
+}
+
+/**
+ * @brief Gets the moves of the piece on a square as positions.
+ *
+ * @param piecePos The position of the piece.
+ * @return The target positions, nearest White's side of the board first.
+ */
+vector<Position> ChessBoard::getMovesFrom(const Position& piecePos) const
+{
+    vector<Position> moves;
+    uint64_t targets = getMoveTargets(piecePos.getRow(), piecePos.getCol());
+    while (targets)
+    {
+        int square = Bitboards::msb(targets);
+        targets ^= Bitboards::squareBit(square);
+        moves.push_back(Position(square / SIZE, square % SIZE));
+    }
+    return moves;
+}
+
+/**
+ * @brief Rebuilds the square sets and piece lists from the piece codes.
+ */
+void ChessBoard::rebuildPieceSets()
+{
+    fill(begin(pieceBits), end(pieceBits), 0);
+    colorBits[WHITE] = colorBits[BLACK] = 0;
+    fill(begin(pieceCounts), end(pieceCounts), 0);
+    fill(begin(listSlot), end(listSlot), -1);
+    for (int sq = 0; sq < SIZE * SIZE; sq++)
+    {
+        int code = squareCodes.codeAt(sq);
+        if (code)
+        {
+            placeCode(sq, code);
+        }
+    }
+}
+
+/**
+ * @brief Puts a piece code on an empty square.
+ *
+ * Sets the square's code and bits and appends the square to its piece list.
+ */
+void ChessBoard::placeCode(int sq, int code)
+{
+    int index = code - 1;
+    squareCodes.setCode(sq, code);
+    pieceBits[index] |= Bitboards::squareBit(sq);
+    colorBits[index / 6] |= Bitboards::squareBit(sq);
+    listSlot[sq] = static_cast<int8_t>(pieceCounts[index]);
+    pieceSquares[index][pieceCounts[index]++] = static_cast<uint8_t>(sq);
+}
+
+/**
+ * @brief Removes the piece code from a square, if there is one.
+ *
+ * The last entry of the piece's list fills the hole, so removal is O(1).
+ */
+void ChessBoard::clearCode(int sq)
+{
+    int code = squareCodes.codeAt(sq);
+    if (code == 0)
+    {
+        return;
+    }
+
+    int index = code - 1;
+    pieceBits[index] ^= Bitboards::squareBit(sq);
+    colorBits[index / 6] ^= Bitboards::squareBit(sq);
+    int slot = listSlot[sq];
+    int last = pieceSquares[index][--pieceCounts[index]];
+    pieceSquares[index][slot] = static_cast<uint8_t>(last);
+    listSlot[last] = static_cast<int8_t>(slot);
+    listSlot[sq] = -1;
+    squareCodes.setCode(sq, 0);
+}
+
+/**
+ * @brief Moves the piece code on one square to an empty square, keeping its place in its list.
+ */
+void ChessBoard::shiftCode(int from, int to)
+{
+    int code = squareCodes.codeAt(from);
+    int index = code - 1;
+    uint64_t path = Bitboards::squareBit(from) | Bitboards::squareBit(to);
+    pieceBits[index] ^= path;
+    colorBits[index / 6] ^= path;
+    int slot = listSlot[from];
+    pieceSquares[index][slot] = static_cast<uint8_t>(to);
+    listSlot[to] = static_cast<int8_t>(slot);
+    listSlot[from] = -1;
+    squareCodes.setCode(to, code);
+    squareCodes.setCode(from, 0);
+}
+
+/**
+ * @brief Gets the number of pieces of one color and type.
+ */
+int ChessBoard::getPieceCount(int color, int type) const
+{
+    return pieceCounts[color * 6 + type];
+}
+
+/**
+ * @brief Gets the squares of the pieces of one color and type.
+ */
+const uint8_t* ChessBoard::getPieceSquares(int color, int type) const
+{
+    return pieceSquares[color * 6 + type];
+}
+
+/**
+ * @brief Displays all legal moves for the chess piece at a given position.
+ *
+ * - Legal moves are marked with 'x'.
+ * - Empty spaces are marked with '.'.
+ * - Piece symbols are displayed normally.
+ *
+ * @param piecePos The position of the piece to evaluate.
+ */
+void ChessBoard::displayLegalMoves(const Position& piecePos) const
+{
+    PROFILE_SCOPE("displayLegalMoves");
+
+    const ChessPiece* piece = getPieceAt(piecePos.getRow(), piecePos.getCol());
+
+    if (!piece) {
+        cout << "No piece at the given position." << endl;
+        return;
+    }
+
+    // Highlight the cached moves of the piece
+    displayMask(getMoveTargets(piecePos.getRow(), piecePos.getCol()));
+}
+
+/**
+ * @brief Creates a piece from its FEN letter in the board's pool.
+ *
+ * @param letter The FEN letter (uppercase for White, lowercase for Black).
+ * @param row The row index of the piece (0-7).
+ * @param col The column index of the piece (0-7).
+ * @return The new piece, or nullptr if the letter is not a piece or the pool is full.
+ */
+ChessPiece* ChessBoard::createPiece(char letter, int row, int col)
+{
+    string color = isupper(letter) ? "White" : "Black";
+    Position pos(row, col);
+
+    switch (toupper(letter))
+    {
+    case 'P': return pieces.create<Pawn>(color, pos);
+    case 'N': return pieces.create<Knight>(color, pos);
+    case 'B': return pieces.create<Bishop>(color, pos);
+    case 'R': return pieces.create<Rook>(color, pos);
+    case 'Q': return pieces.create<Queen>(color, pos);
+    case 'K': return pieces.create<King>(color, pos);
+    default: return nullptr;
+    }
+}
+
+/**
+ * @brief Checks whether a character is a FEN piece letter.
+ */
+bool ChessBoard::isPieceLetter(char letter)
+{
+    switch (toupper(letter))
+    {
+    case 'P': case 'N': case 'B': case 'R': case 'Q': case 'K': return true;
+    default: return false;
+    }
+}
+
+/**
+ * @brief Writes the board and game state as a FEN string.
+ *
+ * @return The FEN text.
+ */
+string ChessBoard::toFen() const
+{
+    string fen;
+    for (int i = 0; i < SIZE; i++)
+    {
+        int empty = 0;
+        for (int j = 0; j < SIZE; j++)
+        {
+            if (!board[i][j])
+            {
+                empty++;
+                continue;
+            }
+            if (empty > 0)
+            {
+                fen += static_cast<char>('0' + empty);
+                empty = 0;
+            }
+            char symbol = board[i][j]->getSymbol();
+            fen += (board[i][j]->getColor() == "White") ? symbol : static_cast<char>(tolower(symbol));
+        }
+        if (empty > 0)
+        {
+            fen += static_cast<char>('0' + empty);
+        }
+        if (i < SIZE - 1)
+        {
+            fen += '/';
+        }
+    }
+
+    fen += (sideToMove == "White") ? " w " : " b ";
+    fen += castlingRights + " " + enPassantSquare;
+    fen += " " + to_string(halfmoveClock) + " " + to_string(fullmoveNumber);
+    return fen;
+}
+
+/**
+ * @brief Replaces the board and game state with a FEN position.
+ *
+ * The placement is checked completely before the board is touched, so a
+ * malformed FEN leaves the current game as it was. Only then is the pool
+ * emptied and the new pieces built in it.
+ *
+ * @param fen The FEN text to load.
+ * @return True if the FEN was valid; otherwise, false.
+ */
+bool ChessBoard::loadFen(const string& fen)
+{
+    istringstream fields(fen);
+    string placement, side, castling, enPassant;
+    int halfmove = 0, fullmove = 1;
+
+    if (!(fields >> placement >> side >> castling >> enPassant))
+    {
+        return false;
+    }
+    if (!(fields >> halfmove) || !(fields >> fullmove))
+    {
+        halfmove = 0;
+        fullmove = 1;
+    }
+    if (side != "w" && side != "b")
+    {
+        return false;
+    }
+
+    //Castling is "-" or each of KQkq at most once; en passant is "-" or a square on the third or sixth rank
+    if (castling != "-")
+    {
+        for (size_t i = 0; i < castling.size(); i++)
+        {
+            if (!strchr(CASTLING_LETTERS, castling[i]) || castling.find(castling[i], i + 1) != string::npos)
+            {
+                return false;
+            }
+        }
+    }
+    if (enPassant != "-" && (enPassant.size() != 2 || enPassant[0] < 'a' || enPassant[0] > 'h'
+        || (enPassant[1] != '3' && enPassant[1] != '6')))
+    {
+        return false;
+    }
+
+    //Check the placement first, noting each piece letter
+    char placed[SIZE][SIZE] = {};
+    int row = 0, col = 0, count = 0;
+    for (char ch : placement)
+    {
+        if (ch == '/')
+        {
+            if (col != SIZE)
+            {
+                return false;
+            }
+            row++;
+            col = 0;
+        }
+        else if (ch >= '1' && ch <= '8')
+        {
+            col += ch - '0';
+        }
+        else
+        {
+            if (row >= SIZE || col >= SIZE)
+            {
+                return false;
+            }
+            if (!isPieceLetter(ch) || ++count > PiecePool::CAPACITY)
+            {
+                return false;
+            }
+            placed[row][col] = ch;
+            col++;
+        }
+        if (col > SIZE)
+        {
+            return false;
+        }
+    }
+    if (row != SIZE - 1 || col != SIZE)
+    {
+        return false;
+    }
+
+    //Valid: rebuild the pieces and take over the state
+    pieces.reset();
+    for (int i = 0; i < SIZE; i++)
+    {
+        for (int j = 0; j < SIZE; j++)
+        {
+            board[i][j] = placed[i][j] ? createPiece(placed[i][j], i, j) : nullptr;
+            squareCodes.setCode(i * SIZE + j, placed[i][j] ? snapshotCode(placed[i][j]) : 0);
+        }
+    }
+    rebuildPieceSets();
+    version++;
+    sideToMove = (side == "w") ? "White" : "Black";
+    castlingRights = castling;
+    enPassantSquare = enPassant;
+    halfmoveClock = halfmove;
+    fullmoveNumber = fullmove;
+    dropStaleRights();
+    return true;
+}
+
+/**
+ * @brief Copies the board and game state into a compact snapshot.
+ *
+ * The piece codes are kept up to date as the board changes, so only the
+ * game state has to be converted here.
+ *
+ * @return The snapshot.
+ */
+BoardSnapshot ChessBoard::snapshot() const
+{
+    BoardSnapshot snap = {};
+    memcpy(snap.squares, squareCodes.squares, sizeof(snap.squares));
+    snap.side = (sideToMove == "White") ? 0 : 1;
+    for (int bit = 0; bit < 4; bit++)
+    {
+        if (castlingRights.find(CASTLING_LETTERS[bit]) != string::npos)
+        {
+            snap.castling |= static_cast<uint8_t>(1 << bit);
+        }
+    }
+    snap.enPassant = static_cast<int8_t>(enPassantTarget());
+    snap.halfmoveClock = static_cast<uint8_t>(min(halfmoveClock, 255));
+    snap.fullmoveNumber = static_cast<uint16_t>(min(fullmoveNumber, 65535));
+    snap.hash = EngineBoard::snapshotHash(snap);
+    return snap;
+}
+
+/**
+ * @brief Replaces the board and game state with a snapshot.
+ *
+ * @param snap The snapshot to load.
+ * @return True if the snapshot was valid; otherwise, false.
+ */
+bool ChessBoard::restore(const BoardSnapshot& snap)
+{
+    int count = 0;
+    for (int sq = 0; sq < SIZE * SIZE; sq++)
+    {
+        int code = snap.codeAt(sq);
+        if (code > 12 || (code != 0 && ++count > PiecePool::CAPACITY))
+        {
+            return false;
+        }
+    }
+    if (snap.side > 1 || snap.enPassant < BoardSnapshot::NO_EN_PASSANT || snap.enPassant >= SIZE * SIZE)
+    {
+        return false;
+    }
+
+    pieces.reset();
+    for (int i = 0; i < SIZE; i++)
+    {
+        for (int j = 0; j < SIZE; j++)
+        {
+            int code = snap.codeAt(i * SIZE + j);
+            board[i][j] = code ? createPiece(SNAPSHOT_LETTERS[code - 1], i, j) : nullptr;
+        }
+    }
+    memcpy(squareCodes.squares, snap.squares, sizeof(squareCodes.squares));
+    rebuildPieceSets();
+    version++;
+
+    sideToMove = (snap.side == 0) ? "White" : "Black";
+    castlingRights.clear();
+    for (int bit = 0; bit < 4; bit++)
+    {
+        if (snap.castling & (1 << bit))
+        {
+            castlingRights += CASTLING_LETTERS[bit];
+        }
+    }
+    if (castlingRights.empty())
+    {
+        castlingRights = "-";
+    }
+    enPassantSquare = "-";
+    if (snap.enPassant != BoardSnapshot::NO_EN_PASSANT)
+    {
+        enPassantSquare = string(1, static_cast<char>('a' + snap.enPassant % SIZE))
+            + static_cast<char>('0' + SIZE - snap.enPassant / SIZE);
+    }
+    halfmoveClock = snap.halfmoveClock;
+    fullmoveNumber = snap.fullmoveNumber;
+    dropStaleRights();
+    return true;
+}
+
+/**
+ * @brief Drops castling rights and an en passant square the placement cannot back.
+ *
+ * A right stays only with its king and rook on their home squares, and an
+ * en passant square only on the side to move's sixth rank (third for
+ * Black), empty, with an enemy pawn just in front of it and the square it
+ * came from empty. Without this a loaded position could castle with a
+ * rook that is not there, and its hash would not match the engine's.
+ */
+void ChessBoard::dropStaleRights()
+{
+    //Snapshot codes (engine code + 1) of the king and rook each right needs, with their squares
+    const struct { char right; int king; int rook; int kingCode; int rookCode; } homes[] =
+    {
+        { 'K', 60, 63, 6, 4 }, { 'Q', 60, 56, 6, 4 },
+        { 'k', 4, 7, 12, 10 }, { 'q', 4, 0, 12, 10 }
+    };
+    for (const auto& home : homes)
+    {
+        if (squareCodes.codeAt(home.king) != home.kingCode || squareCodes.codeAt(home.rook) != home.rookCode)
+        {
+            castlingRights.erase(remove(castlingRights.begin(), castlingRights.end(), home.right), castlingRights.end());
+        }
+    }
+    if (castlingRights.empty())
+    {
+        castlingRights = "-";
+    }
+
+    int target = enPassantTarget();
+    if (target != NO_SQUARE)
+    {
+        bool whiteToMove = sideToMove == "White";
+        int pusher = whiteToMove ? target + SIZE : target - SIZE;
+        int origin = whiteToMove ? target - SIZE : target + SIZE;
+        int pawnCode = whiteToMove ? 7 : 1;
+        if (target / SIZE != (whiteToMove ? 2 : 5) || squareCodes.codeAt(target) != 0
+            || squareCodes.codeAt(pusher) != pawnCode || squareCodes.codeAt(origin) != 0)
+        {
+            enPassantSquare = "-";
+        }
+    }
+}
+
+/**
+ * @brief Gets the color of the side to move.
+ *
+ * @return "White" or "Black".
+ */
+string ChessBoard::getSideToMove() const
+{
+    return sideToMove;
+}
+
+/**
+ * @brief Destructor for the Chess class.
+ *
+ * Cleans up resources and finalizes the game.
+ */
 ChessBoard::~ChessBoard() {};
\ No newline at end of file
@@ -0,0 +1,318 @@
+//Qusay Edkymish
+//Oct/19/2026
+//DataGenerator Class Implementation
+
+#include "DataGenerator.h"
+#include <algorithm>    //For min and max.
+#include <atomic>       //For the shared record and game counters.
+#include <chrono>       //For the positions-per-minute rate and seeding.
+#include <cstdlib>      //For abs.
+#include <fstream>      //For writing where positional writes are not available.
+#include <iomanip>      //For formatting the report.
+#include <memory>       //For the per-thread engines.
+#include <thread>       //For the game threads.
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>      //For creating the output file.
+#include <unistd.h>     //For pwrite.
+#endif
+
+//Adjudication: a win after this many plies in a row at or beyond the margin, a draw after the ply limit
+static const int ADJUDICATE_MARGIN = 1500;
+static const int ADJUDICATE_PLIES = 6;
+static const int MAX_GAME_PLIES = 400;
+
+//Games whose first searched position is further from equal than this are dropped
+static const int OPENING_MARGIN = 300;
+
+//Records a thread collects before writing them out (128 KB)
+static const size_t BUFFER_RECORDS = 4096;
+
+//Transposition table size of each game thread; a few thousand nodes per move need little
+static const size_t GAME_HASH_MB = 4;
+
+//Seconds between progress lines
+static const int REPORT_SECONDS = 5;
+
+/**
+ * @brief Advances an xorshift state and returns it.
+ */
+static uint64_t nextRandom(uint64_t& seed)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    return seed;
+}
+
+/**
+ * @class RecordFile
+ * @brief The output file, written at reserved offsets by any number of threads at once.
+ */
+class RecordFile
+{
+private:
+    string path;
+#if defined(__unix__) || defined(__APPLE__)
+    int fd = -1;
+#endif
+
+public:
+    ~RecordFile()
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+#endif
+    }
+
+    /**
+     * @brief Creates or truncates the file.
+     */
+    bool create(const string& name)
+    {
+        path = name;
+#if defined(__unix__) || defined(__APPLE__)
+        fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        return fd >= 0;
+#else
+        ofstream file(path, ios::binary | ios::trunc);
+        return static_cast<bool>(file);
+#endif
+    }
+
+    /**
+     * @brief Writes bytes at an offset no other thread writes to.
+     */
+    bool writeAt(uint64_t offset, const void* data, size_t bytes)
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        const char* next = static_cast<const char*>(data);
+        while (bytes > 0)
+        {
+            ssize_t done = pwrite(fd, next, bytes, static_cast<off_t>(offset));
+            if (done <= 0)
+            {
+                return false;
+            }
+            next += done;
+            offset += static_cast<uint64_t>(done);
+            bytes -= static_cast<size_t>(done);
+        }
+        return true;
+#else
+        //Each write opens its own stream, so threads still share no state
+        fstream file(path, ios::in | ios::out | ios::binary);
+        file.seekp(static_cast<streamoff>(offset));
+        return static_cast<bool>(file.write(static_cast<const char*>(data), static_cast<streamsize>(bytes)));
+#endif
+    }
+};
+
+/**
+ * @brief Plays one game and collects its training positions.
+ */
+bool DataGenerator::playGame(Search& engine, const SearchLimits& limits, int randomPlies, uint64_t& seed,
+    vector<PackedPosition>& records)
+{
+    records.clear();
+    EngineBoard board;
+    board.setStartPosition();
+    engine.clear();
+
+    MoveList legal;
+    for (int ply = 0; ply < randomPlies; ply++)
+    {
+        board.generateLegalMoves(legal);
+        if (legal.size() == 0)
+        {
+            return false;
+        }
+        board.makeMove(legal[static_cast<int>(nextRandom(seed) % legal.size())]);
+    }
+
+    int result = 0;         //1 White won, -1 Black won, 0 drawn
+    int winningPlies = 0;   //Plies in a row with one side ahead by the margin
+    int leader = 0;         //That side: 1 White, -1 Black
+    for (int ply = 0; ply < MAX_GAME_PLIES; ply++)
+    {
+        board.generateLegalMoves(legal);
+        if (legal.size() == 0)
+        {
+            result = !board.inCheck() ? 0 : (board.sideToMove() == WHITE ? -1 : 1);
+            break;
+        }
+        if (board.isDraw())
+        {
+            break;
+        }
+
+        SearchResult searched = engine.think(board, limits);
+        Move move = searched.bestMove.isNull() ? legal[0] : searched.bestMove;
+        int whiteScore = (board.sideToMove() == WHITE) ? searched.score : -searched.score;
+        if (ply == 0 && abs(whiteScore) > OPENING_MARGIN)
+        {
+            return false;
+        }
+
+        //Keep quiet positions only: their static evaluation should explain the score
+        if (!board.inCheck() && !move.isCapture() && !move.isPromotion() && abs(searched.score) < Search::MATE_BOUND)
+        {
+            records.push_back(PackedPosition::fromSnapshot(board.snapshot(), whiteScore, 0, board.gamePly()));
+        }
+
+        int ahead = (whiteScore >= ADJUDICATE_MARGIN) ? 1 : (whiteScore <= -ADJUDICATE_MARGIN ? -1 : 0);
+        winningPlies = (ahead != 0 && ahead == leader) ? winningPlies + 1 : (ahead != 0 ? 1 : 0);
+        leader = ahead;
+        if (winningPlies >= ADJUDICATE_PLIES)
+        {
+            result = leader;
+            break;
+        }
+        board.makeMove(move);
+    }
+
+    for (PackedPosition& record : records)
+    {
+        record.result = static_cast<int8_t>(result);
+    }
+    return true;
+}
+
+/**
+ * @brief Generates a data file and writes a progress line every few seconds.
+ *
+ * Threads reserve a run of records with a compare-and-swap on the shared
+ * record count, which also trims the last buffers so the file holds
+ * exactly the requested number, and then write them without any lock.
+ */
+int DataGenerator::run(const Options& options, ostream& out)
+{
+    RecordFile file;
+    if (options.output.empty() || !file.create(options.output))
+    {
+        out << "Cannot create " << options.output << "\n";
+        return 1;
+    }
+
+    SearchLimits limits;
+    limits.nodes = options.nodes;
+    if (options.depth > 0)
+    {
+        limits.depth = options.depth;
+    }
+    if (options.nodes == 0 && options.depth <= 0)
+    {
+        limits.depth = 6;
+    }
+
+    int threads = options.threads > 0 ? options.threads : static_cast<int>(max(1u, thread::hardware_concurrency()));
+    uint64_t seed = options.seed != 0 ? options.seed
+        : static_cast<uint64_t>(chrono::steady_clock::now().time_since_epoch().count()) | 1;
+
+    out << "Generating " << options.positions << " positions into " << options.output << " with "
+        << threads << " threads, " << options.nodes << " nodes per move, " << options.randomPlies
+        << " random plies, seed " << seed << "\n";
+
+    atomic<uint64_t> written(0);
+    atomic<uint64_t> games(0);
+    atomic<int> running(threads);
+    atomic<bool> failed(false);
+    auto start = chrono::steady_clock::now();
+
+    auto generate = [&](int id)
+    {
+        unique_ptr<Search> engine(new Search());
+        engine->setInfoOutput(nullptr);
+        engine->setHashSize(GAME_HASH_MB);
+        uint64_t state = seed ^ (0x9E3779B97F4A7C15ULL * static_cast<uint64_t>(id + 1));
+        state = state ? state : 1;
+
+        vector<PackedPosition> buffer;
+        vector<PackedPosition> game;
+        buffer.reserve(BUFFER_RECORDS + MAX_GAME_PLIES);
+
+        //Reserves up to buffer.size() records and writes them; false once the file is full or broken
+        auto flush = [&]() -> bool
+        {
+            uint64_t first = written.load();
+            uint64_t count;
+            do
+            {
+                if (first >= options.positions)
+                {
+                    return false;
+                }
+                count = min<uint64_t>(buffer.size(), options.positions - first);
+            } while (!written.compare_exchange_weak(first, first + count));
+
+            if (!file.writeAt(first * sizeof(PackedPosition), buffer.data(), count * sizeof(PackedPosition)))
+            {
+                failed = true;
+                return false;
+            }
+            buffer.clear();
+            return first + count < options.positions;
+        };
+
+        while (!failed && written.load() < options.positions)
+        {
+            if (!playGame(*engine, limits, options.randomPlies, state, game))
+            {
+                continue;
+            }
+            games++;
+            buffer.insert(buffer.end(), game.begin(), game.end());
+            if (buffer.size() >= BUFFER_RECORDS && !flush())
+            {
+                break;
+            }
+        }
+        if (!buffer.empty() && !failed)
+        {
+            flush();
+        }
+        running--;
+    };
+
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++)
+    {
+        workers.emplace_back(generate, t);
+    }
+
+    //The main thread only reports; the counters it reads are the ones the workers update anyway
+    auto lastReport = start;
+    while (running > 0)
+    {
+        this_thread::sleep_for(chrono::milliseconds(100));
+        auto now = chrono::steady_clock::now();
+        if (now - lastReport >= chrono::seconds(REPORT_SECONDS))
+        {
+            lastReport = now;
+            double minutes = chrono::duration<double>(now - start).count() / 60.0;
+            uint64_t done = written.load();
+            out << "Positions " << done << " (" << fixed << setprecision(1) << 100.0 * done / max<uint64_t>(options.positions, 1)
+                << "%)  games " << games.load() << "  positions/minute " << setprecision(0) << done / max(minutes, 1e-9) << "\n";
+        }
+    }
+    for (thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    if (failed)
+    {
+        out << "Write error on " << options.output << "\n";
+        return 1;
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    uint64_t done = written.load();
+    out << "Wrote " << done << " positions (" << done * sizeof(PackedPosition) / 1024 << " KB) from " << games.load()
+        << " games in " << fixed << setprecision(1) << seconds << " s: " << setprecision(0)
+        << done * 60.0 / max(seconds, 1e-9) << " positions/minute, "
+        << setprecision(1) << static_cast<double>(done) / max<uint64_t>(games.load(), 1) << " per game\n";
+    return 0;
+}
@@ -0,0 +1,1188 @@
+//Qusay Edkymish
+//Oct/19/2026
+//EngineBoard Class Implementation
+
+#include "EngineBoard.h"
+#include <algorithm>    //For clamping the move clocks of a snapshot.
+#include <sstream>      //For splitting FEN fields.
+
+const char* const EngineBoard::START_FEN = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+//FEN letters indexed by piece code (white pieces first)
+static const char PIECE_CHARS[] = "PNBRQKpnbrqk";
+
+//Material used for nonPawnMaterial(), indexed by piece type
+static const int PIECE_MATERIAL[6] = { 100, 320, 330, 500, 900, 0 };
+
+//Castling squares (a8 = 0 numbering)
+static const int A1 = 56, C1 = 58, D1 = 59, E1 = 60, F1 = 61, G1 = 62, H1 = 63;
+static const int A8 = 0, C8 = 2, D8 = 3, E8 = 4, F8 = 5, G8 = 6, H8 = 7;
+
+/**
+ * @struct ZobristKeys
+ * @brief Hash keys and castling masks, computed by the compiler.
+ *
+ * The keys come from a xorshift generator seeded with ZOBRIST_SEED. It runs
+ * at compile time, so the keys are read-only data and every board hashes
+ * the same way without any setup when the program starts.
+ */
+struct ZobristKeys
+{
+    uint64_t piece[12][64];     //Hash keys per piece and square
+    uint64_t castling[16];      //Hash keys per castling right set
+    uint64_t ep[8];             //Hash keys per en passant file
+    uint64_t side;              //Hash key toggled when black is to move
+    int castlingMask[64];       //Castling rights kept when a piece moves from or to each square
+
+    static constexpr uint64_t next(uint64_t& state)
+    {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 2685821657736338717ULL;
+    }
+
+    static constexpr ZobristKeys build()
+    {
+        ZobristKeys keys{};
+        uint64_t state = EngineBoard::ZOBRIST_SEED;
+        for (int p = 0; p < 12; p++)
+        {
+            for (int sq = 0; sq < 64; sq++)
+            {
+                keys.piece[p][sq] = next(state);
+            }
+        }
+        for (int i = 0; i < 16; i++)
+        {
+            keys.castling[i] = next(state);
+        }
+        for (int i = 0; i < 8; i++)
+        {
+            keys.ep[i] = next(state);
+        }
+        keys.side = next(state);
+
+        for (int sq = 0; sq < 64; sq++)
+        {
+            keys.castlingMask[sq] = 15;
+        }
+        keys.castlingMask[A1] &= ~WHITE_QUEENSIDE;
+        keys.castlingMask[H1] &= ~WHITE_KINGSIDE;
+        keys.castlingMask[E1] &= ~(WHITE_KINGSIDE | WHITE_QUEENSIDE);
+        keys.castlingMask[A8] &= ~BLACK_QUEENSIDE;
+        keys.castlingMask[H8] &= ~BLACK_KINGSIDE;
+        keys.castlingMask[E8] &= ~(BLACK_KINGSIDE | BLACK_QUEENSIDE);
+        return keys;
+    }
+};
+
+static constexpr ZobristKeys ZOBRIST = ZobristKeys::build();
+
+/**
+ * @struct SideTraits
+ * @brief Everything about one side that the move code needs, as compile-time constants.
+ *
+ * The generator, makeMove() and unmakeMove() are templates on the side to
+ * move, so pawn direction, promotion and double-push rows, castling
+ * squares and piece codes are all fixed when the code is compiled rather
+ * than looked up for every move.
+ */
+template <int US>
+struct SideTraits
+{
+    static constexpr int THEM = US ^ 1;
+    static constexpr int FORWARD = (US == WHITE) ? -8 : 8;                  //Square offset of a pawn push
+    static constexpr uint64_t PROMO_ROW = (US == WHITE) ? 0xFFULL : 0xFFULL << 56;
+    static constexpr uint64_t DOUBLE_ROW = (US == WHITE) ? 0xFFULL << 32 : 0xFFULL << 24;
+    static constexpr int KING_FROM = (US == WHITE) ? E1 : E8;
+    static constexpr int KINGSIDE = (US == WHITE) ? WHITE_KINGSIDE : BLACK_KINGSIDE;
+    static constexpr int QUEENSIDE = (US == WHITE) ? WHITE_QUEENSIDE : BLACK_QUEENSIDE;
+    static constexpr uint64_t KINGSIDE_PATH = 3ULL << (KING_FROM + 1);     //F and G files
+    static constexpr uint64_t QUEENSIDE_PATH = 7ULL << (KING_FROM - 3);    //B, C and D files
+};
+
+/**
+ * @brief Constructs a board set to the standard starting position.
+ */
+EngineBoard::EngineBoard()
+{
+    history.reserve(1024);
+    setStartPosition();
+}
+
+/**
+ * @brief Resets the board to the standard starting position.
+ */
+void EngineBoard::setStartPosition()
+{
+    loadFen(START_FEN);
+}
+
+void EngineBoard::putPiece(int piece, int sq)
+{
+    uint64_t bit = Bitboards::squareBit(sq);
+    pieceBB[piece] |= bit;
+    colorBB[piece / 6] |= bit;
+    occupiedBB |= bit;
+    mailbox[sq] = piece;
+    hash ^= ZOBRIST.piece[piece][sq];
+}
+
+void EngineBoard::removePiece(int sq)
+{
+    int piece = mailbox[sq];
+    uint64_t bit = Bitboards::squareBit(sq);
+    pieceBB[piece] ^= bit;
+    colorBB[piece / 6] ^= bit;
+    occupiedBB ^= bit;
+    mailbox[sq] = NO_PIECE;
+    hash ^= ZOBRIST.piece[piece][sq];
+}
+
+void EngineBoard::shiftPiece(int from, int to)
+{
+    int piece = mailbox[from];
+    uint64_t bits = Bitboards::squareBit(from) | Bitboards::squareBit(to);
+    pieceBB[piece] ^= bits;
+    colorBB[piece / 6] ^= bits;
+    occupiedBB ^= bits;
+    mailbox[from] = NO_PIECE;
+    mailbox[to] = piece;
+    hash ^= ZOBRIST.piece[piece][from] ^ ZOBRIST.piece[piece][to];
+}
+
+/**
+ * @brief Recomputes the hash from the piece placement and state.
+ */
+uint64_t EngineBoard::computeHash() const
+{
+    uint64_t h = 0;
+    for (int sq = 0; sq < 64; sq++)
+    {
+        if (mailbox[sq] != NO_PIECE)
+        {
+            h ^= ZOBRIST.piece[mailbox[sq]][sq];
+        }
+    }
+    h ^= ZOBRIST.castling[castling];
+    if (epSquare != NO_SQUARE)
+    {
+        h ^= ZOBRIST.ep[epSquare & 7];
+    }
+    if (side == BLACK)
+    {
+        h ^= ZOBRIST.side;
+    }
+    return h;
+}
+
+/**
+ * @brief Loads a position from a FEN string.
+ *
+ * The placement, side, castling and en passant fields are required; the
+ * two move clocks default to 0 and 1.
+ *
+ * @param fen The FEN text.
+ * @return True if the FEN was valid; on failure the board is left unchanged.
+ */
+bool EngineBoard::loadFen(const string& fen)
+{
+    istringstream fields(fen);
+    string placement, sideText, castlingText, epText;
+    int halfmove = 0, fullmove = 1;
+
+    if (!(fields >> placement >> sideText >> castlingText >> epText))
+    {
+        return false;
+    }
+    if (!(fields >> halfmove))
+    {
+        halfmove = 0;
+    }
+    if (!(fields >> fullmove))
+    {
+        fullmove = 1;
+    }
+
+    //Parse the placement into a scratch mailbox first so bad input leaves the board untouched
+    int squares[64];
+    int sq = 0;
+    for (char ch : placement)
+    {
+        if (ch == '/')
+        {
+            if (sq % 8 != 0)
+            {
+                return false;
+            }
+            continue;
+        }
+        if (ch >= '1' && ch <= '8')
+        {
+            for (int i = 0; i < ch - '0'; i++)
+            {
+                if (sq >= 64)
+                {
+                    return false;
+                }
+                squares[sq++] = NO_PIECE;
+            }
+            continue;
+        }
+
+        const char* found = nullptr;
+        for (const char* p = PIECE_CHARS; *p; p++)
+        {
+            if (*p == ch)
+            {
+                found = p;
+            }
+        }
+        if (!found || sq >= 64)
+        {
+            return false;
+        }
+        squares[sq++] = static_cast<int>(found - PIECE_CHARS);
+    }
+    if (sq != 64 || !validPlacement(squares))
+    {
+        return false;
+    }
+    if (sideText != "w" && sideText != "b")
+    {
+        return false;
+    }
+
+    int rights = 0;
+    if (castlingText != "-")
+    {
+        for (char ch : castlingText)
+        {
+            switch (ch)
+            {
+            case 'K': rights |= WHITE_KINGSIDE; break;
+            case 'Q': rights |= WHITE_QUEENSIDE; break;
+            case 'k': rights |= BLACK_KINGSIDE; break;
+            case 'q': rights |= BLACK_QUEENSIDE; break;
+            default: return false;
+            }
+        }
+    }
+
+    int ep = NO_SQUARE;
+    if (epText != "-")
+    {
+        if (epText.size() != 2 || epText[0] < 'a' || epText[0] > 'h' || (epText[1] != '3' && epText[1] != '6'))
+        {
+            return false;
+        }
+        ep = ('8' - epText[1]) * 8 + (epText[0] - 'a');
+    }
+
+    //Input is valid: rebuild the position
+    setPosition(squares, (sideText == "w") ? WHITE : BLACK, rights, ep, halfmove, fullmove);
+    return true;
+}
+
+/**
+ * @brief Checks a piece placement: one king per side and no pawns on the back ranks.
+ */
+bool EngineBoard::validPlacement(const int squares[64])
+{
+    int kings[2] = { 0, 0 };
+    for (int sq = 0; sq < 64; sq++)
+    {
+        int piece = squares[sq];
+        if (piece == NO_PIECE)
+        {
+            continue;
+        }
+        if (piece % 6 == KING)
+        {
+            kings[piece / 6]++;
+        }
+        if (piece % 6 == PAWN && (sq < 8 || sq >= 56))
+        {
+            //Pawns can never stand on the first or eighth rank
+            return false;
+        }
+    }
+    return kings[WHITE] == 1 && kings[BLACK] == 1;
+}
+
+/**
+ * @brief Replaces the position with a checked placement and state.
+ */
+void EngineBoard::setPosition(const int squares[64], int sideToMove, int rights, int ep, int halfmove, int fullmove)
+{
+    for (int i = 0; i < 12; i++)
+    {
+        pieceBB[i] = 0;
+    }
+    colorBB[WHITE] = colorBB[BLACK] = 0;
+    occupiedBB = 0;
+    hash = 0;
+    for (int i = 0; i < 64; i++)
+    {
+        mailbox[i] = NO_PIECE;
+        if (squares[i] != NO_PIECE)
+        {
+            putPiece(squares[i], i);
+        }
+    }
+
+    side = sideToMove;
+
+    //Drop castling rights whose king or rook is not on its home square
+    const struct { int right; int king; int rook; int piece; } homes[] =
+    {
+        { WHITE_KINGSIDE, E1, H1, WHITE * 6 }, { WHITE_QUEENSIDE, E1, A1, WHITE * 6 },
+        { BLACK_KINGSIDE, E8, H8, BLACK * 6 }, { BLACK_QUEENSIDE, E8, A8, BLACK * 6 }
+    };
+    for (const auto& home : homes)
+    {
+        if (mailbox[home.king] != home.piece + KING || mailbox[home.rook] != home.piece + ROOK)
+        {
+            rights &= ~home.right;
+        }
+    }
+    castling = rights;
+
+    //Keep the en passant square only if a pawn just double-stepped past it: its origin is empty too
+    if (ep != NO_SQUARE)
+    {
+        int pusher = (side == WHITE) ? ep + 8 : ep - 8;
+        int origin = (side == WHITE) ? ep - 8 : ep + 8;
+        bool rankMatches = Bitboards::rowOf(ep) == ((side == WHITE) ? 2 : 5);
+        if (!rankMatches || mailbox[ep] != NO_PIECE || mailbox[pusher] != (side ^ 1) * 6 + PAWN
+            || mailbox[origin] != NO_PIECE)
+        {
+            ep = NO_SQUARE;
+        }
+    }
+    epSquare = ep;
+    halfmoveClock = halfmove;
+    fullmoveNumber = fullmove;
+    history.clear();
+    hash = computeHash();
+}
+
+/**
+ * @brief Writes the position as a FEN string.
+ */
+string EngineBoard::toFen() const
+{
+    string fen;
+    for (int row = 0; row < 8; row++)
+    {
+        int empty = 0;
+        for (int col = 0; col < 8; col++)
+        {
+            int piece = mailbox[row * 8 + col];
+            if (piece == NO_PIECE)
+            {
+                empty++;
+                continue;
+            }
+            if (empty)
+            {
+                fen += static_cast<char>('0' + empty);
+                empty = 0;
+            }
+            fen += PIECE_CHARS[piece];
+        }
+        if (empty)
+        {
+            fen += static_cast<char>('0' + empty);
+        }
+        if (row < 7)
+        {
+            fen += '/';
+        }
+    }
+
+    fen += (side == WHITE) ? " w " : " b ";
+
+    if (castling == 0)
+    {
+        fen += '-';
+    }
+    else
+    {
+        if (castling & WHITE_KINGSIDE) fen += 'K';
+        if (castling & WHITE_QUEENSIDE) fen += 'Q';
+        if (castling & BLACK_KINGSIDE) fen += 'k';
+        if (castling & BLACK_QUEENSIDE) fen += 'q';
+    }
+
+    if (epSquare == NO_SQUARE)
+    {
+        fen += " -";
+    }
+    else
+    {
+        fen += ' ';
+        fen += static_cast<char>('a' + (epSquare & 7));
+        fen += static_cast<char>('8' - (epSquare >> 3));
+    }
+
+    fen += " " + to_string(halfmoveClock) + " " + to_string(fullmoveNumber);
+    return fen;
+}
+
+/**
+ * @brief Copies the position into a snapshot.
+ */
+BoardSnapshot EngineBoard::snapshot() const
+{
+    BoardSnapshot snap = {};
+    for (int sq = 0; sq < 64; sq++)
+    {
+        if (mailbox[sq] != NO_PIECE)
+        {
+            snap.setCode(sq, mailbox[sq] + 1);
+        }
+    }
+    snap.side = static_cast<uint8_t>(side);
+    snap.castling = static_cast<uint8_t>(castling);
+    snap.enPassant = static_cast<int8_t>(epSquare == NO_SQUARE ? BoardSnapshot::NO_EN_PASSANT : epSquare);
+    snap.halfmoveClock = static_cast<uint8_t>(min(halfmoveClock, 255));
+    snap.fullmoveNumber = static_cast<uint16_t>(min(fullmoveNumber, 65535));
+    snap.hash = hash;
+    return snap;
+}
+
+/**
+ * @brief Loads a position from a snapshot, without going through FEN.
+ */
+bool EngineBoard::loadSnapshot(const BoardSnapshot& snap)
+{
+    int squares[64];
+    for (int sq = 0; sq < 64; sq++)
+    {
+        int code = snap.codeAt(sq);
+        if (code > 12)
+        {
+            return false;
+        }
+        squares[sq] = (code == 0) ? NO_PIECE : code - 1;
+    }
+    if (!validPlacement(squares) || snap.side > BLACK || snap.castling > 15
+        || snap.enPassant < BoardSnapshot::NO_EN_PASSANT || snap.enPassant >= 64)
+    {
+        return false;
+    }
+
+    int ep = (snap.enPassant == BoardSnapshot::NO_EN_PASSANT) ? NO_SQUARE : snap.enPassant;
+    setPosition(squares, snap.side, snap.castling, ep, snap.halfmoveClock, snap.fullmoveNumber);
+    return true;
+}
+
+/**
+ * @brief Computes the Zobrist hash a snapshot's position has on an EngineBoard.
+ */
+uint64_t EngineBoard::snapshotHash(const BoardSnapshot& snap)
+{
+    uint64_t h = 0;
+    for (int sq = 0; sq < 64; sq++)
+    {
+        int code = snap.codeAt(sq);
+        if (code != 0 && code <= 12)
+        {
+            h ^= ZOBRIST.piece[code - 1][sq];
+        }
+    }
+    h ^= ZOBRIST.castling[snap.castling & 15];
+    if (snap.enPassant != BoardSnapshot::NO_EN_PASSANT)
+    {
+        h ^= ZOBRIST.ep[snap.enPassant & 7];
+    }
+    if (snap.side == BLACK)
+    {
+        h ^= ZOBRIST.side;
+    }
+    return h;
+}
+
+/**
+ * @brief Returns all pieces of either color that attack a square.
+ *
+ * Works backwards from the target: a knight attacks the square if a knight
+ * stands a knight's move away, and so on for every piece kind.
+ */
+uint64_t EngineBoard::attackersTo(int sq, uint64_t occupied) const
+{
+    uint64_t bishops = pieceBB[BISHOP] | pieceBB[QUEEN] | pieceBB[6 + BISHOP] | pieceBB[6 + QUEEN];
+    uint64_t rooks = pieceBB[ROOK] | pieceBB[QUEEN] | pieceBB[6 + ROOK] | pieceBB[6 + QUEEN];
+
+    return (Bitboards::pawnAttacks(BLACK, sq) & pieceBB[PAWN])
+        | (Bitboards::pawnAttacks(WHITE, sq) & pieceBB[6 + PAWN])
+        | (Bitboards::knightAttacks(sq) & (pieceBB[KNIGHT] | pieceBB[6 + KNIGHT]))
+        | (Bitboards::kingAttacks(sq) & (pieceBB[KING] | pieceBB[6 + KING]))
+        | (Bitboards::bishopAttacks(sq, occupied) & bishops)
+        | (Bitboards::rookAttacks(sq, occupied) & rooks);
+}
+
+/**
+ * @brief Checks whether a square is attacked by the given color.
+ */
+bool EngineBoard::isSquareAttacked(int sq, int byColor) const
+{
+    int base = byColor * 6;
+
+    //A pawn of byColor attacks sq if a pawn of the other color on sq would attack it back
+    if (Bitboards::pawnAttacks(byColor ^ 1, sq) & pieceBB[base + PAWN])
+    {
+        return true;
+    }
+    if (Bitboards::knightAttacks(sq) & pieceBB[base + KNIGHT])
+    {
+        return true;
+    }
+    if (Bitboards::kingAttacks(sq) & pieceBB[base + KING])
+    {
+        return true;
+    }
+    if (Bitboards::bishopAttacks(sq, occupiedBB) & (pieceBB[base + BISHOP] | pieceBB[base + QUEEN]))
+    {
+        return true;
+    }
+    return (Bitboards::rookAttacks(sq, occupiedBB) & (pieceBB[base + ROOK] | pieceBB[base + QUEEN])) != 0;
+}
+
+/**
+ * @brief Adds the four promotion moves (or promotion captures) for one pawn move.
+ */
+static void addPromotions(MoveList& list, int from, int to, bool capture)
+{
+    int base = capture ? Move::PROMO_CAPTURE_KNIGHT : Move::PROMO_KNIGHT;
+    for (int i = 3; i >= 0; i--)
+    {
+        list.add(Move(from, to, base + i));
+    }
+}
+
+/**
+ * @brief Adds a move to every target square, each from the target minus a fixed offset.
+ */
+static void addPawnMoves(MoveList& list, uint64_t targets, int delta, int flag)
+{
+    while (targets)
+    {
+        int to = Bitboards::popLsb(targets);
+        list.add(Move(to - delta, to, flag));
+    }
+}
+
+/**
+ * @brief Adds the four promotions to every target square, each from the target minus a fixed offset.
+ */
+static void addPawnPromotions(MoveList& list, uint64_t targets, int delta, bool capture)
+{
+    while (targets)
+    {
+        int to = Bitboards::popLsb(targets);
+        addPromotions(list, to - delta, to, capture);
+    }
+}
+
+/**
+ * @brief Adds the pawn moves of one side, all pawns at once.
+ *
+ * Each kind of pawn move is one shift of the whole pawn set: a push one
+ * row forward into an empty square, a second push from it onto the
+ * double-push row, and a capture toward each side with the wrapped edge
+ * file masked out. Targets on the last row become promotions. En passant
+ * capturers are the pawns a pawn on the target square would attack.
+ */
+template <int US, GenType TYPE>
+void EngineBoard::generatePawnMoves(MoveList& list) const
+{
+    typedef SideTraits<US> Side;
+    const int forward = Side::FORWARD;
+    uint64_t pawns = pieceBB[US * 6 + PAWN];
+    uint64_t empty = ~occupiedBB;
+    uint64_t enemy = colorBB[Side::THEM];
+
+    //Toward the A file the origin is one column right of the target, so a target on the H file wrapped
+    uint64_t single = Bitboards::shift(pawns, forward) & empty;
+    uint64_t westCaptures = Bitboards::shift(pawns, forward - 1) & enemy & ~FILE_H_SQUARES;
+    uint64_t eastCaptures = Bitboards::shift(pawns, forward + 1) & enemy & ~FILE_A_SQUARES;
+
+    if (TYPE == GEN_CAPTURES)
+    {
+        addPawnMoves(list, single & Side::PROMO_ROW, forward, Move::PROMO_QUEEN);
+        addPawnMoves(list, westCaptures & Side::PROMO_ROW, forward - 1, Move::PROMO_CAPTURE_QUEEN);
+        addPawnMoves(list, eastCaptures & Side::PROMO_ROW, forward + 1, Move::PROMO_CAPTURE_QUEEN);
+    }
+    else
+    {
+        addPawnMoves(list, single & ~Side::PROMO_ROW, forward, Move::QUIET);
+        addPawnMoves(list, Bitboards::shift(single, forward) & empty & Side::DOUBLE_ROW, 2 * forward, Move::DOUBLE_PUSH);
+        addPawnPromotions(list, single & Side::PROMO_ROW, forward, false);
+        addPawnPromotions(list, westCaptures & Side::PROMO_ROW, forward - 1, true);
+        addPawnPromotions(list, eastCaptures & Side::PROMO_ROW, forward + 1, true);
+    }
+    addPawnMoves(list, westCaptures & ~Side::PROMO_ROW, forward - 1, Move::CAPTURE);
+    addPawnMoves(list, eastCaptures & ~Side::PROMO_ROW, forward + 1, Move::CAPTURE);
+
+    if (epSquare != NO_SQUARE)
+    {
+        uint64_t capturers = Bitboards::pawnAttacks(Side::THEM, epSquare) & pawns;
+        while (capturers)
+        {
+            list.add(Move(Bitboards::popLsb(capturers), epSquare, Move::EN_PASSANT));
+        }
+    }
+}
+
+/**
+ * @brief Checks that an en passant capture does not expose the mover's king.
+ *
+ * Looks at the sliders' lines to the king with the capturing pawn moved
+ * and the captured pawn gone, which covers the row through both pawns as
+ * well as an ordinary pin of the capturing pawn.
+ */
+bool EngineBoard::enPassantKeepsKingSafe(int from) const
+{
+    int us = side;
+    int them = us ^ 1;
+    int king = kingSquare(us);
+    int captured = epSquare + ((us == WHITE) ? 8 : -8);
+    uint64_t after = (occupiedBB ^ Bitboards::squareBit(from) ^ Bitboards::squareBit(captured))
+        | Bitboards::squareBit(epSquare);
+    return !(Bitboards::rookAttacks(king, after) & (pieceBB[them * 6 + ROOK] | pieceBB[them * 6 + QUEEN]))
+        && !(Bitboards::bishopAttacks(king, after) & (pieceBB[them * 6 + BISHOP] | pieceBB[them * 6 + QUEEN]));
+}
+
+/**
+ * @brief Generates the pseudo-legal moves of one side of one kind.
+ *
+ * Pawns are generated set-wise; pieces use the attack tables, with
+ * friendly squares masked out for all moves and everything but enemy
+ * pieces masked out for captures. Castling needs the rights, empty
+ * squares between king and rook and a king that does not pass through
+ * check.
+ */
+template <int US, GenType TYPE>
+void EngineBoard::generate(MoveList& list) const
+{
+    typedef SideTraits<US> Side;
+    uint64_t enemy = colorBB[Side::THEM];
+    uint64_t allowed = (TYPE == GEN_CAPTURES) ? enemy : ~colorBB[US];
+
+    generatePawnMoves<US, TYPE>(list);
+
+    //Knights, bishops, rooks, queens and the king
+    for (int type = KNIGHT; type <= KING; type++)
+    {
+        uint64_t movers = pieceBB[US * 6 + type];
+        while (movers)
+        {
+            int from = Bitboards::popLsb(movers);
+            uint64_t targets;
+            switch (type)
+            {
+            case KNIGHT: targets = Bitboards::knightAttacks(from); break;
+            case BISHOP: targets = Bitboards::bishopAttacks(from, occupiedBB); break;
+            case ROOK:   targets = Bitboards::rookAttacks(from, occupiedBB); break;
+            case QUEEN:  targets = Bitboards::queenAttacks(from, occupiedBB); break;
+            default:     targets = Bitboards::kingAttacks(from); break;
+            }
+            targets &= allowed;
+
+            while (targets)
+            {
+                int to = Bitboards::popLsb(targets);
+                list.add(Move(from, to, (enemy & Bitboards::squareBit(to)) ? Move::CAPTURE : Move::QUIET));
+            }
+        }
+    }
+
+    if (TYPE == GEN_CAPTURES)
+    {
+        return;
+    }
+    const int king = Side::KING_FROM;
+    if ((castling & Side::KINGSIDE) && !(occupiedBB & Side::KINGSIDE_PATH)
+        && !isSquareAttacked(king, Side::THEM) && !isSquareAttacked(king + 1, Side::THEM))
+    {
+        list.add(Move(king, king + 2, Move::KING_CASTLE));
+    }
+    if ((castling & Side::QUEENSIDE) && !(occupiedBB & Side::QUEENSIDE_PATH)
+        && !isSquareAttacked(king, Side::THEM) && !isSquareAttacked(king - 1, Side::THEM))
+    {
+        list.add(Move(king, king - 2, Move::QUEEN_CASTLE));
+    }
+}
+
+/**
+ * @brief Generates all pseudo-legal moves for one side.
+ */
+template <int US>
+void EngineBoard::generateMoves(MoveList& list) const
+{
+    generate<US, GEN_ALL>(list);
+}
+
+/**
+ * @brief Generates captures and queen promotions for one side.
+ */
+template <int US>
+void EngineBoard::generateCaptures(MoveList& list) const
+{
+    generate<US, GEN_CAPTURES>(list);
+}
+
+/**
+ * @brief Generates all pseudo-legal moves for the side to move.
+ */
+void EngineBoard::generateMoves(MoveList& list) const
+{
+    if (side == WHITE)
+    {
+        generate<WHITE, GEN_ALL>(list);
+    }
+    else
+    {
+        generate<BLACK, GEN_ALL>(list);
+    }
+}
+
+/**
+ * @brief Generates captures and queen promotions for quiescence search.
+ */
+void EngineBoard::generateCaptures(MoveList& list) const
+{
+    if (side == WHITE)
+    {
+        generate<WHITE, GEN_CAPTURES>(list);
+    }
+    else
+    {
+        generate<BLACK, GEN_CAPTURES>(list);
+    }
+}
+
+/**
+ * @brief Finds the pieces of a color that may be pinned to their king.
+ *
+ * Looks through the nearest piece on each line from the king: if it is
+ * one of ours and a matching enemy slider stands behind it, it is pinned.
+ */
+uint64_t EngineBoard::pinnedPieces(int color) const
+{
+    int king = kingSquare(color);
+    int enemy = color ^ 1;
+    uint64_t own = colorBB[color];
+    uint64_t pinned = 0;
+
+    uint64_t rookLines = Bitboards::rookAttacks(king, occupiedBB);
+    uint64_t shields = rookLines & own;
+    uint64_t pinners = Bitboards::rookAttacks(king, occupiedBB ^ shields) & ~rookLines
+        & (pieces(enemy, ROOK) | pieces(enemy, QUEEN));
+    while (pinners)
+    {
+        pinned |= Bitboards::rookAttacks(Bitboards::popLsb(pinners), occupiedBB) & shields;
+    }
+
+    uint64_t bishopLines = Bitboards::bishopAttacks(king, occupiedBB);
+    shields = bishopLines & own;
+    pinners = Bitboards::bishopAttacks(king, occupiedBB ^ shields) & ~bishopLines
+        & (pieces(enemy, BISHOP) | pieces(enemy, QUEEN));
+    while (pinners)
+    {
+        pinned |= Bitboards::bishopAttacks(Bitboards::popLsb(pinners), occupiedBB) & shields;
+    }
+    return pinned;
+}
+
+/**
+ * @brief Generates only the fully legal moves.
+ *
+ * The pseudo-legal moves are filtered in place. A king move is legal if
+ * its destination is not attacked once the king has left its square
+ * (castling has had its other squares checked by the generator). Out of
+ * check, a move by a piece other than the king that is not pinned cannot
+ * expose the king, so it is kept without being played; an en passant
+ * capture is checked against the sliders' lines instead. Every other move
+ * is tried on the board.
+ */
+void EngineBoard::generateLegalMoves(MoveList& list)
+{
+    list.count = 0;
+    generateMoves(list);
+
+    int king = kingSquare(side);
+    uint64_t kingBit = Bitboards::squareBit(king);
+    uint64_t enemy = colorBB[side ^ 1];
+    bool checked = inCheck();
+    uint64_t unsafe = checked ? ~0ULL : (pinnedPieces(side) | kingBit);
+    int kept = 0;
+    for (int i = 0; i < list.count; i++)
+    {
+        Move m = list.moves[i];
+        bool legal;
+        if (m.getFrom() == king)
+        {
+            legal = !(attackersTo(m.getTo(), occupiedBB ^ kingBit) & enemy);
+        }
+        else if (m.getFlag() == Move::EN_PASSANT && !checked)
+        {
+            legal = enPassantKeepsKingSafe(m.getFrom());
+        }
+        else if (!(unsafe & Bitboards::squareBit(m.getFrom())))
+        {
+            legal = true;
+        }
+        else if (!checked && (Bitboards::line(king, m.getFrom()) & Bitboards::squareBit(m.getTo())))
+        {
+            //A pinned piece stays legal while it moves along the line through its king
+            legal = true;
+        }
+        else
+        {
+            legal = makeMove(m);
+            if (legal)
+            {
+                unmakeMove();
+            }
+        }
+        if (legal)
+        {
+            list.moves[kept++] = m;
+        }
+    }
+    list.count = kept;
+}
+
+/**
+ * @brief Plays a pseudo-legal move of one side.
+ *
+ * Handles captures, en passant, castling (moving the rook as well) and
+ * promotions, and updates rights, clocks and the hash incrementally.
+ *
+ * @param m The move to play.
+ * @return False (with the board unchanged) if the move leaves the mover's king in check.
+ */
+template <int US>
+bool EngineBoard::makeMove(Move m)
+{
+    typedef SideTraits<US> Side;
+    int from = m.getFrom();
+    int to = m.getTo();
+    int flag = m.getFlag();
+    int piece = mailbox[from];
+
+    StateInfo st;
+    st.move = m;
+    st.captured = NO_PIECE;
+    st.castling = castling;
+    st.epSquare = epSquare;
+    st.halfmoveClock = halfmoveClock;
+    st.hash = hash;
+
+    //Clear the old en passant and castling keys; new ones are added below
+    if (epSquare != NO_SQUARE)
+    {
+        hash ^= ZOBRIST.ep[epSquare & 7];
+    }
+    hash ^= ZOBRIST.castling[castling];
+    epSquare = NO_SQUARE;
+    halfmoveClock++;
+
+    if (flag == Move::EN_PASSANT)
+    {
+        int victim = to - Side::FORWARD;
+        st.captured = mailbox[victim];
+        removePiece(victim);
+        halfmoveClock = 0;
+    }
+    else if (m.isCapture())
+    {
+        st.captured = mailbox[to];
+        removePiece(to);
+        halfmoveClock = 0;
+    }
+
+    shiftPiece(from, to);
+
+    if (piece == US * 6 + PAWN)
+    {
+        halfmoveClock = 0;
+        if (flag == Move::DOUBLE_PUSH)
+        {
+            epSquare = (from + to) / 2;
+            hash ^= ZOBRIST.ep[epSquare & 7];
+        }
+        else if (m.isPromotion())
+        {
+            removePiece(to);
+            putPiece(US * 6 + m.promotionType(), to);
+        }
+    }
+    else if (flag == Move::KING_CASTLE)
+    {
+        shiftPiece(to + 1, to - 1);
+    }
+    else if (flag == Move::QUEEN_CASTLE)
+    {
+        shiftPiece(to - 2, to + 1);
+    }
+
+    castling &= ZOBRIST.castlingMask[from] & ZOBRIST.castlingMask[to];
+    hash ^= ZOBRIST.castling[castling];
+
+    side = Side::THEM;
+    hash ^= ZOBRIST.side;
+    if (US == BLACK)
+    {
+        fullmoveNumber++;
+    }
+    history.push_back(st);
+
+    //Reject moves that leave our own king attacked
+    if (isSquareAttacked(kingSquare(US), Side::THEM))
+    {
+        unmakeMove<US>();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Takes back the last move, which was made by the given side.
+ */
+template <int US>
+void EngineBoard::unmakeMove()
+{
+    typedef SideTraits<US> Side;
+    StateInfo st = history.back();
+    history.pop_back();
+
+    Move m = st.move;
+    int from = m.getFrom();
+    int to = m.getTo();
+    int flag = m.getFlag();
+
+    side = US;
+    if (US == BLACK)
+    {
+        fullmoveNumber--;
+    }
+
+    if (m.isPromotion())
+    {
+        removePiece(to);
+        putPiece(US * 6 + PAWN, to);
+    }
+    else if (flag == Move::KING_CASTLE)
+    {
+        shiftPiece(to - 1, to + 1);
+    }
+    else if (flag == Move::QUEEN_CASTLE)
+    {
+        shiftPiece(to + 1, to - 2);
+    }
+
+    shiftPiece(to, from);
+
+    if (flag == Move::EN_PASSANT)
+    {
+        putPiece(st.captured, to - Side::FORWARD);
+    }
+    else if (st.captured != NO_PIECE)
+    {
+        putPiece(st.captured, to);
+    }
+
+    castling = st.castling;
+    epSquare = st.epSquare;
+    halfmoveClock = st.halfmoveClock;
+    hash = st.hash;
+}
+
+/**
+ * @brief Plays a pseudo-legal move.
+ *
+ * @param m The move to play.
+ * @return False (with the board unchanged) if the move leaves the mover's king in check.
+ */
+bool EngineBoard::makeMove(Move m)
+{
+    return (side == WHITE) ? makeMove<WHITE>(m) : makeMove<BLACK>(m);
+}
+
+/**
+ * @brief Takes back the last move made with makeMove().
+ */
+void EngineBoard::unmakeMove()
+{
+    //The side that made the move is the one not to move now
+    if (side == BLACK)
+    {
+        unmakeMove<WHITE>();
+    }
+    else
+    {
+        unmakeMove<BLACK>();
+    }
+}
+
+/**
+ * @brief Passes the turn without moving.
+ */
+void EngineBoard::makeNullMove()
+{
+    StateInfo st;
+    st.move = Move();
+    st.captured = NO_PIECE;
+    st.castling = castling;
+    st.epSquare = epSquare;
+    st.halfmoveClock = halfmoveClock;
+    st.hash = hash;
+    history.push_back(st);
+
+    if (epSquare != NO_SQUARE)
+    {
+        hash ^= ZOBRIST.ep[epSquare & 7];
+        epSquare = NO_SQUARE;
+    }
+    halfmoveClock++;
+    side ^= 1;
+    hash ^= ZOBRIST.side;
+}
+
+/**
+ * @brief Takes back the last null move.
+ */
+void EngineBoard::unmakeNullMove()
+{
+    StateInfo st = history.back();
+    history.pop_back();
+
+    side ^= 1;
+    epSquare = st.epSquare;
+    halfmoveClock = st.halfmoveClock;
+    hash = st.hash;
+}
+
+/**
+ * @brief Checks whether the position repeats an earlier one.
+ *
+ * Only positions with the same side to move and no irreversible move in
+ * between can repeat, so the scan steps back two plies at a time and stops
+ * after halfmoveClock plies.
+ */
+bool EngineBoard::isRepetition() const
+{
+    int n = static_cast<int>(history.size());
+    for (int back = 2; back <= halfmoveClock && back <= n; back += 2)
+    {
+        if (history[n - back].hash == hash)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Checks for draws by repetition, the fifty-move rule or insufficient material.
+ */
+bool EngineBoard::isDraw() const
+{
+    if (halfmoveClock >= 100 || isRepetition())
+    {
+        return true;
+    }
+
+    //King versus king, or king and one minor piece versus king
+    uint64_t heavy = pieceBB[PAWN] | pieceBB[ROOK] | pieceBB[QUEEN]
+        | pieceBB[6 + PAWN] | pieceBB[6 + ROOK] | pieceBB[6 + QUEEN];
+    if (heavy)
+    {
+        return false;
+    }
+    uint64_t minors = pieceBB[KNIGHT] | pieceBB[BISHOP] | pieceBB[6 + KNIGHT] | pieceBB[6 + BISHOP];
+    return Bitboards::popCount(minors) <= 1;
+}
+
+/**
+ * @brief Sums the material of a side's knights, bishops, rooks and queens.
+ */
+int EngineBoard::nonPawnMaterial(int color) const
+{
+    int total = 0;
+    for (int type = KNIGHT; type <= QUEEN; type++)
+    {
+        total += Bitboards::popCount(pieceBB[color * 6 + type]) * PIECE_MATERIAL[type];
+    }
+    return total;
+}
+
+/**
+ * @brief Counts leaf nodes of the legal move tree with one side to move.
+ *
+ * The two sides alternate, so each ply calls the other side's instance
+ * and never looks at the side to move at run time.
+ */
+template <int US>
+uint64_t EngineBoard::perft(int depth)
+{
+    if (depth == 0)
+    {
+        return 1;
+    }
+
+    MoveList list;
+    generate<US, GEN_ALL>(list);
+    uint64_t nodes = 0;
+    for (int i = 0; i < list.size(); i++)
+    {
+        if (makeMove<US>(list[i]))
+        {
+            nodes += perft<US ^ 1>(depth - 1);
+            unmakeMove<US>();
+        }
+    }
+    return nodes;
+}
+
+/**
+ * @brief Counts leaf nodes of the legal move tree to a fixed depth.
+ */
+uint64_t EngineBoard::perft(int depth)
+{
+    return (side == WHITE) ? perft<WHITE>(depth) : perft<BLACK>(depth);
+}
+
+/**
+ * @brief Finds the legal move matching coordinate notation.
+ *
+ * @return The move, or the null move if the text does not name a legal move.
+ */
+Move EngineBoard::parseMove(const string& text)
+{
+    MoveList list;
+    generateLegalMoves(list);
+    for (int i = 0; i < list.size(); i++)
+    {
+        if (list[i].toString() == text)
+        {
+            return list[i];
+        }
+    }
+    return Move();
+}
+
+//The side-specific entry points are used by the search as well
+template void EngineBoard::generateMoves<WHITE>(MoveList& list) const;
+template void EngineBoard::generateMoves<BLACK>(MoveList& list) const;
+template void EngineBoard::generateCaptures<WHITE>(MoveList& list) const;
+template void EngineBoard::generateCaptures<BLACK>(MoveList& list) const;
+template bool EngineBoard::makeMove<WHITE>(Move m);
+template bool EngineBoard::makeMove<BLACK>(Move m);
+template void EngineBoard::unmakeMove<WHITE>();
+template void EngineBoard::unmakeMove<BLACK>();
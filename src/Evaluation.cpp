@@ -0,0 +1,132 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Evaluation Class Implementation
+
+#include "Evaluation.h"
+#include "AttackMap.h"
+#include "EvalWeights.h"
+#include <algorithm>    //For min.
+
+const int Evaluation::PIECE_VALUE[6] = { 100, 320, 330, 500, 900, 20000 };
+
+//Game phase weight of each piece type; the full starting set sums to 24
+static const int PHASE_WEIGHT[6] = { 0, 1, 1, 2, 4, 0 };
+
+//Middlegame penalty per squared enemy attack on the king's square and its neighbours, and its cap
+static const int KING_ATTACK_WEIGHT = 2;
+static const int KING_ATTACK_CAP = 400;
+
+/**
+ * @brief Evaluates a position, optionally recording the terms the tuner needs.
+ *
+ * Adds up material, piece-square values, mobility and king safety for
+ * both phases from White's point of view, blends them by game phase, and
+ * flips the sign for Black. Mobility and king safety come from one
+ * AttackMap built for the whole board. With TRACE false the trace is never
+ * touched and the code is the plain evaluation.
+ *
+ * @param board The position to evaluate.
+ * @param trace Where the terms go when TRACE is true.
+ * @return The score in centipawns; positive favours the side to move.
+ */
+template <bool TRACE>
+static int evaluateTerms(const EngineBoard& board, EvalTrace* trace)
+{
+    int mg[2] = { 0, 0 };
+    int eg[2] = { 0, 0 };
+    int phase = 0;
+
+    uint64_t pieces[12];
+    for (int code = 0; code < 12; code++)
+    {
+        pieces[code] = board.pieces(code / 6, code % 6);
+    }
+    AttackMap attacks;
+    attacks.build(pieces);
+
+    for (int color = WHITE; color <= BLACK; color++)
+    {
+        int flip = (color == WHITE) ? 0 : 56;
+        for (int type = PAWN; type <= KING; type++)
+        {
+            uint64_t bb = board.pieces(color, type);
+            while (bb)
+            {
+                int sq = Bitboards::popLsb(bb) ^ flip;
+                mg[color] += MG_VALUE[type] + MG_PST[type][sq];
+                eg[color] += EG_VALUE[type] + EG_PST[type][sq];
+                phase += PHASE_WEIGHT[type];
+            }
+        }
+
+        if (Bitboards::popCount(board.pieces(color, BISHOP)) >= 2)
+        {
+            mg[color] += BISHOP_PAIR_MG;
+            eg[color] += BISHOP_PAIR_EG;
+            if (TRACE)
+            {
+                trace->bishopPair[color] = 1;
+            }
+        }
+
+        //Mobility: squares each piece type reaches that are not ours and not covered by enemy pawns
+        int enemy = color ^ 1;
+        uint64_t safe = ~board.pieces(color) & ~attacks.byType[enemy][PAWN];
+        for (int type = KNIGHT; type <= QUEEN; type++)
+        {
+            int reach = Bitboards::popCount(attacks.byType[color][type] & safe);
+            mg[color] += MOBILITY_MG[type] * reach;
+            eg[color] += MOBILITY_EG[type] * reach;
+            if (TRACE)
+            {
+                trace->mobility[color][type] = reach;
+            }
+        }
+
+        //King safety: every enemy attack on the king's zone counts, and they add up quickly
+        uint64_t kings = board.pieces(color, KING);
+        if (kings)
+        {
+            int king = Bitboards::lsb(kings);
+            int units = attacks.totalOn(enemy, Bitboards::kingAttacks(king) | Bitboards::squareBit(king));
+            int danger = min(KING_ATTACK_WEIGHT * units * units, KING_ATTACK_CAP);
+            mg[color] -= danger;
+            if (TRACE)
+            {
+                trace->kingDanger[color] = danger;
+            }
+        }
+    }
+
+    if (phase > 24)
+    {
+        phase = 24;
+    }
+    if (TRACE)
+    {
+        trace->phase = phase;
+    }
+
+    int mgScore = mg[WHITE] - mg[BLACK];
+    int egScore = eg[WHITE] - eg[BLACK];
+    int score = (mgScore * phase + egScore * (24 - phase)) / 24;
+
+    return (board.sideToMove() == WHITE) ? score : -score;
+}
+
+/**
+ * @brief Evaluates a position.
+ */
+int Evaluation::evaluate(const EngineBoard& board)
+{
+    return evaluateTerms<false>(board, nullptr);
+}
+
+/**
+ * @brief Evaluates a position and records its mobility, bishop pair, king safety and phase terms.
+ */
+int Evaluation::evaluate(const EngineBoard& board, EvalTrace& trace)
+{
+    trace = EvalTrace();
+    return evaluateTerms<true>(board, &trace);
+}
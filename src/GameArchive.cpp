@@ -0,0 +1,465 @@
+//Qusay Edkymish
+//Oct/19/2026
+//GameArchive Class Implementation
+
+#include "GameArchive.h"
+#include <cstring>      //For comparing magic bytes and snapshots.
+
+//Identifies an archive file; the last byte is the format version
+static const char FILE_MAGIC[8] = { 'C', 'H', 'E', 'S', 'S', 'G', 'A', '\0' };
+static const uint32_t FILE_VERSION = 1;
+
+//Game header flag: a BoardSnapshot with the start position follows the header
+static const uint8_t CUSTOM_START = 1;
+
+//Range coder normalisation bounds (carryless coder, 32-bit low and range)
+static const uint32_t RANGE_TOP = 1u << 24;
+static const uint32_t RANGE_BOTTOM = 1u << 16;
+
+/**
+ * @struct ArchiveFileHeader
+ * @brief Fixed fields at the start of an archive.
+ */
+struct ArchiveFileHeader
+{
+    char magic[8];              //FILE_MAGIC
+    uint32_t version;           //FILE_VERSION
+    uint32_t reserved;          //Zero
+};
+
+/**
+ * @struct ArchiveGameHeader
+ * @brief Fixed fields in front of every game.
+ */
+struct ArchiveGameHeader
+{
+    uint32_t payloadBytes;      //Length of the coded moves
+    uint16_t plies;             //Number of moves
+    uint8_t result;             //GameArchive::Result
+    uint8_t flags;              //CUSTOM_START or zero
+};
+
+/**
+ * @struct ArchiveTrailer
+ * @brief Fixed fields at the end of an archive, after the offset index.
+ */
+struct ArchiveTrailer
+{
+    uint64_t indexOffset;       //File offset of the first index entry
+    uint64_t gameCount;         //Number of games and index entries
+};
+
+/**
+ * @struct RangeEncoder
+ * @brief Codes symbols of known alphabet size into bytes.
+ */
+struct RangeEncoder
+{
+    string& out;
+    uint32_t low = 0;
+    uint32_t range = 0xFFFFFFFFu;
+
+    explicit RangeEncoder(string& output) : out(output) {}
+
+    /**
+     * @brief Codes one of total equally likely symbols.
+     */
+    void encode(uint32_t symbol, uint32_t total)
+    {
+        range /= total;
+        low += symbol * range;
+        while ((low ^ (low + range)) < RANGE_TOP || (range < RANGE_BOTTOM && ((range = (0u - low) & (RANGE_BOTTOM - 1)), true)))
+        {
+            out += static_cast<char>(low >> 24);
+            low <<= 8;
+            range <<= 8;
+        }
+    }
+
+    /**
+     * @brief Writes the fewest bytes that still select the final interval.
+     *
+     * The decoder reads zeros past the end, so trailing zero bytes of the
+     * chosen value are left out.
+     */
+    void flush()
+    {
+        for (int bytes = 0; bytes <= 4; bytes++)
+        {
+            uint64_t step = 1ULL << (32 - 8 * bytes);
+            uint64_t value = (static_cast<uint64_t>(low) + step - 1) / step * step;
+            if (value < static_cast<uint64_t>(low) + range)
+            {
+                for (int i = 0; i < bytes; i++)
+                {
+                    out += static_cast<char>(value >> (24 - 8 * i));
+                }
+                return;
+            }
+        }
+    }
+};
+
+/**
+ * @struct RangeDecoder
+ * @brief Reads symbols written by RangeEncoder.
+ */
+struct RangeDecoder
+{
+    const unsigned char* data;
+    size_t size;
+    size_t pos = 0;
+    uint32_t low = 0;
+    uint32_t range = 0xFFFFFFFFu;
+    uint32_t code = 0;
+
+    RangeDecoder(const string& input)
+        : data(reinterpret_cast<const unsigned char*>(input.data())), size(input.size())
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            code = (code << 8) | nextByte();
+        }
+    }
+
+    uint32_t nextByte()
+    {
+        return pos < size ? data[pos++] : 0;
+    }
+
+    /**
+     * @brief Reads one of total equally likely symbols.
+     *
+     * @return The symbol, or total if the data is damaged.
+     */
+    uint32_t decode(uint32_t total)
+    {
+        range /= total;
+        uint32_t symbol = (code - low) / range;
+        if (symbol >= total)
+        {
+            return total;
+        }
+        low += symbol * range;
+        while ((low ^ (low + range)) < RANGE_TOP || (range < RANGE_BOTTOM && ((range = (0u - low) & (RANGE_BOTTOM - 1)), true)))
+        {
+            code = (code << 8) | nextByte();
+            low <<= 8;
+            range <<= 8;
+        }
+        return symbol;
+    }
+};
+
+/**
+ * @brief Checks whether a game starts from the standard position.
+ */
+static bool isStandardStart(const BoardSnapshot& start)
+{
+    static const BoardSnapshot zero = {};
+    return start == zero;
+}
+
+/**
+ * @brief Sets a board to a game's start position.
+ */
+static bool setStart(EngineBoard& board, const BoardSnapshot& start)
+{
+    if (isStandardStart(start))
+    {
+        board.setStartPosition();
+        return true;
+    }
+    return board.loadSnapshot(start);
+}
+
+/**
+ * @brief Codes a game's moves as legal move indices.
+ *
+ * @param game The game to code.
+ * @param board Scratch board used to replay the game.
+ * @param payload Set to the coded moves.
+ * @return False if a move is not legal in its position or the start position is not valid.
+ */
+bool GameArchive::encode(const Game& game, EngineBoard& board, string& payload)
+{
+    payload.clear();
+    if (game.moves.size() > UINT16_MAX || !setStart(board, game.start))
+    {
+        return false;
+    }
+
+    RangeEncoder encoder(payload);
+    MoveList legal;
+    for (Move move : game.moves)
+    {
+        board.generateLegalMoves(legal);
+        int index = 0;
+        while (index < legal.size() && !(legal[index] == move))
+        {
+            index++;
+        }
+        if (index == legal.size())
+        {
+            return false;
+        }
+        encoder.encode(static_cast<uint32_t>(index), static_cast<uint32_t>(legal.size()));
+        board.makeMove(move);
+    }
+    encoder.flush();
+    return true;
+}
+
+/**
+ * @brief Replays coded moves through the move generator.
+ *
+ * @param payload The coded moves.
+ * @param plies The number of moves to decode.
+ * @param board Set to the game's start position on entry; left at its final position.
+ * @param moves Set to the decoded moves.
+ * @return False if the data does not describe legal moves.
+ */
+bool GameArchive::decode(const string& payload, int plies, EngineBoard& board, vector<Move>& moves)
+{
+    moves.clear();
+    moves.reserve(static_cast<size_t>(plies));
+
+    RangeDecoder decoder(payload);
+    MoveList legal;
+    for (int ply = 0; ply < plies; ply++)
+    {
+        board.generateLegalMoves(legal);
+        if (legal.size() == 0)
+        {
+            return false;
+        }
+        uint32_t index = decoder.decode(static_cast<uint32_t>(legal.size()));
+        if (index >= static_cast<uint32_t>(legal.size()))
+        {
+            return false;
+        }
+        moves.push_back(legal[static_cast<int>(index)]);
+        board.makeMove(legal[static_cast<int>(index)]);
+    }
+    return true;
+}
+
+/**
+ * @brief Constructs a writer with no file open.
+ */
+GameArchive::Writer::Writer() : position(0)
+{
+}
+
+/**
+ * @brief Creates the archive file and writes its header.
+ *
+ * @param path The file to create; an existing file is replaced.
+ * @return False if the file cannot be written.
+ */
+bool GameArchive::Writer::open(const string& path)
+{
+    close();
+    file.open(path, ios::binary | ios::trunc);
+    if (!file)
+    {
+        return false;
+    }
+
+    ArchiveFileHeader header = {};
+    memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+    header.version = FILE_VERSION;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    offsets.clear();
+    position = sizeof(header);
+    return static_cast<bool>(file);
+}
+
+/**
+ * @brief Appends a game.
+ *
+ * @param game The game to store.
+ * @return False if the game holds an illegal move or the write failed.
+ */
+bool GameArchive::Writer::add(const Game& game)
+{
+    if (!file.is_open() || !encode(game, board, payload))
+    {
+        return false;
+    }
+
+    ArchiveGameHeader header = {};
+    header.payloadBytes = static_cast<uint32_t>(payload.size());
+    header.plies = static_cast<uint16_t>(game.moves.size());
+    header.result = static_cast<uint8_t>(game.result);
+    header.flags = isStandardStart(game.start) ? 0 : CUSTOM_START;
+
+    offsets.push_back(position);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    position += sizeof(header);
+    if (header.flags & CUSTOM_START)
+    {
+        file.write(reinterpret_cast<const char*>(&game.start), sizeof(game.start));
+        position += sizeof(game.start);
+    }
+    file.write(payload.data(), static_cast<streamsize>(payload.size()));
+    position += payload.size();
+    return static_cast<bool>(file);
+}
+
+/**
+ * @brief Writes the index and trailer and closes the file.
+ *
+ * @return False if the file was not open or a write failed.
+ */
+bool GameArchive::Writer::close()
+{
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    ArchiveTrailer trailer = {};
+    trailer.indexOffset = position;
+    trailer.gameCount = offsets.size();
+    file.write(reinterpret_cast<const char*>(offsets.data()), static_cast<streamsize>(offsets.size() * sizeof(uint64_t)));
+    file.write(reinterpret_cast<const char*>(&trailer), sizeof(trailer));
+    bool ok = static_cast<bool>(file);
+    file.close();
+    return ok;
+}
+
+/**
+ * @brief Closes the file if close() was not called.
+ */
+GameArchive::Writer::~Writer()
+{
+    close();
+}
+
+/**
+ * @brief Constructs a reader with no file open.
+ */
+GameArchive::Reader::Reader() : nextGame(0), streamGame(UINT64_MAX)
+{
+}
+
+/**
+ * @brief Opens an archive and loads its offset index.
+ *
+ * @param path The archive file.
+ * @param error Set to a short reason on failure.
+ * @return False if the file is missing or not a valid archive.
+ */
+bool GameArchive::Reader::open(const string& path, string& error)
+{
+    file.close();
+    file.clear();
+    offsets.clear();
+    nextGame = 0;
+    streamGame = UINT64_MAX;
+
+    file.open(path, ios::binary);
+    if (!file)
+    {
+        error = "cannot open " + path;
+        return false;
+    }
+
+    ArchiveFileHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) || memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0)
+    {
+        error = "not a game archive";
+        return false;
+    }
+    if (header.version != FILE_VERSION)
+    {
+        error = "archive format version " + to_string(header.version) + " is not supported";
+        return false;
+    }
+
+    file.seekg(0, ios::end);
+    uint64_t fileSize = static_cast<uint64_t>(file.tellg());
+    ArchiveTrailer trailer;
+    if (fileSize < sizeof(header) + sizeof(trailer))
+    {
+        error = "archive is truncated";
+        return false;
+    }
+    file.seekg(static_cast<streamoff>(fileSize - sizeof(trailer)));
+    file.read(reinterpret_cast<char*>(&trailer), sizeof(trailer));
+    if (!file || trailer.indexOffset < sizeof(header) || trailer.gameCount > fileSize / sizeof(uint64_t)
+        || trailer.indexOffset + trailer.gameCount * sizeof(uint64_t) + sizeof(trailer) != fileSize)
+    {
+        error = "archive index is damaged or missing";
+        return false;
+    }
+
+    offsets.resize(static_cast<size_t>(trailer.gameCount));
+    file.seekg(static_cast<streamoff>(trailer.indexOffset));
+    if (!file.read(reinterpret_cast<char*>(offsets.data()), static_cast<streamsize>(offsets.size() * sizeof(uint64_t))))
+    {
+        error = "archive index is damaged or missing";
+        offsets.clear();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Reads game N.
+ *
+ * @param index The game number, from 0.
+ * @param game Set to the game.
+ * @return False if there is no such game or its data is damaged.
+ */
+bool GameArchive::Reader::read(uint64_t index, Game& game)
+{
+    if (index >= offsets.size())
+    {
+        return false;
+    }
+    nextGame = index + 1;
+
+    ArchiveGameHeader header;
+    //Seeking drops the stream's buffer, so games read in order are read straight on
+    if (index != streamGame)
+    {
+        file.clear();
+        file.seekg(static_cast<streamoff>(offsets[static_cast<size_t>(index)]));
+    }
+    streamGame = UINT64_MAX;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+    {
+        return false;
+    }
+    game.start = BoardSnapshot();
+    if ((header.flags & CUSTOM_START) && !file.read(reinterpret_cast<char*>(&game.start), sizeof(game.start)))
+    {
+        return false;
+    }
+    payload.resize(header.payloadBytes);
+    if (!file.read(&payload[0], static_cast<streamsize>(payload.size())) && header.payloadBytes > 0)
+    {
+        return false;
+    }
+    uint64_t end = offsets[static_cast<size_t>(index)] + sizeof(header)
+        + ((header.flags & CUSTOM_START) ? sizeof(game.start) : 0) + header.payloadBytes;
+    if (index + 1 < offsets.size() && offsets[static_cast<size_t>(index + 1)] == end)
+    {
+        streamGame = index + 1;
+    }
+    game.result = header.result;
+    return setStart(board, game.start) && decode(payload, header.plies, board, game.moves);
+}
+
+/**
+ * @brief Reads the game after the one last read by next().
+ *
+ * @param game Set to the game.
+ * @return False at the end of the archive or if the game is damaged.
+ */
+bool GameArchive::Reader::next(Game& game)
+{
+    return read(nextGame, game);
+}
@@ -0,0 +1,688 @@
+//Qusay Edkymish
+//Oct/19/2026
+//GameServer Class Implementation
+
+#include "GameServer.h"
+#include "Chess.h"
+#include <algorithm>    //For max.
+#include <atomic>       //For the shutdown signal flag.
+#include <iostream>     //For status messages.
+#include <sstream>      //For reading the command word and rewriting engine jobs.
+
+#ifdef __linux__
+#include <arpa/inet.h>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+//Set by SIGINT or SIGTERM to end run()
+static atomic<bool> stopRequested(false);
+
+//Events fetched per epoll_wait call
+static const int EVENT_BATCH = 256;
+
+/**
+ * @brief Constructs a server and fills the board pool.
+ */
+GameServer::GameServer(const Options& serverOptions)
+    : options(serverOptions), listenFd(-1), epollFd(-1), wakeFd(-1),
+      boards(static_cast<size_t>(max(1, serverOptions.sessions))),
+      nextGeneration(1), commandsServed(0), shuttingDown(false)
+{
+    //Hand out low indices first
+    for (int i = static_cast<int>(boards.size()) - 1; i >= 0; i--)
+    {
+        freeBoards.push_back(i);
+    }
+}
+
+#ifdef __linux__
+
+/**
+ * @brief Stops run() on SIGINT or SIGTERM.
+ */
+static void onStopSignal(int)
+{
+    stopRequested = true;
+}
+
+/**
+ * @brief Makes a socket non-blocking.
+ */
+static bool setNonBlocking(int fd)
+{
+    int flags = fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+/**
+ * @brief Opens a socket for an address.
+ */
+int GameServer::openSocket(const string& address, bool listening, string& error)
+{
+    int fd = -1;
+    if (address.compare(0, 5, "unix:") == 0)
+    {
+        string path = address.substr(5);
+        sockaddr_un addr{};
+        if (path.empty() || path.size() >= sizeof(addr.sun_path))
+        {
+            error = "bad socket path";
+            return -1;
+        }
+        addr.sun_family = AF_UNIX;
+        strcpy(addr.sun_path, path.c_str());
+
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0)
+        {
+            error = strerror(errno);
+            return -1;
+        }
+        if (listening)
+        {
+            unlink(path.c_str());
+        }
+        int result = listening ? ::bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr))
+            : connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+        if (result != 0)
+        {
+            error = strerror(errno);
+            close(fd);
+            return -1;
+        }
+    }
+    else if (address.compare(0, 4, "tcp:") == 0)
+    {
+        string host = "127.0.0.1";
+        string port = address.substr(4);
+        size_t colon = port.rfind(':');
+        if (colon != string::npos)
+        {
+            host = port.substr(0, colon);
+            port = port.substr(colon + 1);
+        }
+
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(static_cast<uint16_t>(atoi(port.c_str())));
+        if (port.empty() || inet_pton(AF_INET, host.c_str(), &addr.sin_addr) != 1)
+        {
+            error = "bad TCP address";
+            return -1;
+        }
+
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0)
+        {
+            error = strerror(errno);
+            return -1;
+        }
+        int on = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+        if (listening)
+        {
+            setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+        }
+        int result = listening ? ::bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr))
+            : connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+        if (result != 0)
+        {
+            error = strerror(errno);
+            close(fd);
+            return -1;
+        }
+    }
+    else
+    {
+        error = "address must start with tcp: or unix:";
+        return -1;
+    }
+
+    if (listening && listen(fd, SOMAXCONN) != 0)
+    {
+        error = strerror(errno);
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/**
+ * @brief Raises the open file limit towards a number of sockets, up to the hard limit.
+ */
+void GameServer::raiseFileLimit(size_t wanted)
+{
+    rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < wanted)
+    {
+        limit.rlim_cur = min(static_cast<rlim_t>(wanted), limit.rlim_max);
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+}
+
+/**
+ * @brief Opens the listening socket and starts the engine threads.
+ */
+bool GameServer::start(string& error)
+{
+    raiseFileLimit(boards.size() + 64);
+
+    listenFd = openSocket(options.address, true, error);
+    if (listenFd < 0)
+    {
+        return false;
+    }
+    setNonBlocking(listenFd);
+
+    epollFd = epoll_create1(0);
+    wakeFd = eventfd(0, EFD_NONBLOCK);
+    if (epollFd < 0 || wakeFd < 0)
+    {
+        error = strerror(errno);
+        return false;
+    }
+
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = listenFd;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &event);
+    event.data.fd = wakeFd;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &event);
+
+    int threads = options.engineThreads > 0 ? options.engineThreads : max(1, static_cast<int>(thread::hardware_concurrency()));
+    for (int i = 0; i < threads; i++)
+    {
+        engineThreads.emplace_back(&GameServer::engineLoop, this);
+    }
+    return true;
+}
+
+/**
+ * @brief Runs engine jobs until shutdown.
+ *
+ * Each thread keeps one Search and one scratch board for its lifetime, so
+ * its tables stay allocated between jobs. The job's snapshot is restored
+ * into the scratch board, leaving the session's own board to the loop.
+ */
+void GameServer::engineLoop()
+{
+    Search engine;
+    ChessBoard scratch;
+    engine.setInfoOutput(nullptr);
+    engine.setHashSize(options.hashMb);
+
+    while (true)
+    {
+        Job job;
+        {
+            unique_lock<mutex> lock(jobMutex);
+            jobReady.wait(lock, [this] { return shuttingDown || !jobs.empty(); });
+            if (shuttingDown)
+            {
+                return;
+            }
+            job = move(jobs.front());
+            jobs.pop_front();
+        }
+
+        string response;
+        scratch.restore(job.position);
+        Chess::respond(scratch, &engine, job.line, response);
+        job.line = move(response);
+
+        {
+            lock_guard<mutex> lock(jobMutex);
+            replies.push_back(move(job));
+        }
+        uint64_t one = 1;
+        ssize_t written = write(wakeFd, &one, sizeof(one));
+        (void)written;
+    }
+}
+
+/**
+ * @brief Accepts every waiting connection.
+ *
+ * A connection beyond the board pool gets an error line and is closed.
+ */
+void GameServer::acceptClients()
+{
+    while (true)
+    {
+        int fd = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK);
+        if (fd < 0)
+        {
+            return;
+        }
+        if (freeBoards.empty())
+        {
+            static const char full[] = "{\"cmd\":\"\",\"ok\":false,\"error\":\"server full\"}\n";
+            ssize_t written = send(fd, full, sizeof(full) - 1, MSG_NOSIGNAL);
+            (void)written;
+            close(fd);
+            continue;
+        }
+
+        if (static_cast<size_t>(fd) >= sessions.size())
+        {
+            sessions.resize(fd + 1024);
+        }
+        Session& session = sessions[fd];
+        session = Session();
+        session.watched = EPOLLIN | EPOLLRDHUP;
+        session.board = freeBoards.back();
+        session.generation = nextGeneration++;
+        freeBoards.pop_back();
+        boards[session.board].initializeBoard();
+
+        epoll_event event{};
+        event.events = session.watched;
+        event.data.fd = fd;
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event);
+    }
+}
+
+/**
+ * @brief Reads from a session's socket and runs each complete line.
+ */
+void GameServer::readClient(int fd)
+{
+    Session& session = sessions[fd];
+    char buffer[4096];
+    while (true)
+    {
+        ssize_t received = recv(fd, buffer, sizeof(buffer), 0);
+        if (received > 0)
+        {
+            //Drop a client as soon as its unterminated line outgrows the limit, before buffering more
+            session.input.append(buffer, static_cast<size_t>(received));
+            size_t newline = session.input.rfind('\n');
+            size_t tail = session.input.size() - (newline == string::npos ? 0 : newline + 1);
+            if (tail > MAX_LINE)
+            {
+                closeClient(fd);
+                return;
+            }
+            continue;
+        }
+        if (received == 0)
+        {
+            //The client is done sending; answer what it sent, then close
+            session.readClosed = true;
+            break;
+        }
+        if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+        {
+            closeClient(fd);
+            return;
+        }
+        if (errno != EINTR)
+        {
+            break;
+        }
+    }
+
+    size_t start = 0;
+    size_t end;
+    while (sessions[fd].board >= 0 && (end = session.input.find('\n', start)) != string::npos)
+    {
+        string line = session.input.substr(start, end - start);
+        start = end + 1;
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+        if (line.empty())
+        {
+            continue;
+        }
+        if (session.busy)
+        {
+            if (session.pending.size() >= MAX_PENDING)
+            {
+                closeClient(fd);
+                return;
+            }
+            session.pending.push_back(move(line));
+        }
+        else
+        {
+            handleLine(fd, line);
+        }
+    }
+    if (session.board < 0)
+    {
+        return;
+    }
+    session.input.erase(0, start);
+    if (session.readClosed)
+    {
+        session.closing = true;
+        flushClient(fd);
+    }
+}
+
+/**
+ * @brief Runs one command line of a session, inline or on the engine pool.
+ *
+ * Board commands take microseconds and are answered on the loop thread;
+ * "go" and "perft" go to the engine pool.
+ */
+void GameServer::handleLine(int fd, const string& line)
+{
+    Session& session = sessions[fd];
+    istringstream words(line);
+    string command;
+    words >> command;
+
+    if (command == "q" || command == "quit")
+    {
+        session.closing = true;
+        session.pending.clear();
+        flushClient(fd);
+        return;
+    }
+    if (command == "go" || command == "perft")
+    {
+        session.busy = true;
+        {
+            lock_guard<mutex> lock(jobMutex);
+            jobs.push_back(Job{ fd, session.generation, boards[session.board].snapshot(), clampJob(line) });
+        }
+        jobReady.notify_one();
+        return;
+    }
+
+    string response;
+    Chess::respond(boards[session.board], nullptr, line, response);
+    commandsServed++;
+    sendLine(fd, response);
+}
+
+/**
+ * @brief Rewrites a "go" or "perft" line with its limits clamped to the server's caps.
+ *
+ * A session cannot hold an engine thread for long: perft is capped at
+ * MAX_PERFT_DEPTH, and every search gets a depth, node and time limit no
+ * larger than the server's whatever the client asked for. The rewritten
+ * line is what the reply echoes, so the client sees the limits it got.
+ */
+string GameServer::clampJob(const string& line)
+{
+    istringstream args(line);
+    string command;
+    args >> command;
+    ostringstream clamped;
+    if (command == "perft")
+    {
+        int depth = 1;
+        args >> depth;
+        clamped << "perft " << (depth > MAX_PERFT_DEPTH ? MAX_PERFT_DEPTH : max(depth, 1));
+        return clamped.str();
+    }
+
+    SearchLimits limits = Chess::parseLimits(args);
+    int depth = (limits.depth > MAX_JOB_DEPTH) ? MAX_JOB_DEPTH : max(limits.depth, 1);
+    uint64_t nodes = (limits.nodes == 0 || limits.nodes > MAX_JOB_NODES) ? MAX_JOB_NODES : limits.nodes;
+    long long moveTime = (limits.moveTime <= 0 || limits.moveTime > MAX_JOB_TIME) ? MAX_JOB_TIME : limits.moveTime;
+    clamped << "go depth " << depth << " nodes " << nodes << " movetime " << moveTime;
+    return clamped.str();
+}
+
+/**
+ * @brief Runs queued commands of a session until one needs the engine.
+ */
+void GameServer::drainPending(int fd)
+{
+    Session& session = sessions[fd];
+    while (session.board >= 0 && !session.busy && !session.pending.empty())
+    {
+        string line = move(session.pending.front());
+        session.pending.pop_front();
+        handleLine(fd, line);
+    }
+}
+
+/**
+ * @brief Delivers engine replies to their sessions.
+ *
+ * A reply for a session that has since disconnected is dropped.
+ */
+void GameServer::collectReplies()
+{
+    uint64_t count;
+    ssize_t got = read(wakeFd, &count, sizeof(count));
+    (void)got;
+
+    vector<Job> finished;
+    {
+        lock_guard<mutex> lock(jobMutex);
+        finished.swap(replies);
+    }
+
+    for (Job& job : finished)
+    {
+        commandsServed++;
+        bool live = static_cast<size_t>(job.fd) < sessions.size() && sessions[job.fd].board >= 0
+            && sessions[job.fd].generation == job.generation;
+        if (!live)
+        {
+            continue;
+        }
+        sessions[job.fd].busy = false;
+        sendLine(job.fd, job.line);
+        drainPending(job.fd);
+    }
+}
+
+/**
+ * @brief Queues a reply line and sends as much as the socket takes.
+ */
+void GameServer::sendLine(int fd, const string& line)
+{
+    Session& session = sessions[fd];
+    session.output += line;
+    session.output += '\n';
+    flushClient(fd);
+}
+
+/**
+ * @brief Sends buffered output; closes a closing session once everything is answered and sent.
+ *
+ * Output the socket does not take right away stays buffered and the
+ * socket is watched for writability until it drains.
+ */
+void GameServer::flushClient(int fd)
+{
+    Session& session = sessions[fd];
+    size_t sent = 0;
+    while (sent < session.output.size())
+    {
+        ssize_t result = send(fd, session.output.data() + sent, session.output.size() - sent, MSG_NOSIGNAL);
+        if (result > 0)
+        {
+            sent += static_cast<size_t>(result);
+        }
+        else if (result < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else if (result < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            break;
+        }
+        else
+        {
+            closeClient(fd);
+            return;
+        }
+    }
+    session.output.erase(0, sent);
+
+    bool wantWrite = !session.output.empty();
+    if (!wantWrite && session.closing && !session.busy && session.pending.empty())
+    {
+        closeClient(fd);
+        return;
+    }
+
+    uint32_t events = (session.readClosed ? 0u : static_cast<uint32_t>(EPOLLIN | EPOLLRDHUP))
+        | (wantWrite ? static_cast<uint32_t>(EPOLLOUT) : 0u);
+    if (events != session.watched)
+    {
+        epoll_event event{};
+        event.events = events;
+        event.data.fd = fd;
+        epoll_ctl(epollFd, EPOLL_CTL_MOD, fd, &event);
+        session.watched = events;
+    }
+}
+
+/**
+ * @brief Closes a session and returns its board to the pool.
+ */
+void GameServer::closeClient(int fd)
+{
+    Session& session = sessions[fd];
+    if (session.board < 0)
+    {
+        return;
+    }
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+    close(fd);
+
+    freeBoards.push_back(session.board);
+    session = Session();
+}
+
+/**
+ * @brief Serves sessions until SIGINT or SIGTERM.
+ */
+int GameServer::run()
+{
+    stopRequested = false;
+    signal(SIGINT, onStopSignal);
+    signal(SIGTERM, onStopSignal);
+    signal(SIGPIPE, SIG_IGN);
+
+    cout << "Serving " << boards.size() << " sessions on " << options.address
+        << " with " << engineThreads.size() << " engine threads\n" << flush;
+
+    epoll_event events[EVENT_BATCH];
+    while (!stopRequested)
+    {
+        int count = epoll_wait(epollFd, events, EVENT_BATCH, 500);
+        for (int i = 0; i < count; i++)
+        {
+            int fd = events[i].data.fd;
+            uint32_t flags = events[i].events;
+            if (fd == listenFd)
+            {
+                acceptClients();
+            }
+            else if (fd == wakeFd)
+            {
+                collectReplies();
+            }
+            else if (static_cast<size_t>(fd) < sessions.size() && sessions[fd].board >= 0)
+            {
+                if (flags & (EPOLLERR | EPOLLHUP))
+                {
+                    closeClient(fd);
+                    continue;
+                }
+                if (flags & EPOLLOUT)
+                {
+                    flushClient(fd);
+                }
+                if (sessions[fd].board >= 0 && (flags & (EPOLLIN | EPOLLRDHUP)))
+                {
+                    readClient(fd);
+                }
+            }
+        }
+    }
+
+    cout << "Stopped after " << commandsServed << " commands\n";
+    return 0;
+}
+
+/**
+ * @brief Stops the engine threads and closes every socket.
+ */
+GameServer::~GameServer()
+{
+    {
+        lock_guard<mutex> lock(jobMutex);
+        shuttingDown = true;
+    }
+    jobReady.notify_all();
+    for (auto& engineThread : engineThreads)
+    {
+        engineThread.join();
+    }
+
+    for (size_t fd = 0; fd < sessions.size(); fd++)
+    {
+        if (sessions[fd].board >= 0)
+        {
+            close(static_cast<int>(fd));
+        }
+    }
+    if (listenFd >= 0)
+    {
+        close(listenFd);
+        if (options.address.compare(0, 5, "unix:") == 0)
+        {
+            unlink(options.address.substr(5).c_str());
+        }
+    }
+    if (epollFd >= 0)
+    {
+        close(epollFd);
+    }
+    if (wakeFd >= 0)
+    {
+        close(wakeFd);
+    }
+}
+
+#else
+
+int GameServer::openSocket(const string&, bool, string& error)
+{
+    error = "the game server needs Linux (epoll)";
+    return -1;
+}
+
+void GameServer::raiseFileLimit(size_t)
+{
+}
+
+bool GameServer::start(string& error)
+{
+    openSocket(options.address, true, error);
+    return false;
+}
+
+int GameServer::run()
+{
+    return 1;
+}
+
+GameServer::~GameServer()
+{
+}
+
+#endif
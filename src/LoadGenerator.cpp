@@ -0,0 +1,204 @@
+//Qusay Edkymish
+//Oct/19/2026
+//LoadGenerator Class Implementation
+
+#include "LoadGenerator.h"
+#include "GameServer.h"
+#include <algorithm>    //For sorting latencies.
+#include <chrono>       //For timing commands.
+#include <cstdint>      //Provides fixed-width integer types.
+#include <vector>       //For the clients and latencies.
+
+#ifdef __linux__
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+//Commands each session cycles through; the moves are legal in order from the start
+static const char* const SCRIPT[] = { "e2", "e2e4", "e7e5", "g1f3", "b8c6", "fen", "perft 2", "reset" };
+static const int SCRIPT_LENGTH = sizeof(SCRIPT) / sizeof(SCRIPT[0]);
+
+#ifdef __linux__
+
+/**
+ * @brief One simulated client.
+ */
+struct LoadClient
+{
+    int fd = -1;                                //Socket, -1 once finished
+    int sent = 0;                               //Commands sent so far
+    string input;                               //Received bytes not yet forming a full line
+    chrono::steady_clock::time_point sentAt;    //When the outstanding command was sent
+};
+
+/**
+ * @brief Sends a client's next script command and starts its timer.
+ */
+static bool sendNext(LoadClient& client)
+{
+    string line = string(SCRIPT[client.sent % SCRIPT_LENGTH]) + "\n";
+    client.sentAt = chrono::steady_clock::now();
+    client.sent++;
+    return send(client.fd, line.data(), line.size(), MSG_NOSIGNAL) == static_cast<ssize_t>(line.size());
+}
+
+/**
+ * @brief Gets a percentile of sorted latencies.
+ */
+static long long percentile(const vector<long long>& sorted, int percent)
+{
+    if (sorted.empty())
+    {
+        return 0;
+    }
+    size_t index = min(sorted.size() - 1, sorted.size() * percent / 100);
+    return sorted[index];
+}
+
+/**
+ * @brief Runs the load and writes the report.
+ *
+ * Sessions connect one after another before any command is sent, so the
+ * measured latencies are for a server holding every session at once.
+ */
+int LoadGenerator::run(const Options& options, ostream& out)
+{
+    signal(SIGPIPE, SIG_IGN);
+    GameServer::raiseFileLimit(static_cast<size_t>(options.sessions) + 64);
+
+    int epollFd = epoll_create1(0);
+    vector<LoadClient> clients(static_cast<size_t>(max(0, options.sessions)));
+    auto connectStart = chrono::steady_clock::now();
+    for (size_t i = 0; i < clients.size(); i++)
+    {
+        string error;
+        int fd = GameServer::openSocket(options.address, false, error);
+        if (fd < 0)
+        {
+            out << "Connection " << i << " failed: " << error << "\n";
+            clients.resize(i);
+            break;
+        }
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+        clients[i].fd = fd;
+
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.u64 = i;
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event);
+    }
+    long long connectMs = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - connectStart).count();
+    out << "Connected " << clients.size() << " sessions in " << connectMs << " ms\n";
+
+    vector<long long> latencies;
+    latencies.reserve(clients.size() * static_cast<size_t>(max(0, options.rounds)));
+    uint64_t failures = 0;
+    size_t active = 0;
+
+    auto start = chrono::steady_clock::now();
+    for (LoadClient& client : clients)
+    {
+        if (options.rounds > 0 && sendNext(client))
+        {
+            active++;
+        }
+        else
+        {
+            close(client.fd);
+            client.fd = -1;
+        }
+    }
+
+    epoll_event events[256];
+    char buffer[4096];
+    while (active > 0)
+    {
+        int count = epoll_wait(epollFd, events, 256, 10000);
+        if (count <= 0)
+        {
+            out << "Timed out with " << active << " sessions waiting\n";
+            break;
+        }
+        for (int e = 0; e < count; e++)
+        {
+            LoadClient& client = clients[events[e].data.u64];
+            if (client.fd < 0)
+            {
+                continue;
+            }
+
+            bool closed = false;
+            while (true)
+            {
+                ssize_t received = recv(client.fd, buffer, sizeof(buffer), 0);
+                if (received > 0)
+                {
+                    client.input.append(buffer, static_cast<size_t>(received));
+                    continue;
+                }
+                closed = received == 0 || (errno != EAGAIN && errno != EWOULDBLOCK);
+                break;
+            }
+
+            size_t newline;
+            while (client.fd >= 0 && (newline = client.input.find('\n')) != string::npos)
+            {
+                auto now = chrono::steady_clock::now();
+                latencies.push_back(chrono::duration_cast<chrono::microseconds>(now - client.sentAt).count());
+                if (client.input.substr(0, newline).find("\"ok\":false") != string::npos)
+                {
+                    failures++;
+                }
+                client.input.erase(0, newline + 1);
+
+                if (client.sent >= options.rounds || !sendNext(client))
+                {
+                    close(client.fd);
+                    client.fd = -1;
+                    active--;
+                }
+            }
+            if (closed && client.fd >= 0)
+            {
+                out << "Session closed by the server\n";
+                close(client.fd);
+                client.fd = -1;
+                active--;
+            }
+        }
+    }
+    long long elapsedUs = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+
+    for (LoadClient& client : clients)
+    {
+        if (client.fd >= 0)
+        {
+            close(client.fd);
+        }
+    }
+    close(epollFd);
+
+    sort(latencies.begin(), latencies.end());
+    uint64_t expected = static_cast<uint64_t>(clients.size()) * static_cast<uint64_t>(max(0, options.rounds));
+    out << "Sessions: " << clients.size() << "  commands: " << latencies.size() << "/" << expected
+        << "  failed replies: " << failures << "\n";
+    out << "Time: " << elapsedUs / 1000 << " ms  throughput: "
+        << (elapsedUs > 0 ? latencies.size() * 1000000 / static_cast<uint64_t>(elapsedUs) : 0) << " commands/s\n";
+    out << "Latency us: p50 " << percentile(latencies, 50) << "  p90 " << percentile(latencies, 90)
+        << "  p99 " << percentile(latencies, 99) << "  max " << (latencies.empty() ? 0 : latencies.back()) << "\n";
+    return latencies.size() == expected ? 0 : 1;
+}
+
+#else
+
+int LoadGenerator::run(const Options&, ostream& out)
+{
+    out << "The load generator needs Linux (epoll)\n";
+    return 1;
+}
+
+#endif
@@ -0,0 +1,34 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Move Class Implementation
+
+#include "Move.h"
+
+/**
+ * @brief Converts the move to coordinate notation.
+ *
+ * Squares are written as file letter and rank digit. Because square 0 is a8,
+ * the rank digit is '8' minus the row. Promotions append the lowercase
+ * piece letter.
+ *
+ * @return The move text, or "0000" for the null move.
+ */
+string Move::toString() const
+{
+    if (isNull())
+    {
+        return "0000";
+    }
+
+    string text;
+    text += static_cast<char>('a' + (getFrom() & 7));
+    text += static_cast<char>('8' - (getFrom() >> 3));
+    text += static_cast<char>('a' + (getTo() & 7));
+    text += static_cast<char>('8' - (getTo() >> 3));
+
+    if (isPromotion())
+    {
+        text += "nbrq"[promotionType() - 1];
+    }
+    return text;
+}
@@ -0,0 +1,240 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Profiler Class Implementation
+
+#include "Profiler.h"
+
+#ifdef CHESS_PROFILE
+
+#include "Bitboard.h"   //For the highest set bit of a duration.
+#include <algorithm>    //For sorting the report.
+#include <cmath>        //For rounding percentile ranks up.
+#include <cstdlib>      //For malloc, free, atexit and getenv.
+#include <fstream>      //For writing the report.
+#include <iomanip>      //For formatting averages.
+#include <mutex>        //For guarding the site list.
+#include <new>          //For the replaced allocation functions.
+#include <vector>       //For sorting the sites.
+
+//Allocations made by each thread; read at the start and end of a scope
+static thread_local uint64_t allocationCount = 0;
+static thread_local uint64_t allocationBytes = 0;
+
+static ProfileSite* firstSite = nullptr;    //Most recently registered site
+static mutex siteLock;                      //Guards the site list
+
+/**
+ * @brief Counts one allocation of the calling thread, then allocates it.
+ */
+static void* countedAllocate(size_t size)
+{
+    allocationCount++;
+    allocationBytes += size;
+    void* block = malloc(size ? size : 1);
+    if (!block)
+    {
+        throw bad_alloc();
+    }
+    return block;
+}
+
+//The global allocation functions, replaced only in profiling builds
+void* operator new(size_t size) { return countedAllocate(size); }
+void* operator new[](size_t size) { return countedAllocate(size); }
+void operator delete(void* block) noexcept { free(block); }
+void operator delete[](void* block) noexcept { free(block); }
+void operator delete(void* block, size_t) noexcept { free(block); }
+void operator delete[](void* block, size_t) noexcept { free(block); }
+
+/**
+ * @brief Writes the report when the program exits.
+ */
+static void writeReportAtExit()
+{
+    const char* path = getenv("CHESS_PROFILE_FILE");
+    Profiler::writeReport(path ? path : "chess_profile.json");
+}
+
+/**
+ * @brief Creates a site and registers it for the exit report.
+ */
+ProfileSite::ProfileSite(const char* siteName)
+    : name(siteName), calls(0), totalNs(0), maxNs(0), allocations(0), allocatedBytes(0), next(nullptr)
+{
+    for (atomic<uint64_t>& bucket : buckets)
+    {
+        bucket.store(0, memory_order_relaxed);
+    }
+    Profiler::registerSite(this);
+}
+
+/**
+ * @brief Adds one completed scope.
+ */
+void ProfileSite::record(uint64_t ns, uint64_t allocs, uint64_t bytes)
+{
+    calls.fetch_add(1, memory_order_relaxed);
+    totalNs.fetch_add(ns, memory_order_relaxed);
+    allocations.fetch_add(allocs, memory_order_relaxed);
+    allocatedBytes.fetch_add(bytes, memory_order_relaxed);
+    buckets[bucketOf(ns)].fetch_add(1, memory_order_relaxed);
+
+    uint64_t slowest = maxNs.load(memory_order_relaxed);
+    while (ns > slowest && !maxNs.compare_exchange_weak(slowest, ns, memory_order_relaxed))
+    {
+    }
+}
+
+/**
+ * @brief Gets the histogram bucket of a duration.
+ */
+int ProfileSite::bucketOf(uint64_t ns)
+{
+    if (ns < SUB_BUCKETS)
+    {
+        return static_cast<int>(ns);
+    }
+    int top = Bitboards::msb(ns);
+    int step = static_cast<int>((ns >> (top - 3)) & (SUB_BUCKETS - 1));
+    return (top - 2) * SUB_BUCKETS + step;
+}
+
+/**
+ * @brief Gets the largest duration that falls into a bucket.
+ */
+uint64_t ProfileSite::bucketLimit(int bucket)
+{
+    if (bucket < SUB_BUCKETS)
+    {
+        return static_cast<uint64_t>(bucket);
+    }
+    int top = bucket / SUB_BUCKETS + 2;
+    uint64_t low = static_cast<uint64_t>(SUB_BUCKETS + bucket % SUB_BUCKETS) << (top - 3);
+    return low + (1ULL << (top - 3)) - 1;
+}
+
+/**
+ * @brief Gets the duration at or below which a fraction of the calls finished.
+ */
+uint64_t ProfileSite::percentile(double fraction) const
+{
+    uint64_t total = calls.load(memory_order_relaxed);
+    if (total == 0)
+    {
+        return 0;
+    }
+    //Nearest rank: the smallest call count that covers the fraction
+    uint64_t rank = max<uint64_t>(1, static_cast<uint64_t>(ceil(fraction * static_cast<double>(total))));
+    uint64_t seen = 0;
+    for (int b = 0; b < BUCKETS; b++)
+    {
+        seen += buckets[b].load(memory_order_relaxed);
+        if (seen >= rank)
+        {
+            return min(bucketLimit(b), maxNs.load(memory_order_relaxed));
+        }
+    }
+    return maxNs.load(memory_order_relaxed);
+}
+
+/**
+ * @brief Starts timing a scope.
+ */
+ProfileScope::ProfileScope(ProfileSite& target)
+    : site(target), start(chrono::steady_clock::now()),
+      startAllocations(allocationCount), startBytes(allocationBytes)
+{
+}
+
+/**
+ * @brief Adds the scope's time and allocations to its site.
+ */
+ProfileScope::~ProfileScope()
+{
+    uint64_t ns = static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count());
+    site.record(ns, allocationCount - startAllocations, allocationBytes - startBytes);
+}
+
+/**
+ * @brief Adds a site to the report and, for the first site, registers the exit report.
+ */
+void Profiler::registerSite(ProfileSite* site)
+{
+    lock_guard<mutex> guard(siteLock);
+    if (!firstSite)
+    {
+        atexit(writeReportAtExit);
+    }
+    site->next = firstSite;
+    firstSite = site;
+}
+
+/**
+ * @brief Gets the number of heap allocations made so far by the calling thread.
+ */
+uint64_t Profiler::threadAllocations()
+{
+    return allocationCount;
+}
+
+/**
+ * @brief Gets the number of bytes requested so far by the calling thread.
+ */
+uint64_t Profiler::threadAllocatedBytes()
+{
+    return allocationBytes;
+}
+
+/**
+ * @brief Writes every site's counts, latencies and allocations as JSON.
+ *
+ * Sites are listed by total time, most expensive first. Percentiles are
+ * the upper limits of histogram buckets, so they are accurate to within
+ * an eighth.
+ */
+bool Profiler::writeReport(const string& path)
+{
+    vector<const ProfileSite*> sites;
+    {
+        lock_guard<mutex> guard(siteLock);
+        for (const ProfileSite* site = firstSite; site; site = site->next)
+        {
+            sites.push_back(site);
+        }
+    }
+    sort(sites.begin(), sites.end(), [](const ProfileSite* a, const ProfileSite* b)
+    {
+        return a->totalNs.load(memory_order_relaxed) > b->totalNs.load(memory_order_relaxed);
+    });
+
+    ofstream out(path);
+    if (!out)
+    {
+        return false;
+    }
+    out << "{\n  \"sites\": [";
+    for (size_t i = 0; i < sites.size(); i++)
+    {
+        const ProfileSite& site = *sites[i];
+        uint64_t calls = site.calls.load(memory_order_relaxed);
+        uint64_t totalNs = site.totalNs.load(memory_order_relaxed);
+        uint64_t allocations = site.allocations.load(memory_order_relaxed);
+        double perCall = calls ? 1.0 / static_cast<double>(calls) : 0.0;
+
+        out << (i ? ",\n" : "\n") << "    {\"name\":\"" << site.name << "\""
+            << ",\"calls\":" << calls
+            << ",\"totalNs\":" << totalNs
+            << ",\"meanNs\":" << fixed << setprecision(1) << static_cast<double>(totalNs) * perCall
+            << ",\"p50Ns\":" << site.percentile(0.50)
+            << ",\"p90Ns\":" << site.percentile(0.90)
+            << ",\"p99Ns\":" << site.percentile(0.99)
+            << ",\"maxNs\":" << site.maxNs.load(memory_order_relaxed)
+            << ",\"allocations\":" << allocations
+            << ",\"allocationsPerCall\":" << setprecision(2) << static_cast<double>(allocations) * perCall
+            << ",\"allocatedBytes\":" << site.allocatedBytes.load(memory_order_relaxed) << "}";
+    }
+    out << "\n  ]\n}\n";
+    return static_cast<bool>(out);
+}
+
+#endif // CHESS_PROFILE
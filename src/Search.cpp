@@ -0,0 +1,1169 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Search Class Implementation
+
+#include "Search.h"
+#include "Evaluation.h"
+#include "Tablebase.h"
+#include <cmath>        //For the logarithms in the reduction table.
+#include <cstdio>       //For replacing the metrics file.
+#include <cstdlib>      //For parsing numeric option values.
+#include <fstream>      //For writing the metrics file.
+#include <iomanip>      //For formatting rates in statistics lines.
+#include <sstream>      //For building option descriptions.
+#include <thread>       //For the helper search threads.
+
+int Search::lmrTable[64][64];
+
+//Option names and the SearchOptions member each one controls
+static const struct
+{
+    const char* name;
+    bool SearchOptions::* flag;
+} OPTION_TABLE[] =
+{
+    { "nullmove", &SearchOptions::nullMove },
+    { "nmverify", &SearchOptions::nullMoveVerification },
+    { "lmr", &SearchOptions::lateMoveReductions },
+    { "futility", &SearchOptions::futilityPruning },
+    { "razoring", &SearchOptions::razoring },
+    { "checkext", &SearchOptions::checkExtensions },
+    { "aspiration", &SearchOptions::aspirationWindows },
+    { "tablebase", &SearchOptions::tablebases },
+    { "stats", &SearchOptions::instrumentation }
+};
+
+//Pruning margins in centipawns, indexed by remaining depth
+static const int FUTILITY_MARGIN[4] = { 0, 125, 250, 400 };
+static const int RAZOR_MARGIN[4] = { 0, 250, 400, 550 };
+static const int REVERSE_FUTILITY_MARGIN = 90;
+
+//Non-pawn material at or below which null-move cutoffs are verified (about one rook)
+static const int NULL_VERIFY_MATERIAL = 500;
+
+//First aspiration window half-width in centipawns
+static const int ASPIRATION_WINDOW = 25;
+
+//Ordering score bands; higher scores are searched first
+static const int PV_MOVE_SCORE = 2000000;
+static const int CAPTURE_SCORE = 1000000;
+static const int KILLER_SCORE_1 = 900000;
+static const int KILLER_SCORE_2 = 800000;
+static const int HISTORY_LIMIT = 700000;
+
+//The main thread checks limits every this many of its own nodes (power of two),
+//and once more when its own count reaches the node limit so small budgets are kept exactly
+static const uint64_t CHECK_INTERVAL = 2048;
+
+//With instrumentation on, one call in this many is timed (power of two)
+static const unsigned TIMING_SAMPLE = 16;
+
+/**
+ * @brief Parses a whole string as a number.
+ *
+ * @return False if the text is empty or has anything after the digits.
+ */
+static bool parseNumber(const string& text, long long& number)
+{
+    if (text.empty())
+    {
+        return false;
+    }
+    char* end = nullptr;
+    number = strtoll(text.c_str(), &end, 10);
+    return *end == '\0';
+}
+
+/**
+ * @brief Adds another snapshot's counts to this one.
+ */
+SearchCounters& SearchCounters::operator+=(const SearchCounters& other)
+{
+    nodes += other.nodes;
+    qnodes += other.qnodes;
+    ttProbes += other.ttProbes;
+    ttHits += other.ttHits;
+    ttCutoffs += other.ttCutoffs;
+    betaCutoffs += other.betaCutoffs;
+    firstMoveCutoffs += other.firstMoveCutoffs;
+    moveGenNs += other.moveGenNs;
+    evalNs += other.evalNs;
+    return *this;
+}
+
+/**
+ * @brief Clears killers and history.
+ */
+void Search::Worker::clearTables()
+{
+    for (int ply = 0; ply < MAX_PLY; ply++)
+    {
+        killers[ply][0] = killers[ply][1] = Move();
+    }
+    for (int side = 0; side < 2; side++)
+    {
+        for (int from = 0; from < 64; from++)
+        {
+            for (int to = 0; to < 64; to++)
+            {
+                history[side][from][to] = 0;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Zeroes all counters.
+ */
+void Search::Worker::resetCounters()
+{
+    nodes.reset();
+    qnodes.reset();
+    ttProbes.reset();
+    ttHits.reset();
+    ttCutoffs.reset();
+    betaCutoffs.reset();
+    firstMoveCutoffs.reset();
+    moveGenNs.reset();
+    evalNs.reset();
+}
+
+/**
+ * @brief Copies the counters into a plain snapshot.
+ */
+SearchCounters Search::Worker::counters() const
+{
+    SearchCounters snapshot;
+    snapshot.nodes = nodes.get();
+    snapshot.qnodes = qnodes.get();
+    snapshot.ttProbes = ttProbes.get();
+    snapshot.ttHits = ttHits.get();
+    snapshot.ttCutoffs = ttCutoffs.get();
+    snapshot.betaCutoffs = betaCutoffs.get();
+    snapshot.firstMoveCutoffs = firstMoveCutoffs.get();
+    snapshot.moveGenNs = moveGenNs.get();
+    snapshot.evalNs = evalNs.get();
+    return snapshot;
+}
+
+/**
+ * @brief Constructs a single-threaded search with all techniques enabled.
+ */
+Search::Search() : info(&cout), tablebase(nullptr), stopped(false), lastMetricsWrite(0)
+{
+    initLmr();
+    resizeWorkers();
+    clear();
+}
+
+/**
+ * @brief Fills the late-move reduction table.
+ *
+ * The reduction grows with the logarithm of both the remaining depth and
+ * the move's position in the ordered list: late moves at high depth are
+ * reduced the most.
+ */
+void Search::initLmr()
+{
+    static bool initialized = false;
+    if (initialized)
+    {
+        return;
+    }
+    initialized = true;
+
+    for (int depth = 0; depth < 64; depth++)
+    {
+        for (int moveNumber = 0; moveNumber < 64; moveNumber++)
+        {
+            if (depth == 0 || moveNumber == 0)
+            {
+                lmrTable[depth][moveNumber] = 0;
+                continue;
+            }
+            lmrTable[depth][moveNumber] = static_cast<int>(0.75 + log(depth) * log(moveNumber) / 2.25);
+        }
+    }
+}
+
+/**
+ * @brief Changes one option by name.
+ */
+bool Search::setOption(const string& name, const string& value)
+{
+    for (const auto& option : OPTION_TABLE)
+    {
+        if (name == option.name)
+        {
+            if (value != "on" && value != "off")
+            {
+                return false;
+            }
+            options.*option.flag = (value == "on");
+            return true;
+        }
+    }
+
+    long long number;
+    if (name == "threads")
+    {
+        if (!parseNumber(value, number) || number < 1 || number > MAX_THREADS)
+        {
+            return false;
+        }
+        options.threads = static_cast<int>(number);
+        resizeWorkers();
+        return true;
+    }
+    if (name == "hash")
+    {
+        return parseNumber(value, number) && number > 0 && setHashSize(static_cast<size_t>(number));
+    }
+    if (name == "metricsinterval")
+    {
+        if (!parseNumber(value, number) || number < 1)
+        {
+            return false;
+        }
+        options.metricsInterval = static_cast<int>(number);
+        return true;
+    }
+    if (name == "metrics")
+    {
+        options.metricsFile = (value == "off") ? "" : value;
+        return !value.empty();
+    }
+    return false;
+}
+
+/**
+ * @brief Lists every option name with its current state, e.g. "nullmove=on lmr=off".
+ */
+string Search::describeOptions() const
+{
+    ostringstream out;
+    for (const auto& option : OPTION_TABLE)
+    {
+        out << option.name << "=" << (options.*option.flag ? "on" : "off") << " ";
+    }
+    out << "threads=" << options.threads << " hash=" << tt.sizeMb()
+        << " metrics=" << (options.metricsFile.empty() ? "off" : options.metricsFile)
+        << " metricsinterval=" << options.metricsInterval;
+    return out.str();
+}
+
+/**
+ * @brief Clears the transposition, killer and history tables.
+ */
+void Search::clear()
+{
+    tt.clear();
+    for (auto& worker : workers)
+    {
+        worker->clearTables();
+    }
+}
+
+/**
+ * @brief Creates or removes workers to match options.threads.
+ */
+void Search::resizeWorkers()
+{
+    while (static_cast<int>(workers.size()) > options.threads)
+    {
+        workers.pop_back();
+    }
+    while (static_cast<int>(workers.size()) < options.threads)
+    {
+        unique_ptr<Worker> worker(new Worker());
+        worker->id = static_cast<int>(workers.size());
+        worker->clearTables();
+        workers.push_back(move(worker));
+    }
+}
+
+/**
+ * @brief Sums the counters of all threads.
+ *
+ * Each thread only ever writes its own counters, so they are merged here
+ * on read instead of being shared while searching.
+ */
+SearchCounters Search::counters() const
+{
+    SearchCounters total;
+    for (const auto& worker : workers)
+    {
+        total += worker->counters();
+    }
+    return total;
+}
+
+/**
+ * @brief Gets the elapsed search time in milliseconds.
+ */
+long long Search::elapsedMs() const
+{
+    return chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - startTime).count();
+}
+
+/**
+ * @brief Checks the node limit and hard time limit and sets the stop flag.
+ *
+ * Called every CHECK_INTERVAL main-thread nodes, so the clock is read only
+ * a few hundred times a second and never per node.
+ *
+ * Also refreshes the metrics file when one is set and its interval has passed.
+ */
+void Search::checkLimits()
+{
+    long long ms = elapsedMs();
+    if (limits.nodes && counters().nodes >= limits.nodes)
+    {
+        stopped = true;
+    }
+    if (timeManager.hardLimitReached(ms))
+    {
+        stopped = true;
+    }
+    if (!options.metricsFile.empty() && ms - lastMetricsWrite >= options.metricsInterval)
+    {
+        lastMetricsWrite = ms;
+        writeMetrics(workers[0]->result.depth, workers[0]->branchingFactor);
+    }
+}
+
+/**
+ * @brief Assigns an ordering score to every move of a list.
+ *
+ * The previous principal variation move comes first, then captures by
+ * most valuable victim / least valuable attacker, then killers, then quiet
+ * moves by history.
+ */
+void Search::scoreMoves(const Worker& w, MoveList& list, Move pvMove, int ply) const
+{
+    const EngineBoard& board = w.board;
+    int side = board.sideToMove();
+    for (int i = 0; i < list.size(); i++)
+    {
+        Move m = list[i];
+        int score;
+        if (m == pvMove)
+        {
+            score = PV_MOVE_SCORE;
+        }
+        else if (m.isCapture() || m.isPromotion())
+        {
+            int attacker = board.pieceAt(m.getFrom()) % 6;
+            int victim = (m.getFlag() == Move::EN_PASSANT) ? PAWN
+                : (m.isCapture() ? board.pieceAt(m.getTo()) % 6 : PAWN);
+            score = CAPTURE_SCORE + Evaluation::PIECE_VALUE[victim] * 10 - attacker;
+            if (m.isPromotion())
+            {
+                score += Evaluation::PIECE_VALUE[m.promotionType()];
+            }
+        }
+        else if (m == w.killers[ply][0])
+        {
+            score = KILLER_SCORE_1;
+        }
+        else if (m == w.killers[ply][1])
+        {
+            score = KILLER_SCORE_2;
+        }
+        else
+        {
+            score = w.history[side][m.getFrom()][m.getTo()];
+        }
+        list.scores[i] = score;
+    }
+}
+
+/**
+ * @brief Moves the best-scored remaining move to position index and returns it.
+ *
+ * A selection step per move is cheaper than a full sort because most nodes
+ * cut off after trying only a few moves.
+ */
+Move Search::pickMove(MoveList& list, int index)
+{
+    int best = index;
+    for (int i = index + 1; i < list.count; i++)
+    {
+        if (list.scores[i] > list.scores[best])
+        {
+            best = i;
+        }
+    }
+    swap(list.moves[index], list.moves[best]);
+    swap(list.scores[index], list.scores[best]);
+    return list.moves[index];
+}
+
+/**
+ * @brief Generates moves, timing one call in 16 when instrumentation is on.
+ *
+ * Reading the clock around every call would cost more than many of the
+ * calls themselves, so only a sample is timed and scaled up.
+ */
+template <int US>
+void Search::generate(Worker& w, MoveList& list, bool capturesOnly)
+{
+    bool timed = options.instrumentation && (++w.sampleTick & (TIMING_SAMPLE - 1)) == 0;
+    chrono::steady_clock::time_point start;
+    if (timed)
+    {
+        start = chrono::steady_clock::now();
+    }
+
+    if (capturesOnly)
+    {
+        w.board.generateCaptures<US>(list);
+    }
+    else
+    {
+        w.board.generateMoves<US>(list);
+    }
+
+    if (timed)
+    {
+        w.moveGenNs.add(TIMING_SAMPLE * chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count());
+    }
+}
+
+/**
+ * @brief Generates moves for whichever side is to move.
+ */
+void Search::generate(Worker& w, MoveList& list, bool capturesOnly)
+{
+    if (w.board.sideToMove() == WHITE)
+    {
+        generate<WHITE>(w, list, capturesOnly);
+    }
+    else
+    {
+        generate<BLACK>(w, list, capturesOnly);
+    }
+}
+
+/**
+ * @brief Evaluates the position, timing one call in 16 when instrumentation is on.
+ */
+int Search::evaluate(Worker& w)
+{
+    if (!options.instrumentation || (++w.sampleTick & (TIMING_SAMPLE - 1)) != 0)
+    {
+        return Evaluation::evaluate(w.board);
+    }
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    int score = Evaluation::evaluate(w.board);
+    w.evalNs.add(TIMING_SAMPLE * chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count());
+    return score;
+}
+
+/**
+ * @brief Searches captures until the position is quiet.
+ *
+ * The side to move may "stand pat" on the static evaluation unless it is
+ * in check, in which case every evasion is searched.
+ */
+template <int US>
+int Search::quiescence(Worker& w, int alpha, int beta, int ply)
+{
+    EngineBoard& board = w.board;
+    if (w.id == 0 && ((w.nodes.get() & (CHECK_INTERVAL - 1)) == 0 || w.nodes.get() == limits.nodes))
+    {
+        checkLimits();
+    }
+    if (stopped.load(memory_order_relaxed))
+    {
+        return 0;
+    }
+
+    w.nodes.add();
+    w.qnodes.add();
+    if (ply > w.selDepth)
+    {
+        w.selDepth = ply;
+    }
+    if (ply >= MAX_PLY - 1)
+    {
+        return evaluate(w);
+    }
+
+    //Any stored result is at least as deep as a quiescence search
+    bool pvNode = (beta - alpha) > 1;
+    bool ttHit;
+    TTEntry* tte = tt.probe(board.getHash(), ttHit);
+    w.ttProbes.add();
+    if (ttHit)
+    {
+        w.ttHits.add();
+    }
+    if (ttHit && !pvNode)
+    {
+        int ttScore = TranspositionTable::scoreFromTT(tte->score, ply, MATE_BOUND);
+        int bound = tte->bound();
+        if (bound == BOUND_EXACT || (bound == BOUND_LOWER && ttScore >= beta) || (bound == BOUND_UPPER && ttScore <= alpha))
+        {
+            w.ttCutoffs.add();
+            return ttScore;
+        }
+    }
+
+    bool inCheck = board.inCheck();
+    int bestScore;
+    int originalAlpha = alpha;
+    Move bestMove;
+    MoveList list;
+
+    if (inCheck)
+    {
+        bestScore = -MATE_SCORE + ply;
+        generate<US>(w, list, false);
+    }
+    else
+    {
+        bestScore = evaluate(w);
+        if (bestScore >= beta)
+        {
+            return bestScore;
+        }
+        if (bestScore > alpha)
+        {
+            alpha = bestScore;
+        }
+        generate<US>(w, list, true);
+    }
+
+    scoreMoves(w, list, ttHit ? Move::fromRaw(tte->move) : Move(), ply);
+    for (int i = 0; i < list.size(); i++)
+    {
+        Move m = pickMove(list, i);
+        if (!board.makeMove<US>(m))
+        {
+            continue;
+        }
+        tt.prefetch(board.getHash());
+        int score = -quiescence<US ^ 1>(w, -beta, -alpha, ply + 1);
+        board.unmakeMove<US>();
+
+        if (stopped.load(memory_order_relaxed))
+        {
+            return 0;
+        }
+        if (score > bestScore)
+        {
+            bestScore = score;
+            if (score > alpha)
+            {
+                alpha = score;
+                bestMove = m;
+                if (score >= beta)
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    int bound = bestScore >= beta ? BOUND_LOWER : (bestScore > originalAlpha ? BOUND_EXACT : BOUND_UPPER);
+    tt.store(tte, board.getHash(), bestMove, TranspositionTable::scoreToTT(bestScore, ply, MATE_BOUND), 0, bound);
+    return bestScore;
+}
+
+/**
+ * @brief Starts the quiescence search for whichever side is to move.
+ */
+int Search::quiescence(Worker& w, int alpha, int beta, int ply)
+{
+    if (w.board.sideToMove() == WHITE)
+    {
+        return quiescence<WHITE>(w, alpha, beta, ply);
+    }
+    return quiescence<BLACK>(w, alpha, beta, ply);
+}
+
+/**
+ * @brief Searches a node with the principal variation search algorithm.
+ *
+ * Before trying moves at a non-PV node the search may razor (drop to
+ * quiescence when far below alpha), apply reverse futility (return when
+ * far above beta) or try a null move. While trying moves it may skip
+ * quiet moves that cannot raise alpha (futility) and reduce late quiet
+ * moves (LMR), re-searching at full depth if a reduced move looks good.
+ */
+int Search::negamax(Worker& w, int depth, int alpha, int beta, int ply, bool allowNull)
+{
+    EngineBoard& board = w.board;
+    w.pvLength[ply] = ply;
+
+    if (w.id == 0 && ((w.nodes.get() & (CHECK_INTERVAL - 1)) == 0 || w.nodes.get() == limits.nodes))
+    {
+        checkLimits();
+    }
+    if (stopped.load(memory_order_relaxed))
+    {
+        return 0;
+    }
+
+    bool pvNode = (beta - alpha) > 1;
+
+    if (ply > 0)
+    {
+        if (board.isDraw())
+        {
+            return 0;
+        }
+
+        //Mate distance pruning: no score here can beat a shorter mate already found
+        alpha = max(alpha, -MATE_SCORE + ply);
+        beta = min(beta, MATE_SCORE - ply - 1);
+        if (alpha >= beta)
+        {
+            return alpha;
+        }
+
+        //Endgame tables: a covered position is scored exactly, mates by their distance
+        if (tablebase && options.tablebases && Bitboards::popCount(board.occupancy()) <= tablebase->maxPieces())
+        {
+            int wdl, dtm;
+            if (tablebase->probe(board, wdl, dtm))
+            {
+                if (wdl == Tablebase::TB_WIN)
+                {
+                    return MATE_SCORE - ply - dtm;
+                }
+                return (wdl == Tablebase::TB_LOSS) ? -MATE_SCORE + ply + dtm : 0;
+            }
+        }
+    }
+    if (ply >= MAX_PLY - 1)
+    {
+        return evaluate(w);
+    }
+
+    //Transposition table: reuse a deep enough result, or at least its move
+    bool ttHit;
+    TTEntry* tte = tt.probe(board.getHash(), ttHit);
+    w.ttProbes.add();
+    if (ttHit)
+    {
+        w.ttHits.add();
+    }
+    Move ttMove = ttHit ? Move::fromRaw(tte->move) : Move();
+    if (ttHit && !pvNode && tte->depth >= depth)
+    {
+        int ttScore = TranspositionTable::scoreFromTT(tte->score, ply, MATE_BOUND);
+        int bound = tte->bound();
+        if (bound == BOUND_EXACT || (bound == BOUND_LOWER && ttScore >= beta) || (bound == BOUND_UPPER && ttScore <= alpha))
+        {
+            w.ttCutoffs.add();
+            return ttScore;
+        }
+    }
+
+    bool inCheck = board.inCheck();
+    if (inCheck && options.checkExtensions)
+    {
+        depth++;
+    }
+    if (depth <= 0)
+    {
+        return quiescence(w, alpha, beta, ply);
+    }
+
+    w.nodes.add();
+    if (ply > w.selDepth)
+    {
+        w.selDepth = ply;
+    }
+
+    int us = board.sideToMove();
+    int staticEval = inCheck ? -INFINITE_SCORE : evaluate(w);
+
+    if (!pvNode && !inCheck)
+    {
+        //Razoring: far below alpha near the leaves, only tactics can help
+        if (options.razoring && depth <= 3 && staticEval + RAZOR_MARGIN[depth] < alpha)
+        {
+            int score = quiescence(w, alpha - 1, alpha, ply);
+            if (score < alpha)
+            {
+                return score;
+            }
+        }
+
+        //Reverse futility: far above beta near the leaves, assume the cutoff holds
+        if (options.futilityPruning && depth <= 3 && abs(beta) < MATE_BOUND
+            && staticEval - REVERSE_FUTILITY_MARGIN * depth >= beta)
+        {
+            return staticEval;
+        }
+
+        //Null move: if passing still beats beta, a real move almost surely does too.
+        //Not tried without pieces, where zugzwang is common.
+        int material = board.nonPawnMaterial(us);
+        if (options.nullMove && allowNull && depth >= 3 && staticEval >= beta && material > 0)
+        {
+            int reduction = 3 + depth / 6;
+            w.followPv = false;
+
+            board.makeNullMove();
+            int score = -negamax(w, depth - 1 - reduction, -beta, -beta + 1, ply + 1, false);
+            board.unmakeNullMove();
+
+            if (stopped.load(memory_order_relaxed))
+            {
+                return 0;
+            }
+            if (score >= beta)
+            {
+                if (score >= MATE_BOUND)
+                {
+                    score = beta;
+                }
+
+                //With little material left, confirm the cutoff with a reduced normal search
+                if (options.nullMoveVerification && material <= NULL_VERIFY_MATERIAL)
+                {
+                    int verified = negamax(w, depth - reduction, beta - 1, beta, ply, false);
+                    if (stopped.load(memory_order_relaxed))
+                    {
+                        return 0;
+                    }
+                    if (verified >= beta)
+                    {
+                        return score;
+                    }
+                }
+                else
+                {
+                    return score;
+                }
+            }
+        }
+    }
+
+    //Futility: near the leaves, quiet moves cannot lift a hopeless static score to alpha
+    bool futile = options.futilityPruning && !pvNode && !inCheck && depth <= 3
+        && abs(alpha) < MATE_BOUND && staticEval + FUTILITY_MARGIN[depth] <= alpha;
+
+    MoveList list;
+    generate(w, list, false);
+
+    Move pvMove;
+    if (w.followPv)
+    {
+        if (ply < w.prevPvLength)
+        {
+            pvMove = w.prevPv[ply];
+        }
+        else
+        {
+            w.followPv = false;
+        }
+    }
+    scoreMoves(w, list, ttMove.isNull() ? pvMove : ttMove, ply);
+
+    int bestScore = -INFINITE_SCORE;
+    int originalAlpha = alpha;
+    Move bestMove;
+    int legalMoves = 0;
+
+    for (int i = 0; i < list.size(); i++)
+    {
+        Move m = pickMove(list, i);
+        bool quiet = !m.isCapture() && !m.isPromotion();
+        bool killer = (m == w.killers[ply][0] || m == w.killers[ply][1]);
+
+        if (m != pvMove)
+        {
+            w.followPv = false;
+        }
+        if (!board.makeMove(m))
+        {
+            continue;
+        }
+        tt.prefetch(board.getHash());
+        legalMoves++;
+        bool givesCheck = board.inCheck();
+
+        if (futile && legalMoves > 1 && quiet && !givesCheck)
+        {
+            board.unmakeMove();
+            continue;
+        }
+
+        int score;
+        if (legalMoves == 1)
+        {
+            score = -negamax(w, depth - 1, -beta, -alpha, ply + 1, true);
+        }
+        else
+        {
+            int reduction = 0;
+            if (options.lateMoveReductions && depth >= 3 && legalMoves > 3 && quiet
+                && !inCheck && !givesCheck && !killer)
+            {
+                reduction = lmrTable[min(depth, 63)][min(legalMoves, 63)];
+                if (pvNode)
+                {
+                    reduction--;
+                }
+                reduction = max(0, min(reduction, depth - 2));
+            }
+
+            //Zero-window search, possibly reduced; widen only when it beats alpha
+            score = -negamax(w, depth - 1 - reduction, -alpha - 1, -alpha, ply + 1, true);
+            if (score > alpha && reduction > 0)
+            {
+                score = -negamax(w, depth - 1, -alpha - 1, -alpha, ply + 1, true);
+            }
+            if (score > alpha && score < beta)
+            {
+                score = -negamax(w, depth - 1, -beta, -alpha, ply + 1, true);
+            }
+        }
+        board.unmakeMove();
+
+        if (stopped.load(memory_order_relaxed))
+        {
+            return 0;
+        }
+
+        if (score > bestScore)
+        {
+            bestScore = score;
+            if (score > alpha)
+            {
+                alpha = score;
+                bestMove = m;
+
+                //Extend the principal variation with this move
+                w.pvTable[ply][ply] = m;
+                for (int next = ply + 1; next < w.pvLength[ply + 1]; next++)
+                {
+                    w.pvTable[ply][next] = w.pvTable[ply + 1][next];
+                }
+                w.pvLength[ply] = w.pvLength[ply + 1];
+
+                if (score >= beta)
+                {
+                    w.betaCutoffs.add();
+                    if (legalMoves == 1)
+                    {
+                        w.firstMoveCutoffs.add();
+                    }
+                    if (quiet)
+                    {
+                        if (w.killers[ply][0] != m)
+                        {
+                            w.killers[ply][1] = w.killers[ply][0];
+                            w.killers[ply][0] = m;
+                        }
+                        int& entry = w.history[us][m.getFrom()][m.getTo()];
+                        entry += depth * depth;
+                        if (entry > HISTORY_LIMIT)
+                        {
+                            //Age the whole table so old cutoffs fade
+                            for (int from = 0; from < 64; from++)
+                            {
+                                for (int to = 0; to < 64; to++)
+                                {
+                                    w.history[us][from][to] /= 2;
+                                }
+                            }
+                        }
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
+    if (legalMoves == 0)
+    {
+        return inCheck ? -MATE_SCORE + ply : 0;
+    }
+
+    int bound = bestScore >= beta ? BOUND_LOWER : (bestScore > originalAlpha ? BOUND_EXACT : BOUND_UPPER);
+    tt.store(tte, board.getHash(), bestMove, TranspositionTable::scoreToTT(bestScore, ply, MATE_BOUND), depth, bound);
+    return bestScore;
+}
+
+/**
+ * @brief Formats a score as UCI text ("cp 35" or "mate 3").
+ */
+string Search::formatScore(int score)
+{
+    if (score >= MATE_BOUND)
+    {
+        return "mate " + to_string((MATE_SCORE - score + 1) / 2);
+    }
+    if (score <= -MATE_BOUND)
+    {
+        return "mate " + to_string(-(MATE_SCORE + score) / 2);
+    }
+    return "cp " + to_string(score);
+}
+
+/**
+ * @brief Writes the info lines for a completed iteration of the main thread.
+ *
+ * With instrumentation on, a second "info string stats" line follows with
+ * the table and cutoff rates, the effective branching factor, the time
+ * split between move generation and evaluation, and each thread's speed.
+ */
+void Search::reportIteration(const Worker& w, int depth, int score, double branchingFactor) const
+{
+    if (!info)
+    {
+        return;
+    }
+
+    long long ms = elapsedMs();
+    SearchCounters total = counters();
+    uint64_t nps = ms > 0 ? total.nodes * 1000 / ms : total.nodes;
+
+    *info << "info depth " << depth << " seldepth " << w.selDepth
+        << " score " << formatScore(score)
+        << " nodes " << total.nodes << " nps " << nps << " hashfull " << tt.hashfull()
+        << " time " << ms << " pv";
+    for (int i = 0; i < w.pvLength[0]; i++)
+    {
+        *info << " " << w.pvTable[0][i].toString();
+    }
+    *info << "\n";
+
+    if (!options.instrumentation)
+    {
+        return;
+    }
+
+    double hitRate = total.ttProbes ? 100.0 * total.ttHits / total.ttProbes : 0;
+    double firstMoveRate = total.betaCutoffs ? 100.0 * total.firstMoveCutoffs / total.betaCutoffs : 0;
+
+    *info << fixed << setprecision(1)
+        << "info string stats qnodes " << total.qnodes
+        << " ttprobes " << total.ttProbes << " tthits " << hitRate << "%"
+        << " ttcuts " << total.ttCutoffs
+        << " fmc " << firstMoveRate << "%"
+        << " ebf " << setprecision(2) << branchingFactor
+        << " genms " << total.moveGenNs / 1000000 << " evalms " << total.evalNs / 1000000
+        << " threadnps";
+    for (const auto& worker : workers)
+    {
+        *info << " " << (ms > 0 ? worker->nodes.get() * 1000 / ms : worker->nodes.get());
+    }
+    *info << defaultfloat << setprecision(6) << "\n";
+}
+
+/**
+ * @brief Rewrites the metrics file with the current counters.
+ *
+ * The file holds one "key=value" pair per line. It is written under a
+ * temporary name and renamed, so a reader polling it never sees half a file.
+ */
+void Search::writeMetrics(int depth, double branchingFactor) const
+{
+    string temporary = options.metricsFile + ".tmp";
+    ofstream out(temporary, ios::trunc);
+    if (!out)
+    {
+        return;
+    }
+
+    long long ms = elapsedMs();
+    SearchCounters total = counters();
+
+    out << "time_ms=" << ms << "\n"
+        << "depth=" << depth << "\n"
+        << "threads=" << workers.size() << "\n"
+        << "nodes=" << total.nodes << "\n"
+        << "qnodes=" << total.qnodes << "\n"
+        << "nps=" << (ms > 0 ? total.nodes * 1000 / ms : total.nodes) << "\n"
+        << "tt_probes=" << total.ttProbes << "\n"
+        << "tt_hits=" << total.ttHits << "\n"
+        << "tt_cutoffs=" << total.ttCutoffs << "\n"
+        << "hashfull=" << tt.hashfull() << "\n"
+        << "beta_cutoffs=" << total.betaCutoffs << "\n"
+        << "first_move_cutoffs=" << total.firstMoveCutoffs << "\n"
+        << "ebf=" << branchingFactor << "\n"
+        << "movegen_ms=" << total.moveGenNs / 1000000 << "\n"
+        << "eval_ms=" << total.evalNs / 1000000 << "\n";
+    for (const auto& worker : workers)
+    {
+        out << "thread" << worker->id << "_nps=" << (ms > 0 ? worker->nodes.get() * 1000 / ms : worker->nodes.get()) << "\n";
+    }
+    out.close();
+
+#ifdef _WIN32
+    //rename() does not replace an existing file on Windows
+    remove(options.metricsFile.c_str());
+#endif
+    rename(temporary.c_str(), options.metricsFile.c_str());
+}
+
+/**
+ * @brief Runs iterative deepening on one worker until stopped.
+ *
+ * Each iteration searches one ply deeper than the last. From depth 5 on
+ * the root window starts narrow around the previous score and is widened
+ * on the failing side until the score falls inside it. Odd helper threads
+ * start one ply deeper so the threads spread over more of the tree.
+ */
+void Search::iterate(Worker& w)
+{
+    int maxDepth = min(limits.depth, MAX_PLY - 1);
+    int score = 0;
+    uint64_t lastIterationNodes = 0;
+
+    for (int depth = 1 + (w.id & 1); depth <= maxDepth; depth++)
+    {
+        uint64_t startNodes = w.nodes.get();
+        w.selDepth = 0;
+        int delta = ASPIRATION_WINDOW;
+        int alpha = -INFINITE_SCORE;
+        int beta = INFINITE_SCORE;
+        if (options.aspirationWindows && depth >= 5)
+        {
+            alpha = max(score - delta, -INFINITE_SCORE);
+            beta = min(score + delta, INFINITE_SCORE);
+        }
+
+        while (true)
+        {
+            w.followPv = true;
+            int value = negamax(w, depth, alpha, beta, 0, false);
+            if (stopped.load(memory_order_relaxed))
+            {
+                break;
+            }
+
+            if (value <= alpha)
+            {
+                alpha = max(value - delta, -INFINITE_SCORE);
+            }
+            else if (value >= beta)
+            {
+                beta = min(value + delta, INFINITE_SCORE);
+            }
+            else
+            {
+                score = value;
+                break;
+            }
+            delta *= 2;
+        }
+
+        if (stopped.load(memory_order_relaxed))
+        {
+            break;
+        }
+
+        //Iteration complete: keep its principal variation for ordering the next one
+        w.prevPvLength = w.pvLength[0];
+        for (int i = 0; i < w.prevPvLength; i++)
+        {
+            w.prevPv[i] = w.pvTable[0][i];
+        }
+
+        uint64_t iterationNodes = w.nodes.get() - startNodes;
+        w.branchingFactor = lastIterationNodes ? static_cast<double>(iterationNodes) / lastIterationNodes : 0;
+        lastIterationNodes = iterationNodes;
+
+        w.result.depth = depth;
+        w.result.score = score;
+        w.result.bestMove = w.pvTable[0][0];
+        w.result.pv.assign(w.prevPv, w.prevPv + w.prevPvLength);
+
+        if (w.id == 0)
+        {
+            reportIteration(w, depth, score, w.branchingFactor);
+
+            //Stop early on a forced mate that the remaining depth cannot improve
+            if (abs(score) >= MATE_BOUND && MATE_SCORE - abs(score) <= depth)
+            {
+                break;
+            }
+
+            //On a clock, stop once the (stability-adjusted) soft limit is used up
+            if (timeManager.iterationDone(elapsedMs(), w.result.bestMove, score))
+            {
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Searches a position until a limit is reached.
+ *
+ * Helper threads search copies of the position until the main thread
+ * finishes, then the main thread's result is returned. On a clock the
+ * time manager sets the limits from the side to move's remaining time.
+ */
+SearchResult Search::think(const EngineBoard& board, const SearchLimits& searchLimits)
+{
+    limits = searchLimits;
+    stopped = false;
+    startTime = chrono::steady_clock::now();
+    lastMetricsWrite = 0;
+    tt.newSearch();
+
+    int side = board.sideToMove();
+    timeManager.start(limits.moveTime, limits.time[side], limits.increment[side], limits.movesToGo);
+
+    SearchResult result;
+
+    //Fall back to any legal move so a result exists even if depth 1 is interrupted
+    EngineBoard root = board;
+    MoveList legal;
+    root.generateLegalMoves(legal);
+    if (legal.size() == 0)
+    {
+        result.score = root.inCheck() ? -MATE_SCORE : 0;
+        return result;
+    }
+
+    for (auto& worker : workers)
+    {
+        worker->board = board;
+        worker->resetCounters();
+        worker->prevPvLength = 0;
+        worker->branchingFactor = 0;
+        worker->result = SearchResult();
+        worker->result.bestMove = legal[0];
+    }
+
+    vector<thread> helpers;
+    for (size_t i = 1; i < workers.size(); i++)
+    {
+        helpers.emplace_back(&Search::iterate, this, ref(*workers[i]));
+    }
+    iterate(*workers[0]);
+    stopped = true;
+    for (auto& helper : helpers)
+    {
+        helper.join();
+    }
+
+    result = workers[0]->result;
+    result.nodes = counters().nodes;
+    result.timeMs = elapsedMs();
+    if (timeManager.isTimed())
+    {
+        result.overshootMs = max(0LL, result.timeMs - timeManager.getHardLimit());
+        if (info)
+        {
+            *info << "info string time soft " << timeManager.getSoftLimit() << " hard " << timeManager.getHardLimit()
+                << " used " << result.timeMs << " overshoot " << result.overshootMs << "\n";
+        }
+    }
+    if (!options.metricsFile.empty())
+    {
+        writeMetrics(result.depth, workers[0]->branchingFactor);
+    }
+    return result;
+}
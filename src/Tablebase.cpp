@@ -0,0 +1,1322 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Tablebase Class Implementation
+
+#include "Tablebase.h"
+#include <algorithm>    //For sorting material letters.
+#include <atomic>       //For the position states shared by the generating threads.
+#include <chrono>       //For timing generation.
+#include <cstring>      //For comparing file headers.
+#include <fstream>      //For writing and reading table files.
+#include <set>          //For listing material names once.
+#include <thread>       //For generating in parallel.
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>      //For opening table files to map.
+#include <sys/mman.h>   //For mmap.
+#include <sys/stat.h>   //For table file sizes.
+#include <unistd.h>     //For closing mapped files.
+#endif
+
+//Stored win/draw/loss codes, 2 bits per position
+static const int WDL_DRAW = 0;
+static const int WDL_WIN = 1;
+static const int WDL_LOSS = 2;
+static const int WDL_INVALID = 3;   //Two pieces on a square, touching kings or the side not to move in check
+
+//Working states during generation, one byte per position; decided positions store DECIDED + plies to mate
+static const uint8_t UNDECIDED = 0;
+static const uint8_t INVALID = 1;
+static const uint8_t DRAWN = 2;
+static const uint8_t DECIDED = 3;
+static const int MAX_DTM = 250;     //Longest mate a table can hold, in plies
+
+//Per-position levels found by the first pass from moves that leave the table
+static const uint8_t NO_LEVEL = 255;    //No win through an exit / an exit that draws
+
+//Piece letters by PieceType, and the order letters are written in a material name
+static const char PIECE_LETTERS[] = "PNBRQK";
+static const char NAME_ORDER[] = "QRBNP";
+static const int PIECE_VALUE[6] = { 1, 3, 3, 5, 9, 0 };
+
+//Identifies table files
+static const char FILE_MAGIC[8] = { 'C', 'H', 'E', 'S', 'S', 'T', 'B', '\0' };
+static const uint32_t FILE_VERSION = 1;
+
+/**
+ * @struct TableFileHeader
+ * @brief The 64 bytes at the start of a table file, followed by the win/draw/loss bits and the mate distance bits.
+ */
+struct TableFileHeader
+{
+    char magic[8];              //FILE_MAGIC
+    uint32_t version;           //FILE_VERSION
+    uint32_t dtmBits;           //Bits per mate distance
+    uint32_t maxDtm;            //Longest mate in plies
+    uint32_t pieceCount;        //Pieces per position
+    uint64_t positions;         //Positions in the index
+    char material[16];          //Material name, zero padded
+    uint64_t reserved[2];       //Always zero
+};
+
+static_assert(sizeof(TableFileHeader) == 64, "table file headers are 64 bytes");
+
+/**
+ * @struct KingSlots
+ * @brief Where the White king may stand in an index, computed by the compiler.
+ *
+ * Without pawns every position can be turned so the White king is in the
+ * a1-d1-d4 triangle (10 squares); pawns only allow a left-right mirror, so
+ * the king is kept on the a-d files (32 squares). Index [1] is the pawn case.
+ */
+struct KingSlots
+{
+    int slot[2][64];        //Slot of each square, or -1 outside the folded area
+    int square[2][32];      //Square of each slot
+
+    static constexpr KingSlots build()
+    {
+        KingSlots k{};
+        int count[2] = { 0, 0 };
+        for (int sq = 0; sq < 64; sq++)
+        {
+            int file = sq & 7;
+            int rank = 7 - (sq >> 3);
+            k.slot[0][sq] = -1;
+            k.slot[1][sq] = -1;
+            if (file <= 3 && rank <= file)
+            {
+                k.slot[0][sq] = count[0];
+                k.square[0][count[0]++] = sq;
+            }
+            if (file <= 3)
+            {
+                k.slot[1][sq] = count[1];
+                k.square[1][count[1]++] = sq;
+            }
+        }
+        return k;
+    }
+};
+
+static constexpr KingSlots KING_SLOTS = KingSlots::build();
+
+//Orientation flags: mirror the files, mirror the ranks, swap files and ranks
+static const int MIRROR_FILE = 1;
+static const int MIRROR_RANK = 2;
+static const int TRANSPOSE = 4;
+
+/**
+ * @brief Moves a square by an orientation.
+ */
+static inline int orientSquare(int sq, int flags)
+{
+    int file = sq & 7;
+    int rank = 7 - (sq >> 3);
+    if (flags & MIRROR_FILE)
+    {
+        file = 7 - file;
+    }
+    if (flags & MIRROR_RANK)
+    {
+        rank = 7 - rank;
+    }
+    if (flags & TRANSPOSE)
+    {
+        swap(file, rank);
+    }
+    return (7 - rank) * 8 + file;
+}
+
+/**
+ * @brief Gets the orientation that brings the White king into the index's folded area.
+ */
+static inline int orientationOf(int kingSquare, bool pawns)
+{
+    int file = kingSquare & 7;
+    int rank = 7 - (kingSquare >> 3);
+    int flags = 0;
+    if (file > 3)
+    {
+        flags |= MIRROR_FILE;
+        file = 7 - file;
+    }
+    if (pawns)
+    {
+        return flags;
+    }
+    if (rank > 3)
+    {
+        flags |= MIRROR_RANK;
+        rank = 7 - rank;
+    }
+    if (rank > file)
+    {
+        flags |= TRANSPOSE;
+    }
+    return flags;
+}
+
+/**
+ * @brief Gets the index of a position whose pieces are in table slot order, turned by an orientation.
+ *
+ * @param squares The square of each slot; squares[0] is the White king.
+ * @param flags An orientation that brings the White king into the folded area.
+ */
+static uint64_t encodeOriented(const int squares[], int count, bool pawns, int side, int flags)
+{
+    uint64_t index = static_cast<uint64_t>(side) * (pawns ? 32 : 10)
+        + static_cast<uint64_t>(KING_SLOTS.slot[pawns][orientSquare(squares[0], flags)]);
+    for (int i = 1; i < count; i++)
+    {
+        index = index * 64 + static_cast<uint64_t>(orientSquare(squares[i], flags));
+    }
+    return index;
+}
+
+/**
+ * @brief Gets the index of a position whose pieces are in table slot order.
+ */
+static uint64_t encodeIndex(const int squares[], int count, bool pawns, int side)
+{
+    return encodeOriented(squares, count, pawns, side, orientationOf(squares[0], pawns));
+}
+
+/**
+ * @brief Gets the second index of a position whose White king folds onto the a1-h8 diagonal.
+ *
+ * Such a position and its mirror in that diagonal both fit the index, so
+ * both are stored and must be decided together.
+ *
+ * @return True if the position has a twin, which is then written to twin.
+ */
+static bool twinIndex(const int squares[], int count, bool pawns, int side, uint64_t& twin)
+{
+    int flags = orientationOf(squares[0], pawns);
+    int king = orientSquare(squares[0], flags);
+    if (pawns || (king & 7) != 7 - (king >> 3))
+    {
+        return false;
+    }
+    twin = encodeOriented(squares, count, pawns, side, flags ^ TRANSPOSE);
+    return true;
+}
+
+/**
+ * @brief Gets the squares and side to move of an index.
+ */
+static void decodeIndex(uint64_t index, int count, bool pawns, int squares[], int& side)
+{
+    for (int i = count - 1; i >= 1; i--)
+    {
+        squares[i] = static_cast<int>(index & 63);
+        index >>= 6;
+    }
+    uint64_t slots = pawns ? 32 : 10;
+    squares[0] = KING_SLOTS.square[pawns][index % slots];
+    side = static_cast<int>(index / slots);
+}
+
+/**
+ * @brief Gets the squares a piece attacks.
+ */
+static inline uint64_t attacksFrom(int code, int sq, uint64_t occupied)
+{
+    switch (code % 6)
+    {
+    case PAWN: return Bitboards::pawnAttacks(code / 6, sq);
+    case KNIGHT: return Bitboards::knightAttacks(sq);
+    case BISHOP: return Bitboards::bishopAttacks(sq, occupied);
+    case ROOK: return Bitboards::rookAttacks(sq, occupied);
+    case QUEEN: return Bitboards::queenAttacks(sq, occupied);
+    default: return Bitboards::kingAttacks(sq);
+    }
+}
+
+/**
+ * @brief Checks whether any piece of one side attacks a square.
+ */
+static bool isAttacked(const int codes[], const int squares[], int count, int target, int byColor, uint64_t occupied)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (codes[i] / 6 == byColor && (attacksFrom(codes[i], squares[i], occupied) & Bitboards::squareBit(target)))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Gets the square of one side's king.
+ */
+static int kingOf(const int codes[], const int squares[], int count, int color)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (codes[i] == color * 6 + KING)
+        {
+            return squares[i];
+        }
+    }
+    return NO_SQUARE;
+}
+
+/**
+ * @brief Gets the squares taken by a set of pieces.
+ */
+static uint64_t occupancyOf(const int squares[], int count)
+{
+    uint64_t occupied = 0;
+    for (int i = 0; i < count; i++)
+    {
+        occupied |= Bitboards::squareBit(squares[i]);
+    }
+    return occupied;
+}
+
+/**
+ * @brief Checks whether pieces on squares form a position that can occur with a side to move.
+ */
+static bool validPosition(const int codes[], const int squares[], int count, int side)
+{
+    uint64_t occupied = occupancyOf(squares, count);
+    if (Bitboards::popCount(occupied) != count)
+    {
+        return false;
+    }
+    for (int i = 0; i < count; i++)
+    {
+        int row = Bitboards::rowOf(squares[i]);
+        if (codes[i] % 6 == PAWN && (row == 0 || row == 7))
+        {
+            return false;
+        }
+    }
+    int whiteKing = kingOf(codes, squares, count, WHITE);
+    int blackKing = kingOf(codes, squares, count, BLACK);
+    if (Bitboards::distance(whiteKing, blackKing) <= 1)
+    {
+        return false;
+    }
+    int waiting = side ^ 1;
+    return !isAttacked(codes, squares, count, waiting == WHITE ? whiteKing : blackKing, side, occupied);
+}
+
+/**
+ * @brief Calls visit for every position reached by a legal move.
+ *
+ * The children keep the parent's slot order; a captured piece is removed
+ * and a promoted pawn changes its code. visit receives the child's codes,
+ * squares and piece count, and whether the move left the table's material.
+ */
+template <typename Visit>
+static void forEachChild(const int codes[], const int squares[], int count, int side, Visit visit)
+{
+    uint64_t occupied = occupancyOf(squares, count);
+    uint64_t own = 0;
+    for (int i = 0; i < count; i++)
+    {
+        if (codes[i] / 6 == side)
+        {
+            own |= Bitboards::squareBit(squares[i]);
+        }
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        if (codes[i] / 6 != side)
+        {
+            continue;
+        }
+        int from = squares[i];
+        int type = codes[i] % 6;
+        uint64_t targets;
+        if (type == PAWN)
+        {
+            int step = (side == WHITE) ? -8 : 8;
+            targets = Bitboards::pawnAttacks(side, from) & occupied & ~own;
+            if (!(occupied & Bitboards::squareBit(from + step)))
+            {
+                targets |= Bitboards::squareBit(from + step);
+                int startRow = (side == WHITE) ? 6 : 1;
+                if (Bitboards::rowOf(from) == startRow && !(occupied & Bitboards::squareBit(from + 2 * step)))
+                {
+                    targets |= Bitboards::squareBit(from + 2 * step);
+                }
+            }
+        }
+        else
+        {
+            targets = attacksFrom(codes[i], from, occupied) & ~own;
+        }
+
+        while (targets)
+        {
+            int to = Bitboards::popLsb(targets);
+            int childCodes[Tablebase::MAX_PIECES];
+            int childSquares[Tablebase::MAX_PIECES];
+            int childCount = 0;
+            int mover = 0;
+            bool capture = false;
+            for (int j = 0; j < count; j++)
+            {
+                if (j != i && squares[j] == to)
+                {
+                    capture = true;
+                    continue;
+                }
+                if (j == i)
+                {
+                    mover = childCount;
+                }
+                childCodes[childCount] = codes[j];
+                childSquares[childCount] = (j == i) ? to : squares[j];
+                childCount++;
+            }
+
+            uint64_t childOccupied = (occupied & ~Bitboards::squareBit(from)) | Bitboards::squareBit(to);
+            int king = (type == KING) ? to : kingOf(childCodes, childSquares, childCount, side);
+            if (isAttacked(childCodes, childSquares, childCount, king, side ^ 1, childOccupied))
+            {
+                continue;
+            }
+
+            int row = Bitboards::rowOf(to);
+            if (type == PAWN && (row == 0 || row == 7))
+            {
+                for (int promotion = QUEEN; promotion >= KNIGHT; promotion--)
+                {
+                    childCodes[mover] = side * 6 + promotion;
+                    visit(childCodes, childSquares, childCount, true);
+                }
+            }
+            else
+            {
+                visit(childCodes, childSquares, childCount, capture);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Calls visit with the squares of every position that reaches this one by a quiet move.
+ *
+ * Only moves that keep the material count: no captures and no
+ * promotions, since those parents belong to bigger tables. The parents
+ * have the other side to move.
+ */
+template <typename Visit>
+static void forEachParent(const int codes[], const int squares[], int count, int side, Visit visit)
+{
+    int mover = side ^ 1;
+    uint64_t occupied = occupancyOf(squares, count);
+    int parentSquares[Tablebase::MAX_PIECES];
+    for (int j = 0; j < count; j++)
+    {
+        parentSquares[j] = squares[j];
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        if (codes[i] / 6 != mover)
+        {
+            continue;
+        }
+        int to = squares[i];
+        uint64_t origins;
+        if (codes[i] % 6 == PAWN)
+        {
+            //Undo a push: one square back, or two from the fourth rank
+            int back = (mover == WHITE) ? 8 : -8;
+            int row = Bitboards::rowOf(to + back);
+            origins = 0;
+            if (row >= 1 && row <= 6 && !(occupied & Bitboards::squareBit(to + back)))
+            {
+                origins |= Bitboards::squareBit(to + back);
+                int doubleRow = (mover == WHITE) ? 4 : 3;
+                if (Bitboards::rowOf(to) == doubleRow && !(occupied & Bitboards::squareBit(to + 2 * back)))
+                {
+                    origins |= Bitboards::squareBit(to + 2 * back);
+                }
+            }
+        }
+        else
+        {
+            origins = attacksFrom(codes[i], to, occupied) & ~occupied;
+        }
+
+        while (origins)
+        {
+            parentSquares[i] = Bitboards::popLsb(origins);
+            visit(parentSquares);
+        }
+        parentSquares[i] = to;
+    }
+}
+
+/**
+ * @brief Runs body(begin, end) over a range in chunks shared out between threads.
+ */
+template <typename Body>
+static void parallelFor(uint64_t size, int threads, Body body)
+{
+    const uint64_t CHUNK = 1 << 14;
+    atomic<uint64_t> next(0);
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++)
+    {
+        workers.emplace_back([&]()
+        {
+            while (true)
+            {
+                uint64_t begin = next.fetch_add(CHUNK);
+                if (begin >= size)
+                {
+                    break;
+                }
+                body(begin, min(size, begin + CHUNK));
+            }
+        });
+    }
+    for (thread& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Gets the key of a set of pieces: four bits of count per piece code.
+ */
+static uint64_t materialKey(const int codes[], int count, bool flip)
+{
+    uint64_t key = 0;
+    for (int i = 0; i < count; i++)
+    {
+        int code = flip ? (codes[i] + 6) % 12 : codes[i];
+        key += 1ULL << (code * 4);
+    }
+    return key;
+}
+
+/**
+ * @brief Gets the total piece value of one side's letters in a material name.
+ */
+static int sideValue(const string& letters)
+{
+    int total = 0;
+    for (char ch : letters)
+    {
+        total += PIECE_VALUE[strchr(PIECE_LETTERS, ch) - PIECE_LETTERS];
+    }
+    return total;
+}
+
+/**
+ * @brief Sorts one side's letters into name order (QRBNP).
+ */
+static string sortLetters(string letters)
+{
+    sort(letters.begin(), letters.end(), [](char a, char b)
+    {
+        return strchr(NAME_ORDER, a) < strchr(NAME_ORDER, b);
+    });
+    return letters;
+}
+
+/**
+ * @brief Adds every multiset of up to left piece letters, in name order, to a list.
+ */
+static void listLetters(const string& prefix, int from, int left, vector<string>& out)
+{
+    out.push_back(prefix);
+    if (left == 0)
+    {
+        return;
+    }
+    for (int i = from; i < 5; i++)
+    {
+        listLetters(prefix + NAME_ORDER[i], i, left - 1, out);
+    }
+}
+
+/**
+ * @brief Releases a table's mapping.
+ */
+Tablebase::Table::~Table()
+{
+#if defined(__unix__) || defined(__APPLE__)
+    if (mapping)
+    {
+        munmap(mapping, mappedBytes);
+    }
+#endif
+}
+
+/**
+ * @brief Constructs an empty tablebase that keeps its files in the working directory.
+ */
+Tablebase::Tablebase() : directory("."), largest(0)
+{
+}
+
+/**
+ * @brief Gets a material name with the stronger side as White.
+ *
+ * The stronger side has more piece value, then more pieces; equal sides
+ * are ordered by their letters so every balance has exactly one name.
+ */
+string Tablebase::normalise(const string& name)
+{
+    size_t second = name.find('K', 1);
+    if (name.empty() || name[0] != 'K' || second == string::npos
+        || name.find_first_not_of("KQRBNP") != string::npos)
+    {
+        return name;
+    }
+    string white = sortLetters(name.substr(1, second - 1));
+    string black = sortLetters(name.substr(second + 1));
+    int whiteValue = sideValue(white);
+    int blackValue = sideValue(black);
+    bool swapSides = blackValue > whiteValue
+        || (blackValue == whiteValue && black.size() > white.size())
+        || (blackValue == whiteValue && black.size() == white.size() && black < white);
+    if (swapSides)
+    {
+        swap(white, black);
+    }
+    return "K" + white + "K" + black;
+}
+
+/**
+ * @brief Fills in a table's name, slots and size from a material name.
+ */
+bool Tablebase::parseMaterial(const string& name, Table& table)
+{
+    size_t second = name.find('K', 1);
+    if (name.size() < 2 || name[0] != 'K' || second == string::npos || name.find('K', second + 1) != string::npos
+        || name.size() > MAX_PIECES)
+    {
+        return false;
+    }
+    if (name.find_first_not_of("KQRBNP") != string::npos)
+    {
+        return false;
+    }
+
+    table.name = name;
+    table.pieceCount = static_cast<int>(name.size());
+    table.codes[0] = WHITE * 6 + KING;
+    table.codes[1] = BLACK * 6 + KING;
+    table.pawns = false;
+    int slot = 2;
+    for (size_t i = 1; i < name.size(); i++)
+    {
+        if (i == second)
+        {
+            continue;
+        }
+        int type = static_cast<int>(strchr(PIECE_LETTERS, name[i]) - PIECE_LETTERS);
+        table.codes[slot++] = (i < second ? WHITE : BLACK) * 6 + type;
+        table.pawns = table.pawns || type == PAWN;
+    }
+
+    table.size = 2 * (table.pawns ? 32 : 10);
+    for (int i = 1; i < table.pieceCount; i++)
+    {
+        table.size *= 64;
+    }
+    return true;
+}
+
+/**
+ * @brief Maps a table file and adds it to the loaded tables.
+ */
+bool Tablebase::mapTable(const string& path, string& error)
+{
+    ifstream file(path, ios::binary | ios::ate);
+    if (!file)
+    {
+        error = "cannot open " + path;
+        return false;
+    }
+    size_t fileBytes = static_cast<size_t>(file.tellg());
+    TableFileHeader header;
+    file.seekg(0);
+    if (fileBytes < sizeof(header) || !file.read(reinterpret_cast<char*>(&header), sizeof(header))
+        || memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 || header.version != FILE_VERSION)
+    {
+        error = path + " is not a table file";
+        return false;
+    }
+
+    unique_ptr<Table> table(new Table());
+    header.material[sizeof(header.material) - 1] = '\0';
+    if (!parseMaterial(header.material, *table) || table->size != header.positions
+        || header.dtmBits < 1 || header.dtmBits > 8)
+    {
+        error = path + " has a damaged header";
+        return false;
+    }
+    table->dtmBits = static_cast<int>(header.dtmBits);
+    table->maxDtm = static_cast<int>(header.maxDtm);
+    size_t wdlBytes = static_cast<size_t>((table->size + 3) / 4);
+    size_t dtmBytes = static_cast<size_t>((table->size * header.dtmBits + 7) / 8 + 1);
+    if (fileBytes != sizeof(header) + wdlBytes + dtmBytes)
+    {
+        error = path + " size does not match its header";
+        return false;
+    }
+    file.close();
+
+#if defined(__unix__) || defined(__APPLE__)
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        error = "cannot open " + path;
+        return false;
+    }
+    void* base = mmap(nullptr, fileBytes, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+    {
+        error = "cannot map " + path;
+        return false;
+    }
+    table->mapping = base;
+    table->mappedBytes = fileBytes;
+    const unsigned char* data = static_cast<const unsigned char*>(base);
+#else
+    table->buffer.resize(fileBytes);
+    ifstream data(path, ios::binary);
+    if (!data.read(reinterpret_cast<char*>(table->buffer.data()), static_cast<streamsize>(fileBytes)))
+    {
+        error = "read error";
+        return false;
+    }
+    const unsigned char* data = table->buffer.data();
+#endif
+    table->wdl = data + sizeof(header);
+    table->dtm = table->wdl + wdlBytes;
+
+    uint64_t key = materialKey(table->codes, table->pieceCount, false);
+    byMaterial[key] = table.get();
+    largest = max(largest, table->pieceCount);
+    tables.push_back(move(table));
+    return true;
+}
+
+/**
+ * @brief Finds the table of a set of pieces, in either colour orientation.
+ */
+const Tablebase::Table* Tablebase::find(const int codes[], int count, bool& flipped) const
+{
+    auto found = byMaterial.find(materialKey(codes, count, false));
+    if (found != byMaterial.end())
+    {
+        flipped = false;
+        return found->second;
+    }
+    found = byMaterial.find(materialKey(codes, count, true));
+    if (found != byMaterial.end())
+    {
+        flipped = true;
+        return found->second;
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Looks up a position given as pieces, squares and side to move.
+ *
+ * The pieces are put into the table's slot order, with colours and ranks
+ * swapped when the table has the colours the other way round. Bare kings
+ * are a draw without a table.
+ */
+bool Tablebase::lookup(const int codes[], const int squares[], int count, int side, int& wdl, int& dtm) const
+{
+    if (count == 2)
+    {
+        wdl = TB_DRAW;
+        dtm = 0;
+        return true;
+    }
+
+    bool flipped;
+    const Table* table = find(codes, count, flipped);
+    if (!table)
+    {
+        return false;
+    }
+
+    int slotSquares[MAX_PIECES];
+    bool used[MAX_PIECES] = {};
+    for (int slot = 0; slot < count; slot++)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            int code = flipped ? (codes[i] + 6) % 12 : codes[i];
+            if (!used[i] && code == table->codes[slot])
+            {
+                used[i] = true;
+                slotSquares[slot] = flipped ? squares[i] ^ 56 : squares[i];
+                break;
+            }
+        }
+    }
+
+    uint64_t index = encodeIndex(slotSquares, count, table->pawns, flipped ? side ^ 1 : side);
+    int stored = table->wdlAt(index);
+    if (stored == WDL_INVALID)
+    {
+        return false;
+    }
+    wdl = (stored == WDL_WIN) ? TB_WIN : (stored == WDL_LOSS ? TB_LOSS : TB_DRAW);
+    dtm = (stored == WDL_DRAW) ? 0 : table->dtmAt(index);
+    return true;
+}
+
+/**
+ * @brief Looks a position up.
+ */
+bool Tablebase::probe(const EngineBoard& board, int& wdl, int& dtm) const
+{
+    uint64_t occupied = board.occupancy();
+    int count = Bitboards::popCount(occupied);
+    if (count > largest || board.castlingRights() != 0 || board.enPassantSquare() != NO_SQUARE)
+    {
+        return false;
+    }
+    int codes[MAX_PIECES];
+    int squares[MAX_PIECES];
+    for (int i = 0; occupied; i++)
+    {
+        squares[i] = Bitboards::popLsb(occupied);
+        codes[i] = board.pieceAt(squares[i]);
+    }
+    return lookup(codes, squares, count, board.sideToMove(), wdl, dtm);
+}
+
+/**
+ * @brief Maps every table file found in a directory.
+ *
+ * Tries the file name of every material balance up to MAX_PIECES pieces,
+ * which avoids depending on a directory listing API.
+ */
+int Tablebase::load(const string& path)
+{
+    directory = path.empty() ? "." : path;
+    vector<string> sides;
+    listLetters("", 0, MAX_PIECES - 2, sides);
+
+    set<string> names;
+    for (const string& white : sides)
+    {
+        for (const string& black : sides)
+        {
+            if (white.size() + black.size() + 2 <= MAX_PIECES && white.size() + black.size() > 0)
+            {
+                names.insert(normalise("K" + white + "K" + black));
+            }
+        }
+    }
+
+    int loaded = 0;
+    for (const string& name : names)
+    {
+        Table probeTable;
+        parseMaterial(name, probeTable);
+        if (byMaterial.count(materialKey(probeTable.codes, probeTable.pieceCount, false)))
+        {
+            continue;
+        }
+        string error;
+        if (mapTable(directory + "/" + name + ".ctb", error))
+        {
+            loaded++;
+        }
+    }
+    return loaded;
+}
+
+/**
+ * @brief Generates a table and every smaller table it depends on.
+ *
+ * The smaller tables are those reached by one capture, one promotion, or
+ * a promotion that captures.
+ */
+bool Tablebase::generate(const string& material, int threads, ostream& out, string& error)
+{
+    string name = normalise(material);
+    unique_ptr<Table> table(new Table());
+    if (!parseMaterial(name, *table))
+    {
+        error = "'" + material + "' is not a material such as KQK or KBNK with at most "
+            + to_string(MAX_PIECES) + " pieces";
+        return false;
+    }
+    if (byMaterial.count(materialKey(table->codes, table->pieceCount, false)))
+    {
+        return true;
+    }
+    string path = directory + "/" + name + ".ctb";
+    string ignored;
+    if (mapTable(path, ignored))
+    {
+        out << name << ": loaded " << path << "\n";
+        return true;
+    }
+
+    size_t second = name.find('K', 1);
+    set<string> smaller;
+    for (size_t i = 1; i < name.size(); i++)
+    {
+        if (i == second)
+        {
+            continue;
+        }
+        string captured = name.substr(0, i) + name.substr(i + 1);
+        smaller.insert(captured);
+        if (name[i] != 'P')
+        {
+            continue;
+        }
+        for (char promotion : string("QRBN"))
+        {
+            string promoted = name;
+            promoted[i] = promotion;
+            smaller.insert(promoted);
+            //A pawn promotes by capturing a piece of the other side
+            for (size_t j = 1; j < name.size(); j++)
+            {
+                if (j != second && (j < second) != (i < second))
+                {
+                    smaller.insert(promoted.substr(0, j) + promoted.substr(j + 1));
+                }
+            }
+        }
+    }
+    for (const string& sub : smaller)
+    {
+        if (sub.size() > 2 && !generate(sub, threads, out, error))
+        {
+            return false;
+        }
+    }
+
+    if (threads <= 0)
+    {
+        threads = static_cast<int>(max(1u, thread::hardware_concurrency()));
+    }
+    if (!build(*table, threads, out, error) || !mapTable(path, error))
+    {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Builds one table whose smaller tables are already loaded, and writes it.
+ *
+ * Level d holds the positions that are mate in d plies (d even: the side
+ * to move is mated; d odd: it mates). The first pass marks invalid
+ * positions, mates and stalemates, and records for every position the
+ * best it can do by leaving the table: the earliest win through a capture
+ * or promotion, and the latest loss if every such move loses (or that one
+ * of them draws). Each level then has two passes over the whole index:
+ * positions whose exits decide them at this level are set, and then the
+ * parents of every position decided at this level are examined, a parent
+ * of a loss being a win one ply longer and a parent of a win being a loss
+ * one ply longer once all of its moves are checked to lose no later. The
+ * passes split the index between threads and settle each position with a
+ * compare-and-swap, so no locks are needed. Whatever is still undecided
+ * when no level adds a position is a draw.
+ */
+bool Tablebase::build(Table& table, int threads, ostream& out, string& error)
+{
+    auto start = chrono::steady_clock::now();
+    const uint64_t size = table.size;
+    const int count = table.pieceCount;
+    const bool pawns = table.pawns;
+    const int* codes = table.codes;
+
+    unique_ptr<atomic<uint8_t>[]> state(new atomic<uint8_t>[size]);
+    unique_ptr<uint8_t[]> exitWin(new uint8_t[size]);     //Earliest win through an exit, or NO_LEVEL
+    unique_ptr<uint8_t[]> lossFloor(new uint8_t[size]);   //Earliest level a loss can have, or NO_LEVEL if an exit draws
+    atomic<int> lastExitLevel(0);
+    atomic<bool> missingTable(false);
+
+    parallelFor(size, threads, [&](uint64_t begin, uint64_t end)
+    {
+        int squares[MAX_PIECES];
+        int side;
+        int localLast = 0;
+        for (uint64_t index = begin; index < end; index++)
+        {
+            decodeIndex(index, count, pawns, squares, side);
+            exitWin[index] = NO_LEVEL;
+            lossFloor[index] = 0;
+            if (!validPosition(codes, squares, count, side))
+            {
+                state[index].store(INVALID, memory_order_relaxed);
+                continue;
+            }
+
+            int moves = 0;
+            int win = NO_LEVEL;
+            int floor = 0;
+            forEachChild(codes, squares, count, side, [&](const int* childCodes, const int* childSquares, int childCount, bool exit)
+            {
+                moves++;
+                if (!exit)
+                {
+                    return;
+                }
+                int wdl, dtm;
+                if (!lookup(childCodes, childSquares, childCount, side ^ 1, wdl, dtm))
+                {
+                    missingTable = true;
+                    return;
+                }
+                if (wdl == TB_LOSS)
+                {
+                    win = min(win, dtm + 1);
+                }
+                else if (wdl == TB_WIN)
+                {
+                    floor = (floor == NO_LEVEL) ? NO_LEVEL : max(floor, dtm + 1);
+                }
+                else
+                {
+                    floor = NO_LEVEL;
+                }
+            });
+
+            if (moves == 0)
+            {
+                int king = kingOf(codes, squares, count, side);
+                bool mated = isAttacked(codes, squares, count, king, side ^ 1, occupancyOf(squares, count));
+                state[index].store(mated ? DECIDED : DRAWN, memory_order_relaxed);
+                continue;
+            }
+            state[index].store(UNDECIDED, memory_order_relaxed);
+            exitWin[index] = static_cast<uint8_t>(min(win, static_cast<int>(NO_LEVEL)));
+            lossFloor[index] = static_cast<uint8_t>(floor);
+            if (win != NO_LEVEL)
+            {
+                localLast = max(localLast, win);
+            }
+            if (floor != NO_LEVEL)
+            {
+                localLast = max(localLast, floor);
+            }
+        }
+        int seen = lastExitLevel.load();
+        while (localLast > seen && !lastExitLevel.compare_exchange_weak(seen, localLast))
+        {
+        }
+    });
+    if (missingTable)
+    {
+        error = "a smaller table needed by " + table.name + " is not loaded";
+        return false;
+    }
+
+    //Checks that every move staying in the table reaches a win of at most maxDtm plies
+    auto allMovesLose = [&](uint64_t index, int maxDtm)
+    {
+        int squares[MAX_PIECES];
+        int side;
+        decodeIndex(index, count, pawns, squares, side);
+        bool lost = true;
+        forEachChild(codes, squares, count, side, [&](const int*, const int* childSquares, int, bool exit)
+        {
+            if (exit || !lost)
+            {
+                return;
+            }
+            int child = state[encodeIndex(childSquares, count, pawns, side ^ 1)].load(memory_order_relaxed);
+            int dtm = child - DECIDED;
+            lost = child >= DECIDED && (dtm & 1) && dtm <= maxDtm;
+        });
+        return lost;
+    };
+
+    int level = 0;
+    for (;; level++)
+    {
+        if (level + 1 > MAX_DTM)
+        {
+            error = table.name + " has mates longer than " + to_string(MAX_DTM) + " plies";
+            return false;
+        }
+
+        //Positions decided at this level by moves that leave the table
+        if (level > 0 && level <= lastExitLevel)
+        {
+            parallelFor(size, threads, [&](uint64_t begin, uint64_t end)
+            {
+                for (uint64_t index = begin; index < end; index++)
+                {
+                    if (state[index].load(memory_order_relaxed) != UNDECIDED)
+                    {
+                        continue;
+                    }
+                    uint8_t expected = UNDECIDED;
+                    if (exitWin[index] == level
+                        || (exitWin[index] == NO_LEVEL && lossFloor[index] == level && allMovesLose(index, level - 1)))
+                    {
+                        state[index].compare_exchange_strong(expected, static_cast<uint8_t>(DECIDED + level));
+                    }
+                }
+            });
+        }
+
+        //One ply back from every position decided at this level
+        atomic<uint64_t> decided(0);
+        parallelFor(size, threads, [&](uint64_t begin, uint64_t end)
+        {
+            int squares[MAX_PIECES];
+            int side;
+            uint64_t found = 0;
+            for (uint64_t index = begin; index < end; index++)
+            {
+                if (state[index].load(memory_order_relaxed) != DECIDED + level)
+                {
+                    continue;
+                }
+                found++;
+                decodeIndex(index, count, pawns, squares, side);
+                forEachParent(codes, squares, count, side, [&](const int* parentSquares)
+                {
+                    uint64_t parents[2];
+                    int parentCount = 1;
+                    parents[0] = encodeIndex(parentSquares, count, pawns, side ^ 1);
+                    if (twinIndex(parentSquares, count, pawns, side ^ 1, parents[1]) && parents[1] != parents[0])
+                    {
+                        parentCount = 2;
+                    }
+                    for (int p = 0; p < parentCount; p++)
+                    {
+                        uint64_t parent = parents[p];
+                        if (state[parent].load(memory_order_relaxed) != UNDECIDED)
+                        {
+                            continue;
+                        }
+                        uint8_t expected = UNDECIDED;
+                        if ((level & 1) == 0)
+                        {
+                            state[parent].compare_exchange_strong(expected, static_cast<uint8_t>(DECIDED + level + 1));
+                        }
+                        else if (exitWin[parent] == NO_LEVEL && lossFloor[parent] <= level + 1 && allMovesLose(parent, level))
+                        {
+                            state[parent].compare_exchange_strong(expected, static_cast<uint8_t>(DECIDED + level + 1));
+                        }
+                    }
+                });
+            }
+            decided += found;
+        });
+        if (decided == 0 && level >= lastExitLevel)
+        {
+            break;
+        }
+    }
+
+    //Pack the results: 2 bits of win/draw/loss and dtmBits of mate distance per position
+    uint64_t wins = 0, losses = 0, draws = 0, invalid = 0;
+    int maxDtm = 0;
+    for (uint64_t index = 0; index < size; index++)
+    {
+        int value = state[index].load(memory_order_relaxed);
+        if (value >= DECIDED)
+        {
+            maxDtm = max(maxDtm, value - DECIDED);
+        }
+    }
+    int dtmBits = 1;
+    while ((1 << dtmBits) <= maxDtm)
+    {
+        dtmBits++;
+    }
+
+    vector<unsigned char> wdlData(static_cast<size_t>((size + 3) / 4), 0);
+    vector<unsigned char> dtmData(static_cast<size_t>((size * dtmBits + 7) / 8 + 1), 0);
+    for (uint64_t index = 0; index < size; index++)
+    {
+        int value = state[index].load(memory_order_relaxed);
+        int code = WDL_DRAW;
+        if (value == INVALID)
+        {
+            code = WDL_INVALID;
+            invalid++;
+        }
+        else if (value >= DECIDED)
+        {
+            int dtm = value - DECIDED;
+            code = (dtm & 1) ? WDL_WIN : WDL_LOSS;
+            if (dtm & 1)
+            {
+                wins++;
+            }
+            else
+            {
+                losses++;
+            }
+            uint64_t bit = index * static_cast<uint64_t>(dtmBits);
+            unsigned shifted = static_cast<unsigned>(dtm) << (bit & 7);
+            dtmData[bit >> 3] |= static_cast<unsigned char>(shifted);
+            dtmData[(bit >> 3) + 1] |= static_cast<unsigned char>(shifted >> 8);
+        }
+        else
+        {
+            draws++;
+        }
+        wdlData[index >> 2] |= static_cast<unsigned char>(code << ((index & 3) * 2));
+    }
+
+    TableFileHeader header = {};
+    memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+    header.version = FILE_VERSION;
+    header.dtmBits = static_cast<uint32_t>(dtmBits);
+    header.maxDtm = static_cast<uint32_t>(maxDtm);
+    header.pieceCount = static_cast<uint32_t>(count);
+    header.positions = size;
+    table.name.copy(header.material, sizeof(header.material) - 1);
+
+    string path = directory + "/" + table.name + ".ctb";
+    ofstream file(path, ios::binary | ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(wdlData.data()), static_cast<streamsize>(wdlData.size()));
+    file.write(reinterpret_cast<const char*>(dtmData.data()), static_cast<streamsize>(dtmData.size()));
+    if (!file)
+    {
+        error = "cannot write " + path;
+        return false;
+    }
+
+    long long ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+    double workMb = static_cast<double>(size) * 3 / (1024.0 * 1024.0);
+    size_t fileBytes = sizeof(header) + wdlData.size() + dtmData.size();
+    out << table.name << ": " << size << " positions (" << wins << " won, " << draws << " drawn, "
+        << losses << " lost, " << invalid << " invalid), longest mate " << maxDtm << " plies\n";
+    out << table.name << ": generated in " << ms << " ms on " << threads << " threads, "
+        << level << " levels, working memory " << static_cast<long long>(workMb + 0.5) << " MB, file "
+        << fileBytes << " bytes (" << dtmBits << "-bit mate distances)\n";
+    return true;
+}
+
+/**
+ * @brief Searches every move to a fixed depth and scores only mates.
+ *
+ * @return MATE - plies for a forced mate within the depth, its negative for
+ *         being mated, and 0 otherwise.
+ */
+static int bruteForce(EngineBoard& board, int depth, int ply, int alpha, int beta)
+{
+    const int MATE = 1000;
+    MoveList moves;
+    board.generateLegalMoves(moves);
+    if (moves.size() == 0)
+    {
+        return board.inCheck() ? -(MATE - ply) : 0;
+    }
+    if (depth == 0)
+    {
+        return 0;
+    }
+    for (int i = 0; i < moves.size(); i++)
+    {
+        board.makeMove(moves[i]);
+        int score = -bruteForce(board, depth - 1, ply + 1, -beta, -alpha);
+        board.unmakeMove();
+        if (score > alpha)
+        {
+            alpha = score;
+            if (alpha >= beta)
+            {
+                break;
+            }
+        }
+    }
+    return alpha;
+}
+
+/**
+ * @brief Checks a table against a brute-force mate search on random positions.
+ */
+int Tablebase::verify(const string& material, int samples, int depth, ostream& out) const
+{
+    Table wanted;
+    if (!parseMaterial(normalise(material), wanted))
+    {
+        return -1;
+    }
+    auto found = byMaterial.find(materialKey(wanted.codes, wanted.pieceCount, false));
+    if (found == byMaterial.end())
+    {
+        return -1;
+    }
+    const Table& table = *found->second;
+    const int MATE = 1000;
+
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    int checked = 0;
+    int shortMates = 0;
+    int mismatches = 0;
+    EngineBoard board;
+    for (long long attempt = 0; checked < samples && attempt < 1000LL * samples; attempt++)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        uint64_t index = seed % table.size;
+        int stored = table.wdlAt(index);
+        if (stored == WDL_INVALID)
+        {
+            continue;
+        }
+        int dtm = (stored == WDL_DRAW) ? 0 : table.dtmAt(index);
+        bool shortMate = stored != WDL_DRAW && dtm <= depth;
+        //Half of the samples must have a mate the search can see
+        if (!shortMate && checked - shortMates >= samples / 2)
+        {
+            continue;
+        }
+
+        int squares[MAX_PIECES];
+        int side;
+        decodeIndex(index, table.pieceCount, table.pawns, squares, side);
+        BoardSnapshot snap = {};
+        for (int i = 0; i < table.pieceCount; i++)
+        {
+            snap.setCode(squares[i], table.codes[i] + 1);
+        }
+        snap.side = static_cast<uint8_t>(side);
+        snap.enPassant = BoardSnapshot::NO_EN_PASSANT;
+        snap.fullmoveNumber = 1;
+        if (!board.loadSnapshot(snap))
+        {
+            continue;
+        }
+
+        int expected = 0;
+        if (shortMate)
+        {
+            expected = (stored == WDL_WIN) ? MATE - dtm : -(MATE - dtm);
+        }
+        int score = bruteForce(board, depth, 0, -MATE - 1, MATE + 1);
+        checked++;
+        shortMates += shortMate ? 1 : 0;
+        if (score != expected)
+        {
+            mismatches++;
+            out << "Mismatch: " << board.toFen() << "  table " << (stored == WDL_WIN ? "win" : stored == WDL_LOSS ? "loss" : "draw")
+                << " in " << dtm << " plies, search " << score << "\n";
+        }
+    }
+    out << table.name << ": checked " << checked << " positions (" << shortMates << " with mates within "
+        << depth << " plies) against a " << depth << "-ply search: " << mismatches << " mismatches\n";
+    return mismatches;
+}
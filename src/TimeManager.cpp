@@ -0,0 +1,78 @@
+//Qusay Edkymish
+//Oct/19/2026
+//TimeManager Class Implementation
+
+#include "TimeManager.h"
+#include <algorithm>    //For min and max.
+
+//Soft limit scale by consecutive iterations with the same best move
+static const double STABILITY_SCALE[5] = { 1.6, 1.25, 1.0, 0.8, 0.65 };
+
+//Score drop in centipawns that doubles the soft limit
+static const int SCORE_DROP_DOUBLING = 150;
+
+/**
+ * @brief Constructs an untimed manager.
+ */
+TimeManager::TimeManager() : softLimit(0), hardLimit(0), adaptive(false), lastScore(0), stableIterations(0)
+{
+}
+
+/**
+ * @brief Sets the limits for a new search.
+ */
+void TimeManager::start(long long moveTime, long long remaining, long long increment, int movesToGo)
+{
+    lastBestMove = Move();
+    lastScore = 0;
+    stableIterations = 0;
+
+    if (moveTime > 0)
+    {
+        softLimit = hardLimit = moveTime;
+        adaptive = false;
+        return;
+    }
+    if (remaining <= 0)
+    {
+        softLimit = hardLimit = 0;
+        adaptive = false;
+        return;
+    }
+
+    long long available = max(1LL, remaining - MOVE_OVERHEAD);
+    int movesLeft = movesToGo > 0 ? min(movesToGo, 50) : DEFAULT_MOVES_TO_GO;
+
+    softLimit = available / movesLeft + increment * 3 / 4;
+    hardLimit = min(softLimit * 4, available * 4 / 5);
+    hardLimit = max(1LL, hardLimit);
+    softLimit = max(1LL, min(softLimit, hardLimit));
+    adaptive = true;
+}
+
+/**
+ * @brief Decides after a completed iteration whether to start another.
+ */
+bool TimeManager::iterationDone(long long elapsedMs, Move bestMove, int score)
+{
+    if (!adaptive)
+    {
+        return false;
+    }
+
+    stableIterations = (bestMove == lastBestMove) ? stableIterations + 1 : 0;
+    double scale = STABILITY_SCALE[min(stableIterations, 4)];
+
+    //A falling score means the position is harder than it looked: think longer
+    int drop = lastScore - score;
+    if (!lastBestMove.isNull() && drop > 0)
+    {
+        scale *= 1.0 + static_cast<double>(min(drop, SCORE_DROP_DOUBLING)) / SCORE_DROP_DOUBLING;
+    }
+
+    lastBestMove = bestMove;
+    lastScore = score;
+
+    long long target = min(hardLimit, static_cast<long long>(softLimit * scale));
+    return elapsedMs >= target;
+}
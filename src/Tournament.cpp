@@ -0,0 +1,369 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Tournament Class Implementation
+
+#include "Tournament.h"
+#include <algorithm>    //For min and max.
+#include <atomic>       //For the next game number and the stop flag.
+#include <chrono>       //For games per hour.
+#include <cmath>        //For logarithms and square roots.
+#include <fstream>      //For reading opening files.
+#include <iomanip>      //For formatting the report.
+#include <memory>       //For the per-thread engines.
+#include <mutex>        //For guarding the standings.
+#include <sstream>      //For splitting settings and move lists.
+#include <thread>       //For the game threads.
+
+//Adjudication: a win after this many plies in a row at or beyond the margin, a draw after the ply limit
+static const int ADJUDICATE_MARGIN = 1000;
+static const int ADJUDICATE_PLIES = 8;
+static const int MAX_GAME_PLIES = 400;
+
+//Openings played when no file is given, as moves from the start position
+static const char* const BUILT_IN_OPENINGS[] =
+{
+    "e2e4 e7e5 g1f3 b8c6 f1b5",     //Ruy Lopez
+    "e2e4 e7e5 g1f3 b8c6 f1c4",     //Italian Game
+    "e2e4 e7e5 f2f4 e5f4",          //King's Gambit
+    "e2e4 c7c5 g1f3 d7d6",          //Sicilian Defence
+    "e2e4 c7c5 b1c3 b8c6",          //Closed Sicilian
+    "e2e4 e7e6 d2d4 d7d5",          //French Defence
+    "e2e4 c7c6 d2d4 d7d5",          //Caro-Kann Defence
+    "e2e4 d7d5 e4d5 d8d5",          //Scandinavian Defence
+    "e2e4 g8f6 e4e5 f6d5",          //Alekhine's Defence
+    "d2d4 d7d5 c2c4 e7e6",          //Queen's Gambit Declined
+    "d2d4 d7d5 c2c4 c7c6",          //Slav Defence
+    "d2d4 g8f6 c2c4 g7g6",          //King's Indian Defence
+    "d2d4 g8f6 c2c4 e7e6 g1f3 b7b6",//Queen's Indian Defence
+    "d2d4 f7f5 g2g3 g8f6",          //Dutch Defence
+    "c2c4 e7e5 b1c3 g8f6",          //English Opening
+    "g1f3 d7d5 g2g3 g8f6"           //Reti Opening
+};
+
+/**
+ * @brief Reads opening positions.
+ */
+bool Tournament::loadOpenings(const string& path, vector<string>& openings, string& error)
+{
+    vector<string> lines;
+    if (path.empty())
+    {
+        lines.assign(begin(BUILT_IN_OPENINGS), end(BUILT_IN_OPENINGS));
+    }
+    else
+    {
+        ifstream file(path);
+        if (!file)
+        {
+            error = "cannot open " + path;
+            return false;
+        }
+        string line;
+        while (getline(file, line))
+        {
+            if (!line.empty() && line.back() == '\r')
+            {
+                line.pop_back();
+            }
+            if (!line.empty() && line[0] != '#' && line.find_first_not_of(" \t") != string::npos)
+            {
+                lines.push_back(line);
+            }
+        }
+    }
+
+    openings.clear();
+    EngineBoard board;
+    for (const string& line : lines)
+    {
+        if (line.find('/') != string::npos)
+        {
+            if (!board.loadFen(line))
+            {
+                error = "not a position: " + line;
+                return false;
+            }
+        }
+        else
+        {
+            board.setStartPosition();
+            istringstream moves(line);
+            string text;
+            while (moves >> text)
+            {
+                Move move = board.parseMove(text);
+                if (move.isNull())
+                {
+                    error = "illegal move " + text + " in: " + line;
+                    return false;
+                }
+                board.makeMove(move);
+            }
+        }
+        openings.push_back(board.toFen());
+    }
+    if (openings.empty())
+    {
+        error = "no openings in " + path;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Applies "name=value" settings (separated by spaces or commas) to an engine.
+ */
+bool Tournament::configure(Search& engine, const string& settings, string& error)
+{
+    string text = settings;
+    replace(text.begin(), text.end(), ',', ' ');
+    istringstream words(text);
+    string setting;
+    while (words >> setting)
+    {
+        size_t equals = setting.find('=');
+        if (equals == string::npos || !engine.setOption(setting.substr(0, equals), setting.substr(equals + 1)))
+        {
+            error = "cannot apply '" + setting + "'";
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Gets the Elo difference that gives an expected score.
+ */
+double Tournament::eloFromScore(double score)
+{
+    score = min(max(score, 1e-6), 1.0 - 1e-6);
+    return -400.0 * log10(1.0 / score - 1.0);
+}
+
+/**
+ * @brief Gets the mean score and its variance per game.
+ */
+static void scoreStatistics(const Tournament::Standings& standings, double& mean, double& variance)
+{
+    double n = standings.games();
+    double w = standings.wins / n;
+    double d = standings.draws / n;
+    double l = standings.losses / n;
+    mean = w + d / 2.0;
+    variance = w * (1.0 - mean) * (1.0 - mean) + d * (0.5 - mean) * (0.5 - mean) + l * mean * mean;
+}
+
+/**
+ * @brief Gets the half-width of the 95% confidence interval of the Elo difference.
+ */
+double Tournament::eloError(const Standings& standings)
+{
+    if (standings.games() < 2)
+    {
+        return 0.0;
+    }
+    double mean, variance;
+    scoreStatistics(standings, mean, variance);
+    double margin = 1.96 * sqrt(variance / standings.games());
+    return (eloFromScore(mean + margin) - eloFromScore(mean - margin)) / 2.0;
+}
+
+/**
+ * @brief Gets the log-likelihood ratio of elo1 against elo0 for a set of results.
+ */
+double Tournament::sprtLlr(const Standings& standings, double elo0, double elo1)
+{
+    if (standings.wins == 0 || standings.losses == 0)
+    {
+        //One-sided results say nothing yet about the variance
+        return 0.0;
+    }
+    double mean, variance;
+    scoreStatistics(standings, mean, variance);
+    double s0 = 1.0 / (1.0 + pow(10.0, -elo0 / 400.0));
+    double s1 = 1.0 / (1.0 + pow(10.0, -elo1 / 400.0));
+    return standings.games() * (s1 - s0) * (2.0 * mean - s0 - s1) / (2.0 * variance);
+}
+
+/**
+ * @brief Plays one game to the end.
+ */
+int Tournament::playGame(Search& white, Search& black, const string& fen, const SearchLimits& limits)
+{
+    EngineBoard board;
+    board.loadFen(fen);
+    white.clear();
+    black.clear();
+
+    int winningPlies = 0;   //Plies in a row with one side ahead by the margin
+    int leader = 0;         //That side: 1 White, -1 Black
+    MoveList legal;
+    for (int ply = 0; ply < MAX_GAME_PLIES; ply++)
+    {
+        board.generateLegalMoves(legal);
+        if (legal.size() == 0)
+        {
+            if (!board.inCheck())
+            {
+                return 0;
+            }
+            return board.sideToMove() == WHITE ? -1 : 1;
+        }
+        if (board.isDraw())
+        {
+            return 0;
+        }
+
+        Search& engine = (board.sideToMove() == WHITE) ? white : black;
+        SearchResult result = engine.think(board, limits);
+        Move move = result.bestMove.isNull() ? legal[0] : result.bestMove;
+
+        int whiteScore = (board.sideToMove() == WHITE) ? result.score : -result.score;
+        int ahead = (whiteScore >= ADJUDICATE_MARGIN) ? 1 : (whiteScore <= -ADJUDICATE_MARGIN ? -1 : 0);
+        winningPlies = (ahead != 0 && ahead == leader) ? winningPlies + 1 : (ahead != 0 ? 1 : 0);
+        leader = ahead;
+        if (winningPlies >= ADJUDICATE_PLIES)
+        {
+            return leader;
+        }
+        board.makeMove(move);
+    }
+    return 0;
+}
+
+/**
+ * @brief Runs a match and writes a line per game and a final verdict.
+ *
+ * Game n uses opening n / 2, with the candidate as White when n is odd.
+ * Threads take the next game number from a shared counter and only lock
+ * the standings to add a result and write its report line.
+ */
+int Tournament::run(const Options& options, ostream& out)
+{
+    vector<string> openings;
+    string error;
+    if (!loadOpenings(options.openings, openings, error))
+    {
+        out << "Cannot load openings: " << error << "\n";
+        return 1;
+    }
+
+    //Check both settings once before any thread starts
+    {
+        Search check;
+        if (!configure(check, options.engineA, error) || !configure(check, options.engineB, error))
+        {
+            out << "Bad engine settings: " << error << "\n";
+            return 1;
+        }
+    }
+
+    SearchLimits limits;
+    limits.nodes = options.nodes;
+    limits.moveTime = options.moveTime;
+    if (options.depth > 0)
+    {
+        limits.depth = options.depth;
+    }
+    if (options.nodes == 0 && options.moveTime == 0 && options.depth <= 0)
+    {
+        limits.depth = 6;
+    }
+
+    int threads = options.concurrency > 0 ? options.concurrency : static_cast<int>(max(1u, thread::hardware_concurrency()));
+    double lower = log(options.beta / (1.0 - options.alpha));
+    double upper = log((1.0 - options.beta) / options.alpha);
+
+    out << "Match: A \"" << options.engineA << "\" vs B \"" << options.engineB << "\", "
+        << openings.size() << " openings, " << threads << " games at once, SPRT elo0 " << options.elo0
+        << " elo1 " << options.elo1 << " bounds [" << fixed << setprecision(2) << lower << ", " << upper << "]\n";
+
+    Standings standings;
+    mutex standingsLock;
+    atomic<int> nextGame(0);
+    atomic<bool> decided(false);
+    double llr = 0.0;
+    auto start = chrono::steady_clock::now();
+
+    auto play = [&]()
+    {
+        //Each thread owns its engines; only the standings are shared
+        unique_ptr<Search> baseline(new Search());
+        unique_ptr<Search> candidate(new Search());
+        string ignored;
+        configure(*baseline, options.engineA, ignored);
+        configure(*candidate, options.engineB, ignored);
+        baseline->setInfoOutput(nullptr);
+        candidate->setInfoOutput(nullptr);
+
+        while (!decided)
+        {
+            int game = nextGame++;
+            if (game >= options.maxGames)
+            {
+                break;
+            }
+            const string& fen = openings[(game / 2) % openings.size()];
+            bool candidateWhite = (game & 1) != 0;
+            int result = candidateWhite ? playGame(*candidate, *baseline, fen, limits)
+                : -playGame(*baseline, *candidate, fen, limits);
+
+            lock_guard<mutex> guard(standingsLock);
+            if (decided)
+            {
+                break;
+            }
+            if (result > 0)
+            {
+                standings.wins++;
+            }
+            else if (result < 0)
+            {
+                standings.losses++;
+            }
+            else
+            {
+                standings.draws++;
+            }
+            double mean, variance;
+            scoreStatistics(standings, mean, variance);
+            llr = sprtLlr(standings, options.elo0, options.elo1);
+            double hours = chrono::duration<double>(chrono::steady_clock::now() - start).count() / 3600.0;
+            out << "Game " << standings.games() << ": +" << standings.wins << " =" << standings.draws
+                << " -" << standings.losses << "  Elo " << setprecision(1) << eloFromScore(mean)
+                << " +/- " << eloError(standings) << "  LLR " << setprecision(2) << llr
+                << "  games/hour " << setprecision(0) << standings.games() / max(hours, 1e-9) << "\n";
+            if (llr <= lower || llr >= upper)
+            {
+                decided = true;
+            }
+        }
+    };
+
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++)
+    {
+        workers.emplace_back(play);
+    }
+    for (thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    out << "Finished " << standings.games() << " games in " << setprecision(1) << seconds << " s ("
+        << setprecision(0) << standings.games() * 3600.0 / max(seconds, 1e-9) << " games/hour): ";
+    if (llr >= upper)
+    {
+        out << "H1 accepted, B gains at least " << options.elo1 << " Elo\n";
+    }
+    else if (llr <= lower)
+    {
+        out << "H0 accepted, B gains no more than " << options.elo0 << " Elo\n";
+    }
+    else
+    {
+        out << "no decision (LLR " << setprecision(2) << llr << ")\n";
+    }
+    return 0;
+}
@@ -0,0 +1,480 @@
+//Qusay Edkymish
+//Oct/19/2026
+//TranspositionTable Class Implementation
+
+#include "TranspositionTable.h"
+#include "EngineBoard.h"
+#include <algorithm>    //For min and max.
+#include <climits>      //For INT_MAX.
+#include <cstdio>       //For renaming a saved hash file into place.
+#include <cstdlib>      //For aligned allocation.
+#include <cstring>      //For memset and memcmp.
+#include <fstream>      //For saving and loading hash files.
+#include <thread>       //For clearing large tables in parallel.
+#include <vector>       //For the clearing threads.
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>      //For opening hash files to map.
+#include <sys/mman.h>   //For mmap and madvise (transparent huge pages).
+#include <sys/stat.h>   //For hash file sizes.
+#include <unistd.h>     //For closing mapped files.
+#endif
+
+#if defined(_WIN32)
+#include <malloc.h>     //For _aligned_malloc.
+#endif
+
+//Huge page size that allocations are rounded up and aligned to
+static const size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+/**
+ * @brief Allocates raw memory aligned to a huge page.
+ *
+ * On Linux the kernel is asked to back the range with transparent huge
+ * pages, which removes most TLB misses on large tables.
+ *
+ * @param bytes The number of bytes, already a multiple of HUGE_PAGE_SIZE.
+ * @return The memory, or nullptr on failure.
+ */
+static void* allocateLarge(size_t bytes)
+{
+#if defined(_WIN32)
+    return _aligned_malloc(bytes, HUGE_PAGE_SIZE);
+#else
+    void* memory = aligned_alloc(HUGE_PAGE_SIZE, bytes);
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (memory)
+    {
+        madvise(memory, bytes, MADV_HUGEPAGE);
+    }
+#endif
+    return memory;
+#endif
+}
+
+/**
+ * @brief Frees memory from allocateLarge().
+ */
+static void freeLarge(void* memory)
+{
+#if defined(_WIN32)
+    _aligned_free(memory);
+#else
+    free(memory);
+#endif
+}
+
+//Identifies hash files written by save()
+static const char FILE_MAGIC[8] = { 'C', 'H', 'E', 'S', 'S', 'T', 'T', '\0' };
+
+/**
+ * @struct HashFileHeader
+ * @brief Fixed fields at the start of a hash file; the rest of the header page is zero.
+ */
+struct HashFileHeader
+{
+    char magic[8];              //FILE_MAGIC
+    uint32_t version;           //FILE_VERSION
+    uint32_t entrySize;         //sizeof(TTEntry)
+    uint32_t entriesPerCluster; //ENTRIES_PER_CLUSTER
+    uint32_t generation;        //Generation when saved
+    uint64_t zobristSeed;       //EngineBoard::ZOBRIST_SEED; keys from another seed are meaningless
+    uint64_t clusterCount;      //Number of clusters that follow the header
+};
+
+/**
+ * @brief Constructs a table of DEFAULT_SIZE_MB megabytes.
+ */
+TranspositionTable::TranspositionTable() : table(nullptr), clusterCount(0), allocatedBytes(0), generation(0), mapped(false)
+{
+    resize(DEFAULT_SIZE_MB);
+}
+
+void TranspositionTable::release()
+{
+#if defined(__unix__) || defined(__APPLE__)
+    if (table && mapped)
+    {
+        munmap(reinterpret_cast<char*>(table) - FILE_HEADER_SIZE, allocatedBytes + FILE_HEADER_SIZE);
+    }
+    else if (table)
+    {
+        freeLarge(table);
+    }
+#else
+    if (table)
+    {
+        freeLarge(table);
+    }
+#endif
+    mapped = false;
+    table = nullptr;
+    clusterCount = 0;
+    allocatedBytes = 0;
+}
+
+/**
+ * @brief Reallocates the table to the given size and clears it.
+ *
+ * @param megabytes The table size in MB (at least 1).
+ * @return False if the memory could not be allocated; the table then keeps its old size.
+ */
+bool TranspositionTable::resize(size_t megabytes)
+{
+    megabytes = max<size_t>(megabytes, 1);
+    size_t count = megabytes * 1024 * 1024 / sizeof(Cluster);
+    size_t bytes = (count * sizeof(Cluster) + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+
+    if (table && count == clusterCount)
+    {
+        clear();
+        return true;
+    }
+
+    Cluster* memory = static_cast<Cluster*>(allocateLarge(bytes));
+    if (!memory)
+    {
+        return false;
+    }
+
+    release();
+    table = memory;
+    clusterCount = count;
+    allocatedBytes = bytes;
+    clear();
+    return true;
+}
+
+/**
+ * @brief Empties every entry.
+ *
+ * Touching tens of gigabytes from one thread takes seconds, so tables
+ * above 256 MB are split between all hardware threads.
+ */
+void TranspositionTable::clear()
+{
+    char* bytes = reinterpret_cast<char*>(table);
+    size_t total = allocatedBytes;
+    size_t threadCount = 1;
+    if (total > 256u * 1024 * 1024)
+    {
+        threadCount = max(1u, thread::hardware_concurrency());
+    }
+
+    if (threadCount == 1)
+    {
+        memset(bytes, 0, total);
+    }
+    else
+    {
+        vector<thread> workers;
+        size_t chunk = (total + threadCount - 1) / threadCount;
+        for (size_t i = 0; i < threadCount; i++)
+        {
+            size_t start = i * chunk;
+            if (start >= total)
+            {
+                break;
+            }
+            size_t length = min(chunk, total - start);
+            workers.emplace_back([bytes, start, length]() { memset(bytes + start, 0, length); });
+        }
+        for (thread& worker : workers)
+        {
+            worker.join();
+        }
+    }
+    generation = 0;
+}
+
+/**
+ * @brief Looks up a position.
+ *
+ * Scans the position's cluster for a matching key fragment. On a miss the
+ * least valuable slot is returned for the caller to overwrite: empty slots
+ * first, then the shallowest, where each generation of age costs 8 plies.
+ *
+ * @param hash The position hash.
+ * @param found Set to true if an entry for the position exists.
+ * @return The matching entry, or the entry that store() would replace.
+ */
+TTEntry* TranspositionTable::probe(uint64_t hash, bool& found) const
+{
+    TTEntry* entries = clusterFor(hash)->entries;
+    uint16_t key16 = keyOf(hash);
+
+    for (int i = 0; i < ENTRIES_PER_CLUSTER; i++)
+    {
+        if (entries[i].key16 == key16 && entries[i].bound() != BOUND_NONE)
+        {
+            //Refresh the generation so a useful entry survives aging
+            entries[i].genBound = static_cast<uint8_t>((generation << 2) | entries[i].bound());
+            found = true;
+            return &entries[i];
+        }
+    }
+
+    found = false;
+    TTEntry* replace = &entries[0];
+    int replaceValue = INT_MAX;
+    for (int i = 0; i < ENTRIES_PER_CLUSTER; i++)
+    {
+        if (entries[i].bound() == BOUND_NONE)
+        {
+            return &entries[i];
+        }
+        int age = (64 + generation - entries[i].generation()) & 63;
+        int value = entries[i].depth - 8 * age;
+        if (value < replaceValue)
+        {
+            replaceValue = value;
+            replace = &entries[i];
+        }
+    }
+    return replace;
+}
+
+/**
+ * @brief Writes a search result into an entry returned by probe().
+ */
+void TranspositionTable::store(TTEntry* entry, uint64_t hash, Move move, int score, int depth, int bound)
+{
+    uint16_t key16 = keyOf(hash);
+    bool samePosition = entry->key16 == key16 && entry->bound() != BOUND_NONE;
+
+    //Keep the old move for this position if the new result has none
+    if (!move.isNull() || !samePosition)
+    {
+        entry->move = move.raw();
+    }
+
+    if (!samePosition || bound == BOUND_EXACT || depth + 2 > entry->depth)
+    {
+        entry->key16 = key16;
+        entry->score = static_cast<int16_t>(score);
+        entry->depth = static_cast<uint8_t>(max(depth, 0));
+        entry->genBound = static_cast<uint8_t>((generation << 2) | bound);
+    }
+}
+
+/**
+ * @brief Writes the table to a file.
+ *
+ * @param path The file to create or overwrite.
+ * @return False if the file could not be written.
+ */
+bool TranspositionTable::save(const string& path) const
+{
+    //Write beside the target and rename it into place: the table may be a mapping of that very file,
+    //which truncating it would pull out from under the copy
+    string temporary = path + ".tmp";
+    ofstream file(temporary, ios::binary | ios::trunc);
+    if (!file)
+    {
+        return false;
+    }
+
+    char header[FILE_HEADER_SIZE] = {};
+    HashFileHeader fields;
+    memcpy(fields.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+    fields.version = FILE_VERSION;
+    fields.entrySize = sizeof(TTEntry);
+    fields.entriesPerCluster = ENTRIES_PER_CLUSTER;
+    fields.generation = generation;
+    fields.zobristSeed = EngineBoard::ZOBRIST_SEED;
+    fields.clusterCount = clusterCount;
+    memcpy(header, &fields, sizeof(fields));
+    file.write(header, sizeof(header));
+
+    //Stream the clusters in 64 MB pieces straight from the table
+    const char* bytes = reinterpret_cast<const char*>(table);
+    size_t total = clusterCount * sizeof(Cluster);
+    const size_t chunk = 64u * 1024 * 1024;
+    for (size_t offset = 0; offset < total && file; offset += chunk)
+    {
+        file.write(bytes + offset, static_cast<streamsize>(min(chunk, total - offset)));
+    }
+    file.close();
+    if (!file)
+    {
+        remove(temporary.c_str());
+        return false;
+    }
+
+    //POSIX rename replaces the target, and a mapping of the old file keeps its pages;
+    //elsewhere the target has to go first
+    if (rename(temporary.c_str(), path.c_str()) != 0
+        && (remove(path.c_str()) != 0 || rename(temporary.c_str(), path.c_str()) != 0))
+    {
+        remove(temporary.c_str());
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Replaces the table with one saved by save().
+ *
+ * @param path The file to load.
+ * @param error Set to a short reason on failure.
+ * @return False if the file is missing or does not match this build.
+ */
+bool TranspositionTable::load(const string& path, string& error)
+{
+    ifstream file(path, ios::binary);
+    if (!file)
+    {
+        error = "cannot open " + path;
+        return false;
+    }
+
+    HashFileHeader fields;
+    if (!file.read(reinterpret_cast<char*>(&fields), sizeof(fields)))
+    {
+        error = "file too short";
+        return false;
+    }
+    if (memcmp(fields.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0)
+    {
+        error = "not a hash file";
+        return false;
+    }
+    if (fields.version != FILE_VERSION || fields.entrySize != sizeof(TTEntry)
+        || fields.entriesPerCluster != ENTRIES_PER_CLUSTER)
+    {
+        error = "hash file format version " + to_string(fields.version) + " does not match this build";
+        return false;
+    }
+    if (fields.zobristSeed != EngineBoard::ZOBRIST_SEED)
+    {
+        error = "hash file was written with a different hash seed";
+        return false;
+    }
+
+    size_t dataBytes = static_cast<size_t>(fields.clusterCount) * sizeof(Cluster);
+    file.seekg(0, ios::end);
+    if (fields.clusterCount == 0 || static_cast<size_t>(file.tellg()) != FILE_HEADER_SIZE + dataBytes)
+    {
+        error = "hash file size does not match its header";
+        return false;
+    }
+    file.close();
+
+#if defined(__unix__) || defined(__APPLE__)
+    //Map copy-on-write: pages are read on first touch and writes stay private
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        error = "cannot open " + path;
+        return false;
+    }
+    void* base = mmap(nullptr, FILE_HEADER_SIZE + dataBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+    {
+        error = "cannot map " + path;
+        return false;
+    }
+
+    release();
+    table = reinterpret_cast<Cluster*>(static_cast<char*>(base) + FILE_HEADER_SIZE);
+    allocatedBytes = dataBytes;
+    mapped = true;
+#else
+    size_t bytes = (dataBytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+    Cluster* memory = static_cast<Cluster*>(allocateLarge(bytes));
+    if (!memory)
+    {
+        error = "not enough memory";
+        return false;
+    }
+
+    ifstream data(path, ios::binary);
+    data.seekg(FILE_HEADER_SIZE);
+    char* target = reinterpret_cast<char*>(memory);
+    const size_t chunk = 64u * 1024 * 1024;
+    for (size_t offset = 0; offset < dataBytes && data; offset += chunk)
+    {
+        data.read(target + offset, static_cast<streamsize>(min(chunk, dataBytes - offset)));
+    }
+    if (!data)
+    {
+        freeLarge(memory);
+        error = "read error";
+        return false;
+    }
+
+    release();
+    table = memory;
+    allocatedBytes = bytes;
+    memset(target + dataBytes, 0, bytes - dataBytes);
+#endif
+
+    clusterCount = static_cast<size_t>(fields.clusterCount);
+    generation = static_cast<uint8_t>(fields.generation & 63);
+    return true;
+}
+
+/**
+ * @brief Estimates table usage in permille by sampling the first 1000 clusters.
+ */
+int TranspositionTable::hashfull() const
+{
+    size_t samples = min<size_t>(1000, clusterCount);
+    int used = 0;
+    for (size_t i = 0; i < samples; i++)
+    {
+        for (int j = 0; j < ENTRIES_PER_CLUSTER; j++)
+        {
+            const TTEntry& entry = table[i].entries[j];
+            if (entry.bound() != BOUND_NONE && entry.generation() == generation)
+            {
+                used++;
+            }
+        }
+    }
+    return samples ? static_cast<int>(used * 1000 / (samples * ENTRIES_PER_CLUSTER)) : 0;
+}
+
+/**
+ * @brief Converts a score to "mate from this node" form for storing.
+ *
+ * Mate scores count plies from the root; stored entries must count from
+ * the node instead, since the same position can be reached at other plies.
+ */
+int TranspositionTable::scoreToTT(int score, int ply, int mateBound)
+{
+    if (score >= mateBound)
+    {
+        return score + ply;
+    }
+    if (score <= -mateBound)
+    {
+        return score - ply;
+    }
+    return score;
+}
+
+/**
+ * @brief Converts a stored score back to "mate from the root" form.
+ */
+int TranspositionTable::scoreFromTT(int score, int ply, int mateBound)
+{
+    if (score >= mateBound)
+    {
+        return score - ply;
+    }
+    if (score <= -mateBound)
+    {
+        return score + ply;
+    }
+    return score;
+}
+
+/**
+ * @brief Destructor. Frees the table memory.
+ */
+TranspositionTable::~TranspositionTable()
+{
+    release();
+}
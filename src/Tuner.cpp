@@ -0,0 +1,767 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Tuner Class Implementation
+
+#include "Tuner.h"
+#include "EngineBoard.h"
+#include "EvalWeights.h"
+#include "Evaluation.h"
+#include "PackedPosition.h"
+#include <algorithm>    //For min, max and swap.
+#include <chrono>       //For epoch times.
+#include <cmath>        //For the logistic function and rounding.
+#include <cstring>      //For comparing cache headers.
+#include <fstream>      //For reading and writing files.
+#include <iomanip>      //For formatting the report and the header.
+#include <sstream>      //For building the header text.
+#include <thread>       //For the gradient threads.
+#include <vector>       //For the weights, gradients and batch order.
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>      //For opening the mapped files.
+#include <sys/mman.h>   //For mmap.
+#include <sys/stat.h>   //For file sizes.
+#include <unistd.h>     //For ftruncate and close.
+#endif
+
+//Term layout: material of pawn..queen, piece-square values of every type and square, the bishop pair, mobility of knight..queen
+static const int MATERIAL_TERM = 0;
+static const int PST_TERM = MATERIAL_TERM + 5;
+static const int BISHOP_PAIR_TERM = PST_TERM + 6 * 64;
+static const int MOBILITY_TERM = BISHOP_PAIR_TERM + 1;
+static const int TERM_COUNT = MOBILITY_TERM + 4;
+
+//Piece-square entries of Black pieces have this bit set; the rest is type * 64 + square from the owner's side
+static const uint16_t BLACK_ENTRY = 0x8000;
+
+//Cache files start with this header; bump the version when the features change
+static const char CACHE_MAGIC[8] = { 'C', 'H', 'E', 'S', 'S', 'F', 'T', 0 };
+static const uint32_t CACHE_VERSION = 1;
+
+//Positions checked against the real evaluation before training
+static const uint64_t MODEL_CHECK_POSITIONS = 10000;
+
+//Adam moment decay rates
+static const double ADAM_BETA1 = 0.9;
+static const double ADAM_BETA2 = 0.999;
+
+/**
+ * @struct FeatureRecord
+ * @brief The sparse feature vector of one position, a fixed 88 bytes so threads can fill the cache in place.
+ */
+struct FeatureRecord
+{
+    int16_t fixedScore;     //Untuned king safety blended by phase, from White's point of view
+    int16_t score;          //Search score from White's point of view
+    int8_t result;          //1 White won, 0 drawn, -1 Black won
+    uint8_t phase;          //Game phase, 0 to 24
+    uint8_t count;          //Used entries of squares
+    uint8_t valid;          //0 if the record did not hold a legal position
+    int8_t material[5];     //White's pawns..queens minus Black's
+    int8_t bishopPair;      //White's bishop pair minus Black's
+    uint8_t reserved[2];    //Always zero
+    int16_t mobility[4];    //White's safe knight..queen squares minus Black's
+    uint16_t squares[32];   //One piece-square entry per piece
+};
+
+static_assert(sizeof(FeatureRecord) == 88, "FeatureRecord is meant to stay 88 bytes");
+
+/**
+ * @struct CacheHeader
+ * @brief The first 64 bytes of a feature cache: what it was built from.
+ */
+struct CacheHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t terms;
+    uint64_t positions;
+    uint64_t dataBytes;
+    uint64_t dataChecksum;
+    uint8_t reserved[24];
+};
+
+static_assert(sizeof(CacheHeader) == 64, "CacheHeader is meant to stay 64 bytes");
+
+/**
+ * @class MappedFile
+ * @brief A file mapped into memory, read-only or freshly created for writing.
+ *
+ * Where mapping is not available the file is held in a buffer instead,
+ * and a created file is written out by finish().
+ */
+class MappedFile
+{
+private:
+    string path;
+    void* mapping = nullptr;
+    vector<unsigned char> buffer;
+
+public:
+    unsigned char* data = nullptr;
+    size_t bytes = 0;
+
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() { close(); }
+
+    /**
+     * @brief Unmaps the file, if any.
+     */
+    void close()
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        if (mapping)
+        {
+            munmap(mapping, bytes);
+        }
+#endif
+        mapping = nullptr;
+        buffer.clear();
+        data = nullptr;
+        bytes = 0;
+    }
+
+    /**
+     * @brief Maps an existing file read-only.
+     */
+    bool openRead(const string& name, string& error)
+    {
+        close();
+        path = name;
+#if defined(__unix__) || defined(__APPLE__)
+        int fd = open(path.c_str(), O_RDONLY);
+        struct stat info;
+        if (fd < 0 || fstat(fd, &info) != 0)
+        {
+            if (fd >= 0)
+            {
+                ::close(fd);
+            }
+            error = "cannot open " + path;
+            return false;
+        }
+        bytes = static_cast<size_t>(info.st_size);
+        if (bytes > 0)
+        {
+            mapping = mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+        }
+        ::close(fd);
+        if (bytes > 0 && mapping == MAP_FAILED)
+        {
+            mapping = nullptr;
+            error = "cannot map " + path;
+            return false;
+        }
+        data = static_cast<unsigned char*>(mapping);
+#else
+        ifstream file(path, ios::binary | ios::ate);
+        if (!file)
+        {
+            error = "cannot open " + path;
+            return false;
+        }
+        bytes = static_cast<size_t>(file.tellg());
+        buffer.resize(bytes);
+        file.seekg(0);
+        if (!file.read(reinterpret_cast<char*>(buffer.data()), static_cast<streamsize>(bytes)))
+        {
+            error = "cannot read " + path;
+            return false;
+        }
+        data = buffer.data();
+#endif
+        return true;
+    }
+
+    /**
+     * @brief Creates a file of a given size and maps it for writing.
+     */
+    bool create(const string& name, size_t size, string& error)
+    {
+        close();
+        path = name;
+        bytes = size;
+#if defined(__unix__) || defined(__APPLE__)
+        int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0 || ftruncate(fd, static_cast<off_t>(size)) != 0)
+        {
+            if (fd >= 0)
+            {
+                ::close(fd);
+            }
+            error = "cannot create " + path;
+            return false;
+        }
+        mapping = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED)
+        {
+            mapping = nullptr;
+            error = "cannot map " + path;
+            return false;
+        }
+        data = static_cast<unsigned char*>(mapping);
+#else
+        buffer.assign(size, 0);
+        data = buffer.data();
+#endif
+        return true;
+    }
+
+    /**
+     * @brief Makes a created file's contents durable.
+     */
+    bool finish(string& error)
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        if (msync(mapping, bytes, MS_SYNC) != 0)
+        {
+            error = "cannot write " + path;
+            return false;
+        }
+#else
+        ofstream file(path, ios::binary | ios::trunc);
+        if (!file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<streamsize>(bytes)))
+        {
+            error = "cannot write " + path;
+            return false;
+        }
+#endif
+        return true;
+    }
+};
+
+/**
+ * @brief Splits a range into one contiguous part per thread and runs body(thread, begin, end) on each.
+ */
+template <typename Body>
+static void parallelSplit(uint64_t begin, uint64_t end, int threads, Body body)
+{
+    uint64_t size = end - begin;
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++)
+    {
+        uint64_t first = begin + size * t / threads;
+        uint64_t last = begin + size * (t + 1) / threads;
+        workers.emplace_back(body, t, first, last);
+    }
+    for (thread& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Calls visit(term, coefficient) for every non-zero feature of a position.
+ */
+template <typename Visit>
+static inline void forEachFeature(const FeatureRecord& record, Visit visit)
+{
+    for (int type = 0; type < 5; type++)
+    {
+        if (record.material[type] != 0)
+        {
+            visit(MATERIAL_TERM + type, static_cast<double>(record.material[type]));
+        }
+    }
+    for (int i = 0; i < record.count; i++)
+    {
+        uint16_t entry = record.squares[i];
+        visit(PST_TERM + (entry & ~BLACK_ENTRY), (entry & BLACK_ENTRY) ? -1.0 : 1.0);
+    }
+    if (record.bishopPair != 0)
+    {
+        visit(BISHOP_PAIR_TERM, static_cast<double>(record.bishopPair));
+    }
+    for (int i = 0; i < 4; i++)
+    {
+        if (record.mobility[i] != 0)
+        {
+            visit(MOBILITY_TERM + i, static_cast<double>(record.mobility[i]));
+        }
+    }
+}
+
+/**
+ * @brief Gets the score the weights give a position, from White's point of view.
+ */
+static double modelScore(const FeatureRecord& record, const vector<double>& mg, const vector<double>& eg)
+{
+    double mgSum = 0.0;
+    double egSum = 0.0;
+    forEachFeature(record, [&](int term, double coefficient)
+    {
+        mgSum += coefficient * mg[term];
+        egSum += coefficient * eg[term];
+    });
+    return record.fixedScore + (mgSum * record.phase + egSum * (24 - record.phase)) / 24.0;
+}
+
+/**
+ * @brief Maps a score to an expected result for White with scale K.
+ */
+static double sigmoid(double score, double k)
+{
+    return 1.0 / (1.0 + exp(-k * score * log(10.0) / 400.0));
+}
+
+/**
+ * @brief Gets the training target of a position: the result, blended with the search score's prediction.
+ */
+static double target(const FeatureRecord& record, double k, double lambda)
+{
+    double result = (record.result + 1) / 2.0;
+    return lambda < 1.0 ? lambda * result + (1.0 - lambda) * sigmoid(record.score, k) : result;
+}
+
+/**
+ * @brief Fills one feature record from a packed position.
+ */
+static void extractFeatures(const PackedPosition& packed, EngineBoard& board, FeatureRecord& record)
+{
+    memset(&record, 0, sizeof(record));
+    record.score = packed.score;
+    record.result = packed.result;
+    if (!board.loadSnapshot(packed.toSnapshot()))
+    {
+        return;
+    }
+
+    EvalTrace trace;
+    Evaluation::evaluate(board, trace);
+    record.valid = 1;
+    record.phase = static_cast<uint8_t>(trace.phase);
+    record.fixedScore = static_cast<int16_t>(lround((trace.kingDanger[BLACK] - trace.kingDanger[WHITE]) * trace.phase / 24.0));
+    record.bishopPair = static_cast<int8_t>(trace.bishopPair[WHITE] - trace.bishopPair[BLACK]);
+    for (int type = KNIGHT; type <= QUEEN; type++)
+    {
+        record.mobility[type - KNIGHT] = static_cast<int16_t>(trace.mobility[WHITE][type] - trace.mobility[BLACK][type]);
+    }
+
+    //Material and piece-square entries, with Black's squares mirrored as in the evaluation
+    for (int color = WHITE; color <= BLACK; color++)
+    {
+        int flip = (color == WHITE) ? 0 : 56;
+        int sign = (color == WHITE) ? 1 : -1;
+        for (int type = PAWN; type <= KING; type++)
+        {
+            uint64_t bb = board.pieces(color, type);
+            if (type < KING)
+            {
+                record.material[type] = static_cast<int8_t>(record.material[type] + sign * Bitboards::popCount(bb));
+            }
+            while (bb && record.count < 32)
+            {
+                int sq = Bitboards::popLsb(bb) ^ flip;
+                uint16_t entry = static_cast<uint16_t>(type * 64 + sq);
+                record.squares[record.count++] = (color == BLACK) ? (entry | BLACK_ENTRY) : entry;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Hashes the first and last 64 KB of the data so a cache is never used with other data.
+ */
+static uint64_t dataChecksum(const unsigned char* data, size_t bytes)
+{
+    const size_t SPAN = 1 << 16;
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    auto add = [&](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            hash = (hash ^ data[i]) * 0x100000001B3ULL;
+        }
+    };
+    add(0, min(bytes, SPAN));
+    add(bytes > SPAN ? bytes - SPAN : bytes, bytes);
+    return hash;
+}
+
+/**
+ * @brief Writes the weights in the layout of EvalWeights.h.
+ */
+static bool writeWeights(const string& path, const vector<double>& mg, const vector<double>& eg, const string& source, string& error)
+{
+    static const char* const TYPE_NAMES[6] = { "Pawn", "Knight", "Bishop", "Rook", "Queen", "King" };
+    auto weight = [](double value) { return static_cast<int>(lround(value)); };
+    auto pieceValues = [&](const vector<double>& w)
+    {
+        ostringstream text;
+        text << "{ ";
+        for (int type = PAWN; type < KING; type++)
+        {
+            text << weight(w[MATERIAL_TERM + type]) << ", ";
+        }
+        text << "0 }";
+        return text.str();
+    };
+    auto mobility = [&](const vector<double>& w)
+    {
+        ostringstream text;
+        text << "{ 0";
+        for (int i = 0; i < 4; i++)
+        {
+            text << ", " << weight(w[MOBILITY_TERM + i]);
+        }
+        text << ", 0 }";
+        return text.str();
+    };
+    auto tables = [&](const char* name, const vector<double>& w)
+    {
+        ostringstream text;
+        text << "static const int " << name << "[6][64] =\n{\n";
+        for (int type = PAWN; type <= KING; type++)
+        {
+            text << "    {   //" << TYPE_NAMES[type] << "\n";
+            for (int rank = 0; rank < 8; rank++)
+            {
+                text << "        ";
+                for (int file = 0; file < 8; file++)
+                {
+                    text << setw(4) << weight(w[PST_TERM + type * 64 + rank * 8 + file]) << (file < 7 ? ", " : "");
+                }
+                text << (rank < 7 ? ",\n" : "\n");
+            }
+            text << (type < KING ? "    },\n" : "    }\n");
+        }
+        text << "};\n";
+        return text.str();
+    };
+
+    ofstream file(path, ios::binary | ios::trunc);
+    if (!file)
+    {
+        error = "cannot create " + path;
+        return false;
+    }
+    file << "//Qusay Edkymish\n"
+        << "//Oct/19/2026\n"
+        << "//Header file for the evaluation weights, compiled into Evaluation.cpp and rewritten by the Tuner class.\n"
+        << "\n"
+        << "#ifndef EVALWEIGHTS_H\n"
+        << "#define EVALWEIGHTS_H\n"
+        << "\n"
+        << "//Source: " << source << "\n"
+        << "\n"
+        << "//Material in the middlegame and endgame, indexed by piece type\n"
+        << "static const int MG_VALUE[6] = " << pieceValues(mg) << ";\n"
+        << "static const int EG_VALUE[6] = " << pieceValues(eg) << ";\n"
+        << "\n"
+        << "//Piece-square tables written from White's side with the eighth rank first,\n"
+        << "//so they are indexed directly by square for White and by (square ^ 56) for Black.\n"
+        << tables("MG_PST", mg)
+        << "\n"
+        << tables("EG_PST", eg)
+        << "\n"
+        << "//Bonus for owning both bishops\n"
+        << "static const int BISHOP_PAIR_MG = " << weight(mg[BISHOP_PAIR_TERM]) << ";\n"
+        << "static const int BISHOP_PAIR_EG = " << weight(eg[BISHOP_PAIR_TERM]) << ";\n"
+        << "\n"
+        << "//Bonus per safe square a piece type reaches (not own pieces, not attacked by enemy pawns)\n"
+        << "static const int MOBILITY_MG[6] = " << mobility(mg) << ";\n"
+        << "static const int MOBILITY_EG[6] = " << mobility(eg) << ";\n"
+        << "\n"
+        << "#endif // !EVALWEIGHTS_H\n";
+    if (!file)
+    {
+        error = "cannot write " + path;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Tunes the weights and writes them as a header.
+ */
+int Tuner::run(const Options& options, ostream& out)
+{
+    string error;
+    MappedFile data;
+    if (!data.openRead(options.data, error))
+    {
+        out << "Cannot load data: " << error << "\n";
+        return 1;
+    }
+    const uint64_t positions = data.bytes / sizeof(PackedPosition);
+    if (positions == 0 || data.bytes % sizeof(PackedPosition) != 0)
+    {
+        out << options.data << " is not a file of " << sizeof(PackedPosition) << "-byte positions\n";
+        return 1;
+    }
+    const PackedPosition* packed = reinterpret_cast<const PackedPosition*>(data.data);
+    int threads = options.threads > 0 ? options.threads : static_cast<int>(max(1u, thread::hardware_concurrency()));
+    auto seconds = [](chrono::steady_clock::time_point since)
+    {
+        return chrono::duration<double>(chrono::steady_clock::now() - since).count();
+    };
+
+    //Reuse the feature cache if it was built from this data by this version, or build it
+    CacheHeader expected;
+    memset(&expected, 0, sizeof(expected));
+    memcpy(expected.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    expected.version = CACHE_VERSION;
+    expected.terms = TERM_COUNT;
+    expected.positions = positions;
+    expected.dataBytes = data.bytes;
+    expected.dataChecksum = dataChecksum(data.data, data.bytes);
+
+    string cachePath = options.data + ".features";
+    size_t cacheBytes = sizeof(CacheHeader) + positions * sizeof(FeatureRecord);
+    MappedFile cache;
+    if (!cache.openRead(cachePath, error) || cache.bytes != cacheBytes || memcmp(cache.data, &expected, sizeof(expected)) != 0)
+    {
+        cache.close();
+        auto start = chrono::steady_clock::now();
+        MappedFile building;
+        if (!building.create(cachePath, cacheBytes, error))
+        {
+            out << "Cannot build features: " << error << "\n";
+            return 1;
+        }
+        FeatureRecord* records = reinterpret_cast<FeatureRecord*>(building.data + sizeof(CacheHeader));
+        parallelSplit(0, positions, threads, [&](int, uint64_t begin, uint64_t end)
+        {
+            EngineBoard board;
+            for (uint64_t i = begin; i < end; i++)
+            {
+                extractFeatures(packed[i], board, records[i]);
+            }
+        });
+        //The header goes in last, so an interrupted build is never taken for a finished one
+        memcpy(building.data, &expected, sizeof(expected));
+        if (!building.finish(error))
+        {
+            out << "Cannot build features: " << error << "\n";
+            return 1;
+        }
+        out << "Built " << cachePath << ": " << positions << " positions, " << fixed << setprecision(1)
+            << cacheBytes / (1024.0 * 1024.0) << " MB in " << seconds(start) << " s\n";
+        if (!cache.openRead(cachePath, error))
+        {
+            out << "Cannot load features: " << error << "\n";
+            return 1;
+        }
+    }
+    const FeatureRecord* records = reinterpret_cast<const FeatureRecord*>(cache.data + sizeof(CacheHeader));
+
+    //Start from the compiled-in weights
+    vector<double> mg(TERM_COUNT), eg(TERM_COUNT);
+    for (int type = PAWN; type < KING; type++)
+    {
+        mg[MATERIAL_TERM + type] = MG_VALUE[type];
+        eg[MATERIAL_TERM + type] = EG_VALUE[type];
+    }
+    for (int type = PAWN; type <= KING; type++)
+    {
+        for (int sq = 0; sq < 64; sq++)
+        {
+            mg[PST_TERM + type * 64 + sq] = MG_PST[type][sq];
+            eg[PST_TERM + type * 64 + sq] = EG_PST[type][sq];
+        }
+    }
+    mg[BISHOP_PAIR_TERM] = BISHOP_PAIR_MG;
+    eg[BISHOP_PAIR_TERM] = BISHOP_PAIR_EG;
+    for (int i = 0; i < 4; i++)
+    {
+        mg[MOBILITY_TERM + i] = MOBILITY_MG[KNIGHT + i];
+        eg[MOBILITY_TERM + i] = MOBILITY_EG[KNIGHT + i];
+    }
+
+    //The features must reproduce the evaluation up to its integer rounding
+    {
+        EngineBoard board;
+        double difference = 0.0;
+        uint64_t checked = 0;
+        for (uint64_t i = 0; i < positions && checked < MODEL_CHECK_POSITIONS; i += max<uint64_t>(1, positions / MODEL_CHECK_POSITIONS))
+        {
+            if (records[i].valid && board.loadSnapshot(packed[i].toSnapshot()))
+            {
+                int score = Evaluation::evaluate(board);
+                int whiteScore = (board.sideToMove() == WHITE) ? score : -score;
+                difference += fabs(modelScore(records[i], mg, eg) - whiteScore);
+                checked++;
+            }
+        }
+        out << "Features reproduce the evaluation within " << fixed << setprecision(2)
+            << difference / max<uint64_t>(checked, 1) << " cp on average over " << checked << " positions\n";
+    }
+
+    //Mean loss over all positions with the given weights and K, one share per thread
+    auto totalLoss = [&](double k)
+    {
+        vector<double> losses(threads, 0.0);
+        vector<uint64_t> counts(threads, 0);
+        parallelSplit(0, positions, threads, [&](int t, uint64_t begin, uint64_t end)
+        {
+            double loss = 0.0;
+            uint64_t count = 0;
+            for (uint64_t i = begin; i < end; i++)
+            {
+                if (records[i].valid)
+                {
+                    double residual = target(records[i], k, options.lambda) - sigmoid(modelScore(records[i], mg, eg), k);
+                    loss += residual * residual;
+                    count++;
+                }
+            }
+            losses[t] = loss;
+            counts[t] = count;
+        });
+        double loss = 0.0;
+        uint64_t count = 0;
+        for (int t = 0; t < threads; t++)
+        {
+            loss += losses[t];
+            count += counts[t];
+        }
+        return loss / max<uint64_t>(count, 1);
+    };
+
+    //Fit K to the starting weights by golden-section search
+    const double GOLDEN = (sqrt(5.0) - 1.0) / 2.0;
+    double low = 0.1, high = 4.0;
+    double a = high - GOLDEN * (high - low), b = low + GOLDEN * (high - low);
+    double lossA = totalLoss(a), lossB = totalLoss(b);
+    for (int i = 0; i < 24; i++)
+    {
+        if (lossA < lossB)
+        {
+            high = b;
+            b = a;
+            lossB = lossA;
+            a = high - GOLDEN * (high - low);
+            lossA = totalLoss(a);
+        }
+        else
+        {
+            low = a;
+            a = b;
+            lossA = lossB;
+            b = low + GOLDEN * (high - low);
+            lossB = totalLoss(b);
+        }
+    }
+    const double k = (low + high) / 2.0;
+    double loss = totalLoss(k);
+    out << "Tuning " << positions << " positions with " << threads << " threads: K " << setprecision(4) << k
+        << ", starting loss " << setprecision(6) << loss << "\n";
+
+    //Adam over shuffled batches; every thread sums its share of a batch into its own gradient
+    const double slope = k * log(10.0) / 400.0;
+    const uint64_t batchSize = static_cast<uint64_t>(max(1, options.batchSize));
+    const uint64_t batches = (positions + batchSize - 1) / batchSize;
+    vector<uint64_t> order(batches);
+    for (uint64_t i = 0; i < batches; i++)
+    {
+        order[i] = i;
+    }
+    vector<vector<double>> threadGradients(threads, vector<double>(2 * TERM_COUNT));
+    vector<double> threadLosses(threads);
+    vector<uint64_t> threadCounts(threads);
+    vector<double> gradient(2 * TERM_COUNT), moment(2 * TERM_COUNT, 0.0), velocity(2 * TERM_COUNT, 0.0);
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    long long step = 0;
+
+    for (int epoch = 1; epoch <= options.epochs; epoch++)
+    {
+        auto start = chrono::steady_clock::now();
+        for (uint64_t i = batches; i > 1; i--)
+        {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            swap(order[i - 1], order[seed % i]);
+        }
+
+        double epochLoss = 0.0;
+        uint64_t epochCount = 0;
+        for (uint64_t batch : order)
+        {
+            uint64_t first = batch * batchSize;
+            uint64_t last = min(positions, first + batchSize);
+            parallelSplit(first, last, threads, [&](int t, uint64_t begin, uint64_t end)
+            {
+                vector<double>& g = threadGradients[t];
+                fill(g.begin(), g.end(), 0.0);
+                double loss = 0.0;
+                uint64_t count = 0;
+                for (uint64_t i = begin; i < end; i++)
+                {
+                    const FeatureRecord& record = records[i];
+                    if (!record.valid)
+                    {
+                        continue;
+                    }
+                    double predicted = sigmoid(modelScore(record, mg, eg), k);
+                    double residual = target(record, k, options.lambda) - predicted;
+                    loss += residual * residual;
+                    count++;
+
+                    //Derivative of the squared error by the score, split between the phases
+                    double d = -2.0 * residual * predicted * (1.0 - predicted) * slope;
+                    double mgShare = d * record.phase / 24.0;
+                    double egShare = d * (24 - record.phase) / 24.0;
+                    forEachFeature(record, [&](int term, double coefficient)
+                    {
+                        g[term] += coefficient * mgShare;
+                        g[TERM_COUNT + term] += coefficient * egShare;
+                    });
+                }
+                threadLosses[t] = loss;
+                threadCounts[t] = count;
+            });
+
+            //Reduce the thread gradients and take one step
+            fill(gradient.begin(), gradient.end(), 0.0);
+            uint64_t count = 0;
+            for (int t = 0; t < threads; t++)
+            {
+                for (int i = 0; i < 2 * TERM_COUNT; i++)
+                {
+                    gradient[i] += threadGradients[t][i];
+                }
+                epochLoss += threadLosses[t];
+                count += threadCounts[t];
+            }
+            epochCount += count;
+            if (count == 0)
+            {
+                continue;
+            }
+            step++;
+            double correction1 = 1.0 - pow(ADAM_BETA1, static_cast<double>(step));
+            double correction2 = 1.0 - pow(ADAM_BETA2, static_cast<double>(step));
+            for (int i = 0; i < 2 * TERM_COUNT; i++)
+            {
+                double g = gradient[i] / count;
+                moment[i] = ADAM_BETA1 * moment[i] + (1.0 - ADAM_BETA1) * g;
+                velocity[i] = ADAM_BETA2 * velocity[i] + (1.0 - ADAM_BETA2) * g * g;
+                double change = options.learningRate * (moment[i] / correction1) / (sqrt(velocity[i] / correction2) + 1e-8);
+                double& weight = (i < TERM_COUNT) ? mg[i] : eg[i - TERM_COUNT];
+                weight -= change;
+            }
+        }
+        double elapsed = seconds(start);
+        out << "Epoch " << epoch << ": loss " << setprecision(6) << epochLoss / max<uint64_t>(epochCount, 1) << "  "
+            << setprecision(2) << elapsed << " s  " << setprecision(1) << positions / max(elapsed, 1e-9) / 1e6
+            << "M positions/s\n";
+    }
+
+    loss = totalLoss(k);
+    ostringstream source;
+    source << "tuned on " << options.data << ", " << positions << " positions, " << options.epochs
+        << " epochs, K " << setprecision(4) << k << ", loss " << setprecision(6) << loss;
+    if (!writeWeights(options.output, mg, eg, source.str(), error))
+    {
+        out << "Cannot write weights: " << error << "\n";
+        return 1;
+    }
+    out << "Final loss " << setprecision(6) << loss << "; wrote " << options.output
+        << " (copy it over include/EvalWeights.h and rebuild to use it)\n";
+    return 0;
+}
@@ -1,36 +1,249 @@
-//Qusay Edkymish
-//Nov/17/2024
-//Main source file for the Chess game project.
-
-#include "Chess.h"
-
-/**
- * @file main.cpp
- * @brief Entry point for the Chess game program.
- *
- * This file initializes the Chess game by creating a `Chess` object,
- * displaying the header, and starting the main menu.
- */
-
- /**
-  * @brief Main function, the entry point of the Chess game program.
-  *
-  * This function initializes the `Chess` object, displays the program header,
-  * and launches the main menu where the user can interact with the game.
-  *
-  * @return Returns 0 to indicate successful execution.
-  */
-int main()
-{
-    //Create a Chess object to manage the game
-    Chess chess;
-
-    //Display the welcome header
-    chess.displayHeader();
-
-    //Launch the main menu
-    chess.mainMenu();
-
-    //End the program
-    return 0;
-}
+//Qusay Edkymish
+//Nov/17/2024
+//Main source file for the Chess game project.
+
+#include "Benchmark.h"
+#include "Chess.h"
+#include "DataGenerator.h"
+#include "GameServer.h"
+#include "LoadGenerator.h"
+#include "Tournament.h"
+#include "Tuner.h"
+#include <cstdlib>      //For reading numeric options.
+#include <fstream>      //For reading command scripts.
+
+/**
+ * @file main.cpp
+ * @brief Entry point for the Chess game program.
+ *
+ * This file initializes the Chess game by creating a `Chess` object,
+ * displaying the header, and starting the main menu.
+ */
+
+ /**
+  * @brief Main function, the entry point of the Chess game program.
+  *
+  * This function initializes the `Chess` object, displays the program header,
+  * and launches the main menu where the user can interact with the game.
+  *
+  * Command-line options:
+  * - `--load-hash <file>` maps a saved transposition table back in before the
+  *   menu starts, so an interrupted analysis resumes where it stopped.
+  * - `--script <file>` runs the Free Play commands in the file headlessly,
+  *   printing one JSON response per command instead of the header and menus.
+  * - `--batch` does the same with commands read from standard input.
+  * - `--bench [depth]` runs the micro benchmarks and the search benchmark
+  *   (depth 8 by default) and prints the node-count signature and speed.
+  * - `--serve <address>` hosts Free Play sessions on "tcp:PORT" or
+  *   "unix:PATH" until interrupted; `--sessions N` sets the board pool size
+  *   and `--engine-threads N` the number of searching threads.
+  * - `--loadgen <address>` runs the load generator against a server;
+  *   `--sessions N` sets the concurrent sessions and `--rounds N` the
+  *   commands each one sends.
+  * - `--match` plays engine settings `--engine-a "<name=value ...>"` against
+  *   `--engine-b "<name=value ...>"` with one game per core and a running
+  *   SPRT; `--games N`, `--nodes N`, `--depth N`, `--movetime MS`,
+  *   `--concurrency N`, `--openings <file>` and `--sprt <elo0> <elo1>` set
+  *   the limits, openings and test bounds.
+  * - `--gendata <file>` plays fixed-node self-play games on every core and
+  *   writes their quiet positions as 32-byte training records;
+  *   `--positions N`, `--nodes N`, `--depth N`, `--concurrency N`,
+  *   `--random-plies N` and `--seed N` set the size, limits, threads and
+  *   openings.
+  * - `--tune <file>` tunes the evaluation weights on a training data file
+  *   and writes them as a header; `--epochs N`, `--tune-batch N`,
+  *   `--learning-rate X`, `--lambda X`, `--concurrency N` and
+  *   `--tune-output <file>` set the training and where the header goes.
+  *
+  * @param argc The number of command-line arguments.
+  * @param argv The command-line arguments.
+  * @return Returns 0 to indicate successful execution, or 1 if a scripted command failed.
+  */
+int main(int argc, char* argv[])
+{
+    //Create a Chess object to manage the game
+    Chess chess;
+
+    GameServer::Options serverOptions;
+    LoadGenerator::Options loadOptions;
+    bool serve = false;
+    bool loadgen = false;
+    Tournament::Options matchOptions;
+    bool match = false;
+    DataGenerator::Options dataOptions;
+    bool gendata = false;
+    Tuner::Options tuneOptions;
+    bool tune = false;
+
+    //Handle command-line options
+    for (int i = 1; i < argc; i++)
+    {
+        string option = argv[i];
+        if (option == "--serve" && i + 1 < argc)
+        {
+            serve = true;
+            serverOptions.address = argv[++i];
+        }
+        else if (option == "--loadgen" && i + 1 < argc)
+        {
+            loadgen = true;
+            loadOptions.address = argv[++i];
+        }
+        else if (option == "--sessions" && i + 1 < argc)
+        {
+            serverOptions.sessions = loadOptions.sessions = atoi(argv[++i]);
+        }
+        else if (option == "--engine-threads" && i + 1 < argc)
+        {
+            serverOptions.engineThreads = atoi(argv[++i]);
+        }
+        else if (option == "--rounds" && i + 1 < argc)
+        {
+            loadOptions.rounds = atoi(argv[++i]);
+        }
+        else if (option == "--match")
+        {
+            match = true;
+        }
+        else if (option == "--engine-a" && i + 1 < argc)
+        {
+            matchOptions.engineA = argv[++i];
+        }
+        else if (option == "--engine-b" && i + 1 < argc)
+        {
+            matchOptions.engineB = argv[++i];
+        }
+        else if (option == "--games" && i + 1 < argc)
+        {
+            matchOptions.maxGames = atoi(argv[++i]);
+        }
+        else if (option == "--nodes" && i + 1 < argc)
+        {
+            matchOptions.nodes = dataOptions.nodes = strtoull(argv[++i], nullptr, 10);
+        }
+        else if (option == "--depth" && i + 1 < argc)
+        {
+            matchOptions.depth = dataOptions.depth = atoi(argv[++i]);
+        }
+        else if (option == "--movetime" && i + 1 < argc)
+        {
+            matchOptions.moveTime = atoll(argv[++i]);
+        }
+        else if (option == "--concurrency" && i + 1 < argc)
+        {
+            matchOptions.concurrency = dataOptions.threads = tuneOptions.threads = atoi(argv[++i]);
+        }
+        else if (option == "--openings" && i + 1 < argc)
+        {
+            matchOptions.openings = argv[++i];
+        }
+        else if (option == "--sprt" && i + 2 < argc)
+        {
+            matchOptions.elo0 = atof(argv[++i]);
+            matchOptions.elo1 = atof(argv[++i]);
+        }
+        else if (option == "--gendata" && i + 1 < argc)
+        {
+            gendata = true;
+            dataOptions.output = argv[++i];
+        }
+        else if (option == "--positions" && i + 1 < argc)
+        {
+            dataOptions.positions = strtoull(argv[++i], nullptr, 10);
+        }
+        else if (option == "--random-plies" && i + 1 < argc)
+        {
+            dataOptions.randomPlies = atoi(argv[++i]);
+        }
+        else if (option == "--seed" && i + 1 < argc)
+        {
+            dataOptions.seed = strtoull(argv[++i], nullptr, 10);
+        }
+        else if (option == "--tune" && i + 1 < argc)
+        {
+            tune = true;
+            tuneOptions.data = argv[++i];
+        }
+        else if (option == "--tune-output" && i + 1 < argc)
+        {
+            tuneOptions.output = argv[++i];
+        }
+        else if (option == "--epochs" && i + 1 < argc)
+        {
+            tuneOptions.epochs = atoi(argv[++i]);
+        }
+        else if (option == "--tune-batch" && i + 1 < argc)
+        {
+            tuneOptions.batchSize = atoi(argv[++i]);
+        }
+        else if (option == "--learning-rate" && i + 1 < argc)
+        {
+            tuneOptions.learningRate = atof(argv[++i]);
+        }
+        else if (option == "--lambda" && i + 1 < argc)
+        {
+            tuneOptions.lambda = atof(argv[++i]);
+        }
+        else if (option == "--load-hash" && i + 1 < argc)
+        {
+            chess.engineCommand("hashload", argv[++i]);
+        }
+        else if (option == "--script" && i + 1 < argc)
+        {
+            ifstream script(argv[++i]);
+            if (!script)
+            {
+                cerr << "Cannot open script " << argv[i] << "\n";
+                return 1;
+            }
+            return chess.runScript(script, cout) == 0 ? 0 : 1;
+        }
+        else if (option == "--batch")
+        {
+            return chess.runScript(cin, cout) == 0 ? 0 : 1;
+        }
+        else if (option == "--bench")
+        {
+            int depth = (i + 1 < argc) ? atoi(argv[i + 1]) : 0;
+            Benchmark::runSuite(depth > 0 ? depth : 8, cout);
+            return 0;
+        }
+    }
+
+    if (tune)
+    {
+        return Tuner::run(tuneOptions, cout);
+    }
+    if (gendata)
+    {
+        return DataGenerator::run(dataOptions, cout);
+    }
+    if (match)
+    {
+        return Tournament::run(matchOptions, cout);
+    }
+    if (loadgen)
+    {
+        return LoadGenerator::run(loadOptions, cout);
+    }
+    if (serve)
+    {
+        GameServer server(serverOptions);
+        string error;
+        if (!server.start(error))
+        {
+            cerr << "Cannot serve on " << serverOptions.address << ": " << error << "\n";
+            return 1;
+        }
+        return server.run();
+    }
+
+    //Display the welcome header
+    chess.displayHeader();
+
+    //Launch the main menu
+    chess.mainMenu();
+
+    //End the program
+    return 0;
+}
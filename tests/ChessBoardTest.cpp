@@ -0,0 +1,117 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Tests for castling on the ChessBoard class: which castling moves isLegal() accepts and how movePiece() plays them.
+//Build: g++ -std=c++17 -O2 -Iinclude tests/ChessBoardTest.cpp src/ChessBoard.cpp src/ChessPiece.cpp src/Pawn.cpp src/Rook.cpp src/Knight.cpp src/Bishop.cpp src/Queen.cpp src/King.cpp src/Position.cpp src/Bitboard.cpp src/AttackMap.cpp src/Profiler.cpp src/EngineBoard.cpp src/Move.cpp -lpthread
+
+#include "ChessBoard.h"
+#include <iostream>     //For the test report.
+#include <string>       //For FEN text and move names.
+
+//Number of failed checks
+static int failures = 0;
+
+/**
+ * @brief Converts a square name like "e1" to a board position.
+ */
+static Position square(const string& name)
+{
+    return Position('8' - name[1], name[0] - 'a');
+}
+
+/**
+ * @brief Checks whether isLegal() gives the expected answer for a move in a position.
+ */
+static void expectLegal(const string& fen, const string& move, bool expected, const string& reason)
+{
+    ChessBoard board;
+    if (!board.loadFen(fen))
+    {
+        cout << "FAIL: cannot load " << fen << "\n";
+        failures++;
+        return;
+    }
+    if (board.isLegal(square(move.substr(0, 2)), square(move.substr(2, 2))) != expected)
+    {
+        cout << "FAIL: " << move << " should be " << (expected ? "legal" : "illegal") << " (" << reason << ") in " << fen << "\n";
+        failures++;
+    }
+}
+
+/**
+ * @brief Plays moves that must all be legal and checks the position they lead to.
+ */
+static void expectPlay(const string& fen, const string moves[], int count, const string& expectedFen)
+{
+    ChessBoard board;
+    board.loadFen(fen);
+    for (int i = 0; i < count; i++)
+    {
+        Position from = square(moves[i].substr(0, 2));
+        Position to = square(moves[i].substr(2, 2));
+        if (!board.isLegal(from, to))
+        {
+            cout << "FAIL: " << moves[i] << " refused in " << board.toFen() << "\n";
+            failures++;
+            return;
+        }
+        board.movePiece(from, to);
+    }
+    if (board.toFen() != expectedFen)
+    {
+        cout << "FAIL: got " << board.toFen() << ", expected " << expectedFen << "\n";
+        failures++;
+    }
+}
+
+/**
+ * @brief Runs the castling checks.
+ *
+ * @return 0 if every check passes, otherwise 1.
+ */
+int main()
+{
+    const string bothSides = "r3k2r/8/8/8/8/8/8/R3K2R w KQkq - 0 1";
+
+    //Legal castling on both wings
+    expectLegal(bothSides, "e1g1", true, "kingside with the path clear");
+    expectLegal(bothSides, "e1c1", true, "queenside with the path clear");
+    expectLegal("r3k2r/8/8/8/8/8/8/R3K2R b KQkq - 0 1", "e8g8", true, "Black kingside");
+    expectLegal("r3k2r/8/8/8/8/8/8/R3K2R b KQkq - 0 1", "e8c8", true, "Black queenside");
+    expectLegal("4k3/8/8/8/1r6/8/8/R3K2R w KQ - 0 1", "e1c1", true, "only the rook crosses the attacked b1");
+
+    //Illegal castling
+    expectLegal("r3k2r/8/8/8/8/8/8/R3K2R w Qkq - 0 1", "e1g1", false, "no kingside right");
+    expectLegal("r3k2r/8/8/8/8/8/8/R3K2R b KQ - 0 1", "e8c8", false, "no Black rights");
+    expectLegal("4k3/8/8/8/8/8/8/R3K1NR w KQ - 0 1", "e1g1", false, "g1 is occupied");
+    expectLegal("4k3/8/8/8/8/8/8/RN2K2R w KQ - 0 1", "e1c1", false, "b1 is occupied");
+    expectLegal("4k3/8/8/8/4r3/8/8/R3K2R w KQ - 0 1", "e1g1", false, "the king is in check");
+    expectLegal("4k3/8/8/8/4r3/8/8/R3K2R w KQ - 0 1", "e1c1", false, "the king is in check");
+    expectLegal("4k3/8/8/8/5r2/8/8/R3K2R w KQ - 0 1", "e1g1", false, "the king crosses the attacked f1");
+    expectLegal("4k3/8/8/8/3r4/8/8/R3K2R w KQ - 0 1", "e1c1", false, "the king crosses the attacked d1");
+    expectLegal("4k3/8/8/8/6r1/8/8/R3K2R w KQ - 0 1", "e1g1", false, "the king lands on the attacked g1");
+    expectLegal("4k3/8/8/8/8/8/5n2/R3K2R w KQ - 0 1", "e1c1", false, "a knight attacks d1");
+    expectLegal("r3k2r/8/8/8/8/8/8/R3K2R b KQkq - 0 1", "e1g1", false, "it is Black's turn");
+    expectLegal("4k3/8/8/8/8/8/8/R4K1R w - - 0 1", "f1h1", false, "a king two squares from home");
+
+    //The move cache shows the castling squares with the king's other moves
+    ChessBoard board;
+    board.loadFen(bothSides);
+    uint64_t targets = board.getMoveTargets(7, 4);
+    if (!(targets & (1ULL << (7 * 8 + 6))) || !(targets & (1ULL << (7 * 8 + 2))))
+    {
+        cout << "FAIL: the king's move targets do not include g1 and c1\n";
+        failures++;
+    }
+
+    //Castling moves the rook and drops the side's rights
+    const string bothCastle[] = { "e1g1", "e8c8" };
+    expectPlay(bothSides, bothCastle, 2, "2kr3r/8/8/8/8/8/8/R4RK1 w - - 2 2");
+
+    //An engine move like e1g1 can be played on the board from an opening
+    const string italian[] = { "e2e4", "e7e5", "g1f3", "b8c6", "f1c4", "f8c5", "e1g1" };
+    expectPlay("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", italian, 7,
+        "r1bqk1nr/pppp1ppp/2n5/2b1p3/2B1P3/5N2/PPPP1PPP/RNBQ1RK1 b kq - 5 4");
+
+    cout << (failures == 0 ? "PASS" : "FAIL") << ": ChessBoard castling\n";
+    return failures == 0 ? 0 : 1;
+}
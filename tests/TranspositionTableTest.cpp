@@ -0,0 +1,79 @@
+//Qusay Edkymish
+//Oct/19/2026
+//Tests for the TranspositionTable class: stored positions are found and other positions miss.
+//Build: g++ -std=c++17 -O2 -Iinclude tests/TranspositionTableTest.cpp src/TranspositionTable.cpp src/Move.cpp -lpthread
+
+#include "TranspositionTable.h"
+#include <cstdint>      //Provides fixed-width integer types.
+#include <iostream>     //For the test report.
+
+/**
+ * @brief Advances an xorshift state and returns it.
+ */
+static uint64_t nextRandom(uint64_t& seed)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    return seed;
+}
+
+/**
+ * @brief Stores random keys in the default table, then probes them and keys that were never stored.
+ *
+ * @return 0 if every stored key is found with its move and almost no other key hits, otherwise 1.
+ */
+int main()
+{
+    const int STORED = 20000;
+    const int PROBED = 1000000;
+    TranspositionTable tt;
+    int failures = 0;
+
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    for (int i = 0; i < STORED; i++)
+    {
+        uint64_t hash = nextRandom(seed);
+        bool found;
+        TTEntry* entry = tt.probe(hash, found);
+        tt.store(entry, hash, Move(i % 64, (i + 1) % 64), 10, 5, BOUND_EXACT);
+    }
+
+    //The same keys again: all of them fit, so all must be found
+    seed = 0x9E3779B97F4A7C15ULL;
+    int lost = 0;
+    for (int i = 0; i < STORED; i++)
+    {
+        uint64_t hash = nextRandom(seed);
+        bool found;
+        TTEntry* entry = tt.probe(hash, found);
+        if (!found || entry->move != Move(i % 64, (i + 1) % 64).raw())
+        {
+            lost++;
+        }
+    }
+    if (lost != 0)
+    {
+        cout << "FAIL: " << lost << " of " << STORED << " stored keys not found\n";
+        failures++;
+    }
+
+    //Keys that were never stored must miss; with 16 key bits per entry a handful of hits in a million is expected
+    uint64_t other = 0xD1B54A32D192ED03ULL;
+    int falseHits = 0;
+    for (int i = 0; i < PROBED; i++)
+    {
+        bool found;
+        tt.probe(nextRandom(other), found);
+        falseHits += found ? 1 : 0;
+    }
+    if (falseHits > PROBED / 10000)
+    {
+        cout << "FAIL: " << falseHits << " of " << PROBED << " keys that were never stored were found\n";
+        failures++;
+    }
+
+    cout << (failures == 0 ? "PASS" : "FAIL") << ": TranspositionTable (" << falseHits << " false hits in "
+        << PROBED << " probes)\n";
+    return failures == 0 ? 0 : 1;
+}